@@ -0,0 +1,408 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file benchmark/main.cpp
+@brief Benchmark main entry point.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "main.h"
+
+/**
+Runs operation the specified number of times and prints the average duration of one iteration.
+
+@param name the name of the benchmarked operation
+@param bitSize the size of the operands
+@param iterations the number of iterations
+@param operation the benchmarked operation
+*/
+template <typename T_Operation>
+void RunBenchmark (const std::string &name, const size_t bitSize, const size_t iterations, T_Operation operation) {
+	Utils::CpuTimer timer;
+
+	for (size_t i = 0; i < iterations; ++i) {
+		operation();
+	}
+
+	timer.Stop();
+
+	std::cout << name << " (" << bitSize << " bits): " << static_cast<double>(timer.GetDuration()) / static_cast<double>(iterations) / 1000.0 << " us" << std::endl;
+}
+
+/**
+Runs operation for the specified number of iterations and prints the average wall clock duration (for the operations which use several threads).
+
+@param name the name of the benchmarked operation
+@param bitSize the size of the operands
+@param iterations the number of iterations
+@param operation the benchmarked operation
+*/
+template <typename T_Operation>
+void RunWallClockBenchmark (const std::string &name, const size_t bitSize, const size_t iterations, T_Operation operation) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	for (size_t i = 0; i < iterations; ++i) {
+		operation();
+	}
+
+	double duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << name << " (" << bitSize << " bits): " << duration / static_cast<double>(iterations) << " ms" << std::endl;
+}
+
+/**
+Runs operation drawCount times on each of threadCount threads and prints the wall clock duration and the total throughput.
+
+@param name the name of the benchmarked operation
+@param threadCount the number of threads
+@param drawCount the number of iterations per thread
+@param operation the benchmarked operation (called concurrently from all the threads)
+*/
+template <typename T_Operation>
+void RunThreadBenchmark (const std::string &name, const size_t threadCount, const size_t drawCount, T_Operation operation) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i < threadCount; ++i) {
+		threads.emplace_back([&operation, drawCount] () {
+			for (size_t j = 0; j < drawCount; ++j) {
+				operation();
+			}
+		});
+	}
+	for (size_t i = 0; i < threadCount; ++i) {
+		threads[i].join();
+	}
+
+	double duration = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << name << " (" << threadCount << " threads): " << duration / 1000.0 << " ms, " << static_cast<double>(threadCount * drawCount) / duration << " draws / us" << std::endl;
+}
+
+/**
+Application entry point.
+
+Measures the cost of the big integer operations which dominate the homomorphic computations (GetPowModN, operator* and operator%) with the big integer library selected at build time,
+with and without the GMP memory pool, as well as the batch (vectorized) modular multiplications and exponentiations.
+
+Also measures the contention when 1 - 64 threads draw blinding factors, using the thread local RandomProvider instances and, for comparison,
+a single generator state protected by a mutex (the only option before the instances became thread local).
+
+Finally, compares the GMP Mersenne Twister and the ChaCha20 random providers, for the random integer sizes used by the protocols and for bulk output,
+and the cost of a fair coin toss drawn from RandomProvider and from RandomBitSource.
+
+The prime generation (plain primes and the primes of a 2048 bit DGK key) is measured with the old draw-and-test loops and with PrimeSearch.
+
+The Paillier randomizers of a 2048 bit key are generated with a full n bit exponent (@f$ r^n \pmod {n^2} @f$) and with a short exponent (@f$ h_s^{\alpha} \pmod {n^2} @f$).
+The Paillier randomizer draws are measured after the randomizer cache is depleted, with and without a background producer thread.
+The latency of a single Paillier decryption (2048 - 4096 bit keys) is measured with the two CRT halves computed sequentially and on two threads.
+ElGamal with a 2048 bit modulus is compared with elliptic curve ElGamal over P-256 (randomizers, homomorphic additions, tests for [0] and ciphertext sizes).
+
+Build with BIG_NUMBER_LIB_NAME=LIB_GMP_MONTGOMERY to measure GetPowModN with the fixed-width Montgomery exponentiation instead of mpz_powm.
+Measured with GMP 6 on x86-64 (ms per exponentiation, three runs each), the Montgomery implementation is not faster, so LIB_GMP remains the default:
+- 1024 bit modulus: mpz_powm 0.41 / 0.41 / 0.59, Montgomery 0.46 / 0.54 / 0.43
+- 2048 bit modulus: mpz_powm 3.13 / 3.43 / 3.24, Montgomery 4.07 / 3.26 / 3.62
+- 3072 bit modulus: mpz_powm 11.3 / 9.9 / 12.7, Montgomery 10.9 / 10.5 / 16.3
+- 4096 bit modulus: mpz_powm 22.7 / 24.6 / 25.5, Montgomery 25.0 / 25.1 / 30.5
+
+@param argc number of command line arguments (unused)
+@param argv array containing the command line arguments (unused)
+@return The process exit status
+*/
+int main (int /* argc */, char * /* argv */[]) {
+	try {
+	#if defined(LIB_GMP_MONTGOMERY)
+		std::cout << "Big integer library: GMP (Montgomery exponentiation)" << std::endl;
+	#elif defined(LIB_GMP)
+		std::cout << "Big integer library: GMP" << std::endl;
+	#elif defined(LIB_MPIR)
+		std::cout << "Big integer library: MPIR" << std::endl;
+	#endif
+
+		const size_t bitSizes[] = {1024, 2048, 3072};
+
+		for (size_t i = 0; i < sizeof(bitSizes) / sizeof(bitSizes[0]); ++i) {
+			const size_t bitSize = bitSizes[i];
+
+			//random odd modulus of exactly bitSize bits
+			BigInteger n = RandomProvider::GetInstance().GetRandomInteger(bitSize);
+			n.SetBit(bitSize - 1).SetBit(0);
+
+			BigInteger a = RandomProvider::GetInstance().GetRandomInteger(n);
+			BigInteger b = RandomProvider::GetInstance().GetRandomInteger(n);
+			BigInteger e = RandomProvider::GetInstance().GetRandomInteger(n);
+			BigInteger product = a * b;
+
+			BigInteger result;
+			RunBenchmark("GetPowModN", bitSize, 200, [&] () { result = a.GetPowModN(e, n); });
+			RunBenchmark("operator*", bitSize, 1000000, [&] () { result = a * b; });
+			RunBenchmark("operator%", bitSize, 1000000, [&] () { result = product % n; });
+
+			//the same operations with the temporaries served from the GMP memory pool
+			GmpMemoryPool::Install(1024 * 1024);
+			RunBenchmark("operator* (GMP memory pool)", bitSize, 1000000, [&] () { result = a * b; });
+			RunBenchmark("operator% (GMP memory pool)", bitSize, 1000000, [&] () { result = product % n; });
+			GmpMemoryPool::Uninstall();
+
+			//16 independent operations, one by one and vectorized (BatchMontgomery, when the CPU supports AVX-512 IFMA)
+			const size_t batchSize = 16;
+			std::vector<BigInteger> lhs, rhs, exponents;
+			std::vector<const BigInteger *> lhsPointers, rhsPointers, exponentPointers;
+			for (size_t j = 0; j < batchSize; ++j) {
+				lhs.push_back(RandomProvider::GetInstance().GetRandomInteger(n));
+				rhs.push_back(RandomProvider::GetInstance().GetRandomInteger(n));
+				exponents.push_back(RandomProvider::GetInstance().GetRandomInteger(n));
+			}
+			for (size_t j = 0; j < batchSize; ++j) {
+				lhsPointers.push_back(&lhs[j]);
+				rhsPointers.push_back(&rhs[j]);
+				exponentPointers.push_back(&exponents[j]);
+			}
+
+			std::vector<BigInteger> results(batchSize);
+			RunBenchmark("MulModN x 16", bitSize, 20000, [&] () { for (size_t j = 0; j < batchSize; ++j) { BigInteger::MulModN(results[j], lhs[j], rhs[j], n); } });
+			RunBenchmark("BatchMulModN x 16", bitSize, 20000, [&] () { results = BigInteger::BatchMulModN(lhsPointers, rhsPointers, n); });
+			RunBenchmark("GetPowModN x 16", bitSize, 20, [&] () { for (size_t j = 0; j < batchSize; ++j) { results[j] = lhs[j].GetPowModN(exponents[j], n); } });
+			RunBenchmark("BatchPowModN x 16", bitSize, 20, [&] () { results = BigInteger::BatchPowModN(lhsPointers, exponentPointers, n); });
+		}
+
+		//blinding factors in Z_n, for a 2048 bit n
+		BigInteger n = RandomProvider::GetInstance().GetRandomInteger(2048);
+		n.SetBit(2047).SetBit(0);
+		const size_t drawCount = 10000;
+
+		//BigInteger doesn't expose its GMP data, so the shared generator works with a copy of n
+		mpz_t sharedN;
+		mpz_init_set_str(sharedN, n.ToString(16).c_str(), 16);
+		gmp_randstate_t sharedState;
+		gmp_randinit_default(sharedState);
+		std::mutex sharedStateMutex;
+
+		for (size_t threadCount = 1; threadCount <= 64; threadCount *= 2) {
+			RunThreadBenchmark("Thread local RandomProvider::GetRandomInteger", threadCount, drawCount, [&n] () {
+				BigInteger blindingFactor = RandomProvider::GetInstance().GetRandomInteger(n);
+			});
+
+			RunThreadBenchmark("Shared generator state + mutex", threadCount, drawCount, [&sharedN, &sharedState, &sharedStateMutex] () {
+				mpz_t blindingFactor;
+				mpz_init(blindingFactor);
+				{
+					std::lock_guard<std::mutex> lock(sharedStateMutex);
+					mpz_urandomm(blindingFactor, sharedState, sharedN);
+				}
+				mpz_clear(blindingFactor);
+			});
+		}
+
+		gmp_randclear(sharedState);
+		mpz_clear(sharedN);
+
+		//the sizes of the blinding factors and randomizers used by the protocols (40 - 128 bit statistical security parameters up to 1024 bit randomizers)
+		const size_t randomSizes[] = {40, 64, 128, 256, 512, 1024, 1100};
+		for (size_t i = 0; i < sizeof(randomSizes) / sizeof(randomSizes[0]); ++i) {
+			const size_t bitSize = randomSizes[i];
+
+			RunBenchmark("RandomProviderGmp::GetRandomInteger", bitSize, 1000000, [bitSize] () { BigInteger value = RandomProviderBase<RandomProviderGmp>::GetInstance().GetRandomInteger(bitSize); });
+			RunBenchmark("RandomProviderChaCha20::GetRandomInteger", bitSize, 1000000, [bitSize] () { BigInteger value = RandomProviderBase<RandomProviderChaCha20>::GetInstance().GetRandomInteger(bitSize); });
+		}
+
+		//fair coins, as tossed for each bit of the DGK comparisons
+		RunBenchmark("RandomProvider::GetRandomInteger", 1, 1000000, [] () { BigInteger coin = RandomProvider::GetInstance().GetRandomInteger(1); });
+		RunBenchmark("RandomBitSource::GetBit", 1, 100000000, [] () { volatile bool coin = RandomBitSource::GetInstance().GetBit(); (void)coin; });
+
+		//prime generation (the thread count of PrimeSearch is set by Core.PrimeSearch.threadCount)
+		const size_t primeSizes[] = {512, 1024};
+		for (size_t i = 0; i < sizeof(primeSizes) / sizeof(primeSizes[0]); ++i) {
+			const size_t bitSize = primeSizes[i];
+
+			RunWallClockBenchmark("RandomProvider::GetMaxLengthRandomPrime", bitSize, 20, [bitSize] () { BigInteger prime = RandomProvider::GetInstance().GetMaxLengthRandomPrime(bitSize); });
+			RunWallClockBenchmark("PrimeSearch::GetMaxLengthRandomPrime", bitSize, 20, [bitSize] () { BigInteger prime = PrimeSearch::GetMaxLengthRandomPrime(bitSize); });
+		}
+
+		//the p and q primes of a 2048 bit DGK key (l = 20, t = 160): p = 2 u v pRand + 1, where pRand is prime
+		BigInteger dgkMultiplier = BigInteger(2) * BigInteger(2).GetPow(22).GetNextPrime() * RandomProvider::GetInstance().GetMaxLengthRandomPrime(160);
+		const size_t dgkRandomSize = 1024 - dgkMultiplier.GetSize();
+		RunWallClockBenchmark("DGK p, GetMaxLengthRandomPrime loop", 1024, 2, [&dgkMultiplier, dgkRandomSize] () {
+			BigInteger p;
+			do {
+				p = dgkMultiplier * RandomProvider::GetInstance().GetMaxLengthRandomPrime(dgkRandomSize) + 1;
+			}
+			while (!p.IsPrime());
+		});
+		RunWallClockBenchmark("DGK p, PrimeSearch::GetLinearFormPrime", 1024, 10, [&dgkMultiplier, dgkRandomSize] () {
+			BigInteger pRand;
+			BigInteger p = PrimeSearch::GetLinearFormPrime(pRand, dgkMultiplier, dgkRandomSize, true);
+		});
+
+		//bulk output (1 MB per call)
+		std::vector<unsigned char> bytes(1024 * 1024);
+		RunBenchmark("RandomProviderGmp::GetRandomBytes", 8 * bytes.size(), 100, [&bytes] () { RandomProviderBase<RandomProviderGmp>::GetInstance().GetRandomBytes(&bytes[0], bytes.size()); });
+		RunBenchmark("RandomProviderChaCha20::GetRandomBytes", 8 * bytes.size(), 100, [&bytes] () { RandomProviderBase<RandomProviderChaCha20>::GetInstance().GetRandomBytes(&bytes[0], bytes.size()); });
+
+		//Paillier randomizers for 2048 bit keys: r^n mod n^2 and h_s^alpha mod n^2 (Core.Paillier.shortRandomizers), with the public key only and via CRT (key holder), without a randomizer cache
+		{
+			Utils::Config &config = Utils::Config::GetInstance();
+			const size_t keySize = config.GetParameter<size_t>("Core.Paillier.keySize", 1024);
+			const size_t capacity = config.GetParameter<size_t>("Core.RandomizerCache.capacity", 100);
+			const size_t producerThreadCount = config.GetParameter<size_t>("Core.RandomizerCache.producerThreadCount", 0);
+			const bool shortRandomizers = config.GetParameter("Core.Paillier.shortRandomizers", false);
+			config.SetParameter("Core.Paillier.keySize", 2048);
+			config.SetParameter("Core.RandomizerCache.capacity", 0);
+			config.SetParameter("Core.RandomizerCache.producerThreadCount", 0);
+
+			Paillier keyGenerator;
+			keyGenerator.GenerateKeys();
+
+			config.SetParameter("Core.Paillier.shortRandomizers", false);
+			Paillier standardPaillier(keyGenerator.GetPublicKey());
+			RunBenchmark("Paillier::GetRandomizer, r^n", standardPaillier.GetMessageSpaceSize(), 50, [&standardPaillier] () { Paillier::Randomizer randomizer = standardPaillier.GetRandomizer(); });
+			Paillier standardCrtPaillier(keyGenerator.GetPublicKey(), keyGenerator.GetPrivateKey());
+			RunBenchmark("Paillier::GetRandomizer, r^n via CRT", standardCrtPaillier.GetMessageSpaceSize(), 50, [&standardCrtPaillier] () { Paillier::Randomizer randomizer = standardCrtPaillier.GetRandomizer(); });
+
+			config.SetParameter("Core.Paillier.shortRandomizers", true);
+			Paillier shortPaillier(keyGenerator.GetPublicKey());
+			RunBenchmark("Paillier::GetRandomizer, h_s^alpha", shortPaillier.GetMessageSpaceSize(), 1000, [&shortPaillier] () { Paillier::Randomizer randomizer = shortPaillier.GetRandomizer(); });
+			Paillier shortCrtPaillier(keyGenerator.GetPublicKey(), keyGenerator.GetPrivateKey());
+			RunBenchmark("Paillier::GetRandomizer, h_s^alpha via CRT", shortCrtPaillier.GetMessageSpaceSize(), 1000, [&shortCrtPaillier] () { Paillier::Randomizer randomizer = shortCrtPaillier.GetRandomizer(); });
+
+			config.SetParameter("Core.Paillier.keySize", keySize);
+			config.SetParameter("Core.RandomizerCache.capacity", capacity);
+			config.SetParameter("Core.RandomizerCache.producerThreadCount", producerThreadCount);
+			config.SetParameter("Core.Paillier.shortRandomizers", shortRandomizers);
+		}
+
+		//latency of a single Paillier decryption, with the two CRT halves computed one after the other and on two threads (Core.Paillier.parallelDecryptionKeySize)
+		{
+			Utils::Config &config = Utils::Config::GetInstance();
+			const size_t keySize = config.GetParameter<size_t>("Core.Paillier.keySize", 1024);
+			const size_t parallelDecryptionKeySize = config.GetParameter<size_t>("Core.Paillier.parallelDecryptionKeySize", 0);
+			//the decryptions only need one worker thread besides the calling thread
+			config.SetParameter("Core.WorkerPool.threadCount", 2);
+
+			const size_t keySizes[] = {2048, 3072, 4096};
+			for (size_t i = 0; i < sizeof(keySizes) / sizeof(keySizes[0]); ++i) {
+				config.SetParameter("Core.Paillier.keySize", keySizes[i]);
+				config.SetParameter("Core.Paillier.parallelDecryptionKeySize", 0);
+				Paillier sequentialPaillier;
+				sequentialPaillier.GenerateKeys();
+
+				config.SetParameter("Core.Paillier.parallelDecryptionKeySize", keySizes[i]);
+				Paillier parallelPaillier(sequentialPaillier.GetPublicKey(), sequentialPaillier.GetPrivateKey());
+
+				Paillier::Ciphertext ciphertext = sequentialPaillier.EncryptInteger(RandomProvider::GetInstance().GetRandomInteger(sequentialPaillier.GetPositiveNegativeBoundary()));
+				RunWallClockBenchmark("Paillier::DecryptInteger, sequential CRT halves", keySizes[i], 50, [&sequentialPaillier, &ciphertext] () { BigInteger plaintext = sequentialPaillier.DecryptInteger(ciphertext); });
+				RunWallClockBenchmark("Paillier::DecryptInteger, parallel CRT halves", keySizes[i], 50, [&parallelPaillier, &ciphertext] () { BigInteger plaintext = parallelPaillier.DecryptInteger(ciphertext); });
+			}
+
+			config.SetParameter("Core.Paillier.keySize", keySize);
+			config.SetParameter("Core.Paillier.parallelDecryptionKeySize", parallelDecryptionKeySize);
+		}
+
+		//ElGamal (2048 bit modulus, 256 bit subgroup) and elliptic curve ElGamal (P-256), at the same (128 bit) security level, without a randomizer cache
+		{
+			Utils::Config &config = Utils::Config::GetInstance();
+			const size_t keySize = config.GetParameter<size_t>("Core.ElGamal.keySize", 1024);
+			const size_t largePrimeFactorSize = config.GetParameter<size_t>("Core.ElGamal.largePrimeFactorSize", 160);
+			const size_t capacity = config.GetParameter<size_t>("Core.RandomizerCache.capacity", 100);
+			const size_t producerThreadCount = config.GetParameter<size_t>("Core.RandomizerCache.producerThreadCount", 0);
+			config.SetParameter("Core.ElGamal.keySize", 2048);
+			config.SetParameter("Core.ElGamal.largePrimeFactorSize", 256);
+			config.SetParameter("Core.RandomizerCache.capacity", 0);
+			config.SetParameter("Core.RandomizerCache.producerThreadCount", 0);
+
+			ElGamal elGamal;
+			elGamal.GenerateKeys();
+			EcElGamal ecElGamal;
+			ecElGamal.GenerateKeys();
+
+			ElGamal::Ciphertext elGamalLhs = elGamal.EncryptInteger(BigInteger(1));
+			ElGamal::Ciphertext elGamalRhs = elGamal.EncryptInteger(BigInteger(0));
+			EcElGamal::Ciphertext ecElGamalLhs = ecElGamal.EncryptInteger(BigInteger(1));
+			EcElGamal::Ciphertext ecElGamalRhs = ecElGamal.EncryptInteger(BigInteger(0));
+
+			RunBenchmark("ElGamal::GetRandomizer", elGamal.GetEncryptionModulus().GetSize(), 1000, [&elGamal] () { ElGamal::Randomizer randomizer = elGamal.GetRandomizer(); });
+			RunBenchmark("EcElGamal::GetRandomizer", ecElGamal.GetEncryptionModulus().GetSize(), 1000, [&ecElGamal] () { EcElGamal::Randomizer randomizer = ecElGamal.GetRandomizer(); });
+			RunBenchmark("ElGamalCiphertext::operator+", elGamal.GetEncryptionModulus().GetSize(), 10000, [&elGamalLhs, &elGamalRhs] () { ElGamal::Ciphertext sum = elGamalLhs + elGamalRhs; });
+			RunBenchmark("EcElGamalCiphertext::operator+", ecElGamal.GetEncryptionModulus().GetSize(), 10000, [&ecElGamalLhs, &ecElGamalRhs] () { EcElGamal::Ciphertext sum = ecElGamalLhs + ecElGamalRhs; });
+			RunBenchmark("ElGamal::IsEncryptedZero", elGamal.GetEncryptionModulus().GetSize(), 1000, [&elGamal, &elGamalRhs] () { elGamal.IsEncryptedZero(elGamalRhs); });
+			RunBenchmark("EcElGamal::IsEncryptedZero", ecElGamal.GetEncryptionModulus().GetSize(), 1000, [&ecElGamal, &ecElGamalRhs] () { ecElGamal.IsEncryptedZero(ecElGamalRhs); });
+
+			//two group elements for ElGamal, two points (two coordinates each) for elliptic curve ElGamal
+			std::cout << "ElGamal ciphertext size: " << 2 * elGamal.GetEncryptionModulus().GetSize() << " bits" << std::endl;
+			std::cout << "EcElGamal ciphertext size: " << 4 * ecElGamal.GetEncryptionModulus().GetSize() << " bits" << std::endl;
+
+			config.SetParameter("Core.ElGamal.keySize", keySize);
+			config.SetParameter("Core.ElGamal.largePrimeFactorSize", largePrimeFactorSize);
+			config.SetParameter("Core.RandomizerCache.capacity", capacity);
+			config.SetParameter("Core.RandomizerCache.producerThreadCount", producerThreadCount);
+		}
+
+		//online cost of the Paillier randomizers (r^n mod n^2), with idle time between the draws (the network round trips of a protocol)
+		Paillier paillier;
+		paillier.GenerateKeys();
+
+		typedef RandomizerCache<RandomizerContainer<Paillier, RandomizerCacheParameters>> PaillierRandomizerCache;
+		RandomizerCacheParameters parameters("Core.RandomizerCache");
+		parameters.capacity = 100;
+		parameters.blockWhenEmpty = true;
+
+		const size_t randomizerDrawCount = 200;
+		const std::chrono::milliseconds idleTime(5);
+		const size_t producerThreadCounts[] = {0, 1};
+		for (size_t i = 0; i < sizeof(producerThreadCounts) / sizeof(producerThreadCounts[0]); ++i) {
+			//without producer threads, the cache is depleted after the first draws, so every draw generates its randomizer inline
+			parameters.producerThreadCount = producerThreadCounts[i];
+			PaillierRandomizerCache cache(paillier, parameters);
+			while (cache.GetDepth() < parameters.capacity) {
+				std::this_thread::sleep_for(idleTime);
+			}
+			for (size_t j = 0; j < parameters.capacity; ++j) {
+				cache.Pop();
+			}
+
+			double duration = 0;
+			for (size_t j = 0; j < randomizerDrawCount; ++j) {
+				std::this_thread::sleep_for(idleTime);
+
+				std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+				cache.Pop();
+				duration += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			}
+
+			PaillierRandomizerCache::Metrics metrics = cache.GetMetrics();
+			std::cout << "RandomizerCache::Pop, " << producerThreadCounts[i] << " producer thread(s) (" << paillier.GetMessageSpaceSize() << " bits): " << duration / static_cast<double>(randomizerDrawCount) << " ms"
+				<< " (stalls: " << metrics.stalls << ", refill rate: " << metrics.refillRate << " randomizers / s)" << std::endl;
+		}
+	}
+	catch (const std::runtime_error &exception) {
+		std::cout << exception.what() << std::endl;
+	}
+	catch (const std::exception &exception) {
+		std::cout << exception.what() << std::endl;
+	}
+	//it won't catch low level exceptions, like division by 0, produced by GMP...
+	catch (...) {
+		std::cout << "Unexpected exception occured." << std::endl;
+	}
+	return 0;
+}
\ No newline at end of file
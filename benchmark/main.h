@@ -0,0 +1,55 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file benchmark/main.h
+@brief Benchmark main header.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef BENCHMARK_HEADER_GUARD
+#define BENCHMARK_HEADER_GUARD
+
+//include our headers
+#include "utils/cpu_timer.h"
+#include "core/big_integer.h"
+#include "core/random_provider.h"
+#include "core/random_bit_source.h"
+#include "core/prime_search.h"
+#include "core/gmp_memory_pool.h"
+#include "core/paillier.h"
+#include "core/el_gamal.h"
+#include "core/ec_el_gamal.h"
+
+//include C++ headers
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SeComLib;
+using namespace SeComLib::Core;
+
+#endif//BENCHMARK_HEADER_GUARD
\ No newline at end of file
@@ -0,0 +1,165 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/baby_step_giant_step.cpp
+@brief Implementation of class BabyStepGiantStep.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "baby_step_giant_step.h"
+
+namespace SeComLib {
+namespace Core {
+	/**
+	The solver is empty and all lookups fail.
+	*/
+	BabyStepGiantStep::BabyStepGiantStep () :
+		lowerBound(0),
+		upperBound(0),
+		babyStepCount(0) {
+	}
+
+	/**
+	Building the solver costs one modular multiplication per baby step (see DecryptionTable).
+
+	@param base the base (invertible modulo n)
+	@param n the modulus
+	@param lowerBound the lower bound of the default range
+	@param upperBound the upper bound of the default range
+	@param babyStepCount the number of baby steps, @f$ m @f$ (0, or a value larger than the default range, selects the whole default range)
+	@param cacheDirectory the directory of the cached baby step tables (empty disables the cache)
+	@throws std::runtime_error the bounds are reversed or the baby step table can't be built
+	*/
+	BabyStepGiantStep::BabyStepGiantStep (const BigInteger &base, const BigInteger &n, const long lowerBound, const long upperBound, const size_t babyStepCount, const std::string &cacheDirectory) :
+		base(base),
+		n(n),
+		lowerBound(lowerBound),
+		upperBound(upperBound),
+		babyStepCount(babyStepCount) {
+		if (lowerBound > upperBound) {
+			throw std::runtime_error("The lower bound must not exceed the upper bound.");
+		}
+
+		size_t rangeSize = static_cast<size_t>(upperBound - lowerBound) + 1;
+		if (0 == this->babyStepCount || this->babyStepCount > rangeSize) {
+			this->babyStepCount = rangeSize;
+		}
+
+		this->babySteps = DecryptionTable(base, n, lowerBound, this->babyStepCount, cacheDirectory);
+		this->giantStep = base.GetInverseModN(n).GetPowModN(static_cast<unsigned long>(this->babyStepCount), n);
+	}
+
+	/**
+	@param residue the residue, @f$ base^{exponent} \pmod n @f$
+	@param exponent receives the exponent
+	@return true if the exponent is in the default range, false otherwise
+	*/
+	bool BabyStepGiantStep::Find (const BigInteger &residue, long &exponent) const {
+		return this->Find(residue, this->lowerBound, this->upperBound, exponent);
+	}
+
+	/**
+	The range may exceed the default range. The giant steps start at @f$ k = \lfloor (a - a_0) / m \rfloor @f$ (which costs an exponentiation, unless @f$ k = 0 @f$)
+	and end at @f$ \lfloor (b - a_0) / m \rfloor @f$.
+	If the order of base is smaller than the range, the smallest matching exponent is returned.
+
+	@param residue the residue, @f$ base^{exponent} \pmod n @f$
+	@param lowerBound the lower bound of the range, @f$ a @f$
+	@param upperBound the upper bound of the range, @f$ b @f$
+	@param exponent receives the exponent
+	@return true if the exponent is in @f$ [a, b] @f$, false otherwise
+	@throws std::runtime_error the bounds are reversed
+	*/
+	bool BabyStepGiantStep::Find (const BigInteger &residue, const long lowerBound, const long upperBound, long &exponent) const {
+		if (lowerBound > upperBound) {
+			throw std::runtime_error("The lower bound must not exceed the upper bound.");
+		}
+
+		if (this->babySteps.IsEmpty()) {
+			return false;
+		}
+
+		long m = static_cast<long>(this->babyStepCount);
+		long firstStep = BabyStepGiantStep::floorDivide(lowerBound - this->lowerBound, m);
+		long lastStep = BabyStepGiantStep::floorDivide(upperBound - this->lowerBound, m);
+
+		/// @f$ residue \cdot base^{-k m} = base^{exponent - k m} \pmod n @f$
+		BigInteger current = residue;
+		if (firstStep > 0) {
+			BigInteger::MulModN(current, residue, this->giantStep.GetPowModN(firstStep, this->n), this->n);
+		}
+		else if (firstStep < 0) {
+			BigInteger::MulModN(current, residue, this->base.GetPowModN(-firstStep * m, this->n), this->n);
+		}
+
+		for (long step = firstStep; ; ++step) {
+			long babyStep;
+			if (this->babySteps.Find(current, babyStep)) {
+				//the first and the last giant steps may cover exponents outside the range
+				long candidate = step * m + babyStep;
+				if (candidate >= lowerBound && candidate <= upperBound) {
+					exponent = candidate;
+
+					return true;
+				}
+			}
+
+			if (step == lastStep) {
+				return false;
+			}
+
+			BigInteger::MulModN(current, current, this->giantStep, this->n);
+		}
+	}
+
+	/**
+	@return true if the solver was not built, false otherwise
+	*/
+	bool BabyStepGiantStep::IsEmpty () const {
+		return this->babySteps.IsEmpty();
+	}
+
+	/**
+	@return The number of baby steps (0 for an empty solver).
+	*/
+	size_t BabyStepGiantStep::GetBabyStepCount () const {
+		return this->babyStepCount;
+	}
+
+	/**
+	@param dividend the dividend
+	@param divisor the (positive) divisor
+	@return @f$ \lfloor dividend / divisor \rfloor @f$
+	*/
+	long BabyStepGiantStep::floorDivide (const long dividend, const long divisor) {
+		long quotient = dividend / divisor;
+
+		//the division truncates towards 0
+		if (dividend % divisor < 0) {
+			--quotient;
+		}
+
+		return quotient;
+	}
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
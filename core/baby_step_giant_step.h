@@ -0,0 +1,104 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/baby_step_giant_step.h
+@brief Definition of class BabyStepGiantStep.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef BABY_STEP_GIANT_STEP_HEADER_GUARD
+#define BABY_STEP_GIANT_STEP_HEADER_GUARD
+
+//include our headers
+#include "big_integer.h"
+#include "decryption_table.h"
+
+//include C++ libraries
+#include <stdexcept>
+#include <string>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief Baby-step giant-step discrete logarithm solver for exponents in a bounded range, @f$ base^x \pmod n \mapsto x \in [a, b] @f$
+
+	Decrypts the crypto providers which encode the plaintexts in the exponent (DGK, ElGamal) when the plaintext range is too large for a full DecryptionTable.
+	The baby steps are a DecryptionTable of @f$ m @f$ consecutive exponents @f$ [a_0, a_0 + m) @f$, where @f$ [a_0, b_0] @f$ is the default range.
+	An exponent @f$ x = k m + y @f$, @f$ y \in [a_0, a_0 + m) @f$, is found by multiplying the residue with the giant step @f$ base^{-m} \pmod n @f$
+	until @f$ base^{x - k m} \pmod n @f$ is in the table, so @f$ m @f$ trades memory for time: a lookup in @f$ [a, b] @f$ costs at most
+	@f$ \lceil (b - a + 1) / m \rceil + 1 @f$ modular multiplications and table probes. When @f$ m @f$ covers the default range, a lookup in it costs a single probe.
+
+	Callers which know a tighter range (e.g. the sum of a few bounded values) should pass it, since the cost only depends on the size of the searched range.
+	*/
+	class BabyStepGiantStep {
+	public:
+		/// Default constructor (empty solver)
+		BabyStepGiantStep ();
+
+		/// Builds the baby step table (or loads it from the cache directory)
+		BabyStepGiantStep (const BigInteger &base, const BigInteger &n, const long lowerBound, const long upperBound, const size_t babyStepCount, const std::string &cacheDirectory = "");
+
+		/// Destructor - void implementation
+		~BabyStepGiantStep () {}
+
+		/// Finds the exponent of residue in the default range
+		bool Find (const BigInteger &residue, long &exponent) const;
+
+		/// Finds the exponent of residue in @f$ [lowerBound, upperBound] @f$
+		bool Find (const BigInteger &residue, const long lowerBound, const long upperBound, long &exponent) const;
+
+		/// Returns true if the solver was not built
+		bool IsEmpty () const;
+
+		/// Returns the number of baby steps, @f$ m @f$
+		size_t GetBabyStepCount () const;
+
+	private:
+		/// The base
+		BigInteger base;
+
+		/// The modulus
+		BigInteger n;
+
+		/// The lower bound of the default range, @f$ a_0 @f$ (the first exponent of the baby step table)
+		long lowerBound;
+
+		/// The upper bound of the default range, @f$ b_0 @f$
+		long upperBound;
+
+		/// The number of baby steps, @f$ m @f$
+		size_t babyStepCount;
+
+		/// @f$ base^i \pmod n \mapsto i @f$, for @f$ i \in [a_0, a_0 + m) @f$
+		DecryptionTable babySteps;
+
+		/// The giant step, @f$ base^{-m} \pmod n @f$
+		BigInteger giantStep;
+
+		/// Computes the floor of the quotient, for a possibly negative dividend
+		static long floorDivide (const long dividend, const long divisor);
+	};
+}//namespace Core
+}//namespace SeComLib
+
+#endif//BABY_STEP_GIANT_STEP_HEADER_GUARD
\ No newline at end of file
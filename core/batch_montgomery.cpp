@@ -0,0 +1,445 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/batch_montgomery.cpp
+@brief Implementation of class BatchMontgomery.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "batch_montgomery.h"
+
+#if defined(BATCH_MONTGOMERY_IFMA)
+	#include <immintrin.h>
+
+	//compiles a single function for AVX-512 IFMA, without changing the target of the rest of the library
+	#define BATCH_MONTGOMERY_TARGET __attribute__((target("avx512f,avx512ifma")))
+#endif
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@return true if the library was built with the IFMA kernel and the CPU (and the operating system) supports AVX-512 IFMA, false otherwise
+	*/
+	bool BatchMontgomery::IsAvailable () {
+	#if defined(BATCH_MONTGOMERY_IFMA)
+		static const bool available = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+
+		return available;
+	#else
+		return false;
+	#endif
+	}
+
+	/**
+	@param n the modulus
+	@return true if n is odd and its size is between BATCH_MONTGOMERY_MIN_MODULUS_SIZE and BATCH_MONTGOMERY_MAX_MODULUS_SIZE bits, false otherwise
+	*/
+	bool BatchMontgomery::IsSupported (mpz_srcptr n) {
+		if (mpz_sgn(n) <= 0 || !mpz_odd_p(n)) {
+			return false;
+		}
+
+		size_t bitCount = mpz_sizeinbase(n, 2);
+
+		return bitCount >= BATCH_MONTGOMERY_MIN_MODULUS_SIZE && bitCount <= BATCH_MONTGOMERY_MAX_MODULUS_SIZE;
+	}
+
+	/**
+	Each thread keeps its own cache, so no locking is required. When the cache is full, the oldest context is replaced.
+
+	@param n the modulus (must satisfy BatchMontgomery::IsSupported)
+	@return A reference to the cached context.
+	*/
+	const BatchMontgomery &BatchMontgomery::GetInstance (mpz_srcptr n) {
+		static thread_local std::unique_ptr<BatchMontgomery> cache[BATCH_MONTGOMERY_CACHE_SIZE];
+		static thread_local size_t nextEntry = 0;
+
+		for (size_t i = 0; i < BATCH_MONTGOMERY_CACHE_SIZE; ++i) {
+			if (cache[i] && cache[i]->Matches(n)) {
+				return *cache[i];
+			}
+		}
+
+		std::unique_ptr<BatchMontgomery> &entry = cache[nextEntry];
+		nextEntry = (nextEntry + 1) % BATCH_MONTGOMERY_CACHE_SIZE;
+		entry.reset(new BatchMontgomery(n));
+
+		return *entry;
+	}
+
+	/**
+	Computes @f$ -n^{-1} \bmod 2^{52} @f$, @f$ R \bmod n @f$ and @f$ R^2 \bmod n @f$.
+
+	@param n the modulus
+	@throws std::runtime_error the modulus is not supported
+	*/
+	BatchMontgomery::BatchMontgomery (mpz_srcptr n) {
+		if (!BatchMontgomery::IsSupported(n)) {
+			throw std::runtime_error("The modulus is not supported by the batch Montgomery implementation.");
+		}
+
+		mpz_init_set(this->modulus, n);
+		this->digitCount = (mpz_sizeinbase(n, 2) + BATCH_MONTGOMERY_DIGIT_SIZE - 1) / BATCH_MONTGOMERY_DIGIT_SIZE;
+
+		mpz_t temp;
+		mpz_init(temp);
+
+		mpz_t digitModulus;
+		mpz_init(digitModulus);
+		mpz_setbit(digitModulus, BATCH_MONTGOMERY_DIGIT_SIZE);
+		mpz_invert(temp, n, digitModulus);
+		mpz_sub(temp, digitModulus, temp);
+		this->modulusInverse = 0;
+		mpz_export(&this->modulusInverse, NULL, -1, sizeof(uint64_t), 0, 0, temp);
+		mpz_clear(digitModulus);
+
+		this->broadcast(this->modulusDigits, n);
+
+		mpz_set_ui(temp, 0);
+		mpz_setbit(temp, this->digitCount * BATCH_MONTGOMERY_DIGIT_SIZE);
+		mpz_mod(temp, temp, n);
+		this->broadcast(this->one, temp);
+
+		mpz_set_ui(temp, 0);
+		mpz_setbit(temp, 2 * this->digitCount * BATCH_MONTGOMERY_DIGIT_SIZE);
+		mpz_mod(temp, temp, n);
+		this->broadcast(this->rSquared, temp);
+
+		mpz_set_ui(temp, 1);
+		this->broadcast(this->unit, temp);
+
+		mpz_clear(temp);
+	}
+
+	/**
+	Frees the modulus.
+	*/
+	BatchMontgomery::~BatchMontgomery () {
+		mpz_clear(this->modulus);
+	}
+
+	/**
+	@param n a modulus
+	@return true if the current context was created for n, false otherwise
+	*/
+	bool BatchMontgomery::Matches (mpz_srcptr n) const {
+		return mpz_cmp(n, this->modulus) == 0;
+	}
+
+	/**
+	Each group of BATCH_MONTGOMERY_LANE_COUNT products requires two Montgomery multiplications: @f$ t = lhs \cdot rhs \cdot R^{-1} @f$ and @f$ t \cdot R^2 \cdot R^{-1} @f$.
+	Outputs may be the same instances as any of the inputs.
+
+	@param outputs the results
+	@param lhs the left hand side operands
+	@param rhs the right hand side operands
+	@param count the number of operations
+	*/
+	void BatchMontgomery::MulModN (mpz_ptr *outputs, const mpz_srcptr *lhs, const mpz_srcptr *rhs, const size_t count) const {
+		const size_t size = this->digitCount * BATCH_MONTGOMERY_LANE_COUNT;
+		std::vector<uint64_t> lhsDigits(size);
+		std::vector<uint64_t> rhsDigits(size);
+
+		for (size_t offset = 0; offset < count; offset += BATCH_MONTGOMERY_LANE_COUNT) {
+			size_t laneCount = std::min(static_cast<size_t>(BATCH_MONTGOMERY_LANE_COUNT), count - offset);
+
+			this->load(&lhsDigits[0], lhs + offset, laneCount);
+			this->load(&rhsDigits[0], rhs + offset, laneCount);
+
+			this->multiply(&lhsDigits[0], &lhsDigits[0], &rhsDigits[0]);
+			this->multiply(&lhsDigits[0], &lhsDigits[0], &this->rSquared[0]);
+
+			this->store(outputs + offset, &lhsDigits[0], laneCount);
+		}
+	}
+
+	/**
+	Fixed window exponentiation in Montgomery form. All the lanes share the sequence of squarings and each lane multiplies by the table entry selected by its own exponent window.
+	Lanes with shorter exponents multiply by 1 (in Montgomery form) until their first non-zero window. Outputs may be the same instances as any of the inputs.
+
+	@param outputs the results
+	@param bases the bases
+	@param exponents the exponents (@f$ \geq 0 @f$)
+	@param count the number of operations
+	*/
+	void BatchMontgomery::PowModN (mpz_ptr *outputs, const mpz_srcptr *bases, const mpz_srcptr *exponents, const size_t count) const {
+		const size_t size = this->digitCount * BATCH_MONTGOMERY_LANE_COUNT;
+		//the window size is capped in order to keep the tables reasonably small
+		const size_t maxWindowSize = 6;
+
+		std::vector<uint64_t> result(size);
+		std::vector<uint64_t> factor(size);
+		std::vector<uint64_t> table;
+
+		for (size_t offset = 0; offset < count; offset += BATCH_MONTGOMERY_LANE_COUNT) {
+			size_t laneCount = std::min(static_cast<size_t>(BATCH_MONTGOMERY_LANE_COUNT), count - offset);
+
+			size_t maxBitCount = 0;
+			for (size_t lane = 0; lane < laneCount; ++lane) {
+				if (mpz_sgn(exponents[offset + lane]) != 0) {
+					maxBitCount = std::max(maxBitCount, mpz_sizeinbase(exponents[offset + lane], 2));
+				}
+			}
+
+			//same cost estimate as BigIntegerGmp::MultiPowModN: table entries + window multiplications
+			size_t windowSize = 1;
+			size_t minCost = maxBitCount;
+			for (size_t i = 2; i <= maxWindowSize; ++i) {
+				size_t cost = (static_cast<size_t>(1) << i) - 2 + (maxBitCount + i - 1) / i;
+				if (cost < minCost) {
+					minCost = cost;
+					windowSize = i;
+				}
+			}
+
+			/// table[j] = base^j in Montgomery form
+			size_t tableSize = static_cast<size_t>(1) << windowSize;
+			table.resize(tableSize * size);
+			std::copy(this->one.begin(), this->one.end(), table.begin());
+			this->load(&table[size], bases + offset, laneCount);
+			this->multiply(&table[size], &table[size], &this->rSquared[0]);
+			for (size_t j = 2; j < tableSize; ++j) {
+				this->multiply(&table[j * size], &table[(j - 1) * size], &table[size]);
+			}
+
+			std::copy(this->one.begin(), this->one.end(), result.begin());
+
+			size_t windowCount = (maxBitCount + windowSize - 1) / windowSize;
+			for (size_t window = windowCount; window > 0; --window) {
+				if (window != windowCount) {
+					for (size_t i = 0; i < windowSize; ++i) {
+						this->multiply(&result[0], &result[0], &result[0]);
+					}
+				}
+
+				size_t lowestBit = (window - 1) * windowSize;
+				for (size_t lane = 0; lane < BATCH_MONTGOMERY_LANE_COUNT; ++lane) {
+					size_t entry = 0;
+					if (lane < laneCount) {
+						for (size_t i = windowSize; i > 0; --i) {
+							entry = (entry << 1) | static_cast<size_t>(mpz_tstbit(exponents[offset + lane], lowestBit + i - 1));
+						}
+					}
+
+					const uint64_t *source = &table[entry * size];
+					for (size_t j = 0; j < this->digitCount; ++j) {
+						factor[j * BATCH_MONTGOMERY_LANE_COUNT + lane] = source[j * BATCH_MONTGOMERY_LANE_COUNT + lane];
+					}
+				}
+
+				this->multiply(&result[0], &result[0], &factor[0]);
+			}
+
+			//convert back from the Montgomery form
+			this->multiply(&result[0], &result[0], &this->unit[0]);
+
+			this->store(outputs + offset, &result[0], laneCount);
+		}
+	}
+
+	/**
+	@param output receives digitCount * BATCH_MONTGOMERY_LANE_COUNT values (digit j of lane l is stored at j * BATCH_MONTGOMERY_LANE_COUNT + l)
+	@param inputs the values of the first count lanes (negative values and values @f$ \geq n @f$ are reduced modulo n); the other lanes are set to 0
+	@param count the number of inputs (at most BATCH_MONTGOMERY_LANE_COUNT)
+	*/
+	void BatchMontgomery::load (uint64_t *output, const mpz_srcptr *inputs, const size_t count) const {
+		mpz_t reduced;
+		mpz_init(reduced);
+
+		for (size_t lane = 0; lane < BATCH_MONTGOMERY_LANE_COUNT; ++lane) {
+			mpz_srcptr input = reduced;
+
+			if (lane < count) {
+				input = inputs[lane];
+				if (mpz_sgn(input) < 0 || mpz_cmp(input, this->modulus) >= 0) {
+					mpz_mod(reduced, input, this->modulus);
+					input = reduced;
+				}
+			}
+			else {
+				mpz_set_ui(reduced, 0);
+			}
+
+			this->loadLane(output, lane, input);
+		}
+
+		mpz_clear(reduced);
+	}
+
+	/**
+	@param output lane-sliced digits
+	@param lane the lane which receives the digits of input
+	@param input the value (@f$ < 2^{digitCount \cdot BATCH\_MONTGOMERY\_DIGIT\_SIZE} @f$)
+	*/
+	void BatchMontgomery::loadLane (uint64_t *output, const size_t lane, mpz_srcptr input) const {
+		const uint64_t digitMask = (static_cast<uint64_t>(1) << BATCH_MONTGOMERY_DIGIT_SIZE) - 1;
+
+		uint64_t words[BatchMontgomery::maxWordCount];
+		std::fill(words, words + this->digitCount * BATCH_MONTGOMERY_DIGIT_SIZE / 64 + 2, 0);
+		mpz_export(words, NULL, -1, sizeof(uint64_t), 0, 0, input);
+
+		for (size_t j = 0; j < this->digitCount; ++j) {
+			size_t bitIndex = j * BATCH_MONTGOMERY_DIGIT_SIZE;
+			size_t word = bitIndex / 64;
+			size_t shift = bitIndex % 64;
+
+			uint64_t digit = words[word] >> shift;
+			//the digit spans two words
+			if (shift > 64 - BATCH_MONTGOMERY_DIGIT_SIZE) {
+				digit |= words[word + 1] << (64 - shift);
+			}
+
+			output[j * BATCH_MONTGOMERY_LANE_COUNT + lane] = digit & digitMask;
+		}
+	}
+
+	/**
+	The value is not reduced, so the modulus itself can be loaded.
+
+	@param output receives the lane-sliced digits
+	@param input the value
+	*/
+	void BatchMontgomery::broadcast (std::vector<uint64_t> &output, mpz_srcptr input) const {
+		output.resize(this->digitCount * BATCH_MONTGOMERY_LANE_COUNT);
+
+		for (size_t lane = 0; lane < BATCH_MONTGOMERY_LANE_COUNT; ++lane) {
+			this->loadLane(&output[0], lane, input);
+		}
+	}
+
+	/**
+	@param outputs the destinations
+	@param input lane-sliced digits (normalized)
+	@param count the number of lanes to store
+	*/
+	void BatchMontgomery::store (mpz_ptr *outputs, const uint64_t *input, const size_t count) const {
+		const size_t wordCount = this->digitCount * BATCH_MONTGOMERY_DIGIT_SIZE / 64 + 2;
+		uint64_t words[BatchMontgomery::maxWordCount];
+
+		for (size_t lane = 0; lane < count; ++lane) {
+			std::fill(words, words + wordCount, 0);
+
+			for (size_t j = 0; j < this->digitCount; ++j) {
+				size_t bitIndex = j * BATCH_MONTGOMERY_DIGIT_SIZE;
+				size_t word = bitIndex / 64;
+				size_t shift = bitIndex % 64;
+				uint64_t digit = input[j * BATCH_MONTGOMERY_LANE_COUNT + lane];
+
+				words[word] |= digit << shift;
+				if (shift > 64 - BATCH_MONTGOMERY_DIGIT_SIZE) {
+					words[word + 1] |= digit >> (64 - shift);
+				}
+			}
+
+			mpz_import(outputs[lane], wordCount, -1, sizeof(uint64_t), 0, 0, words);
+		}
+	}
+
+#if defined(BATCH_MONTGOMERY_IFMA)
+	/**
+	Word-by-word Montgomery multiplication (CIOS) of all the lanes: computes @f$ lhs \cdot rhs \cdot R^{-1} \bmod n @f$.
+
+	Iteration i adds @f$ lhs_i \cdot rhs @f$ and @f$ m \cdot n @f$ (where @f$ m @f$ clears the lowest digit) to the accumulators i to i + digitCount,
+	so the accumulators are never shifted. Each accumulator receives less than @f$ 2^{54} @f$ per iteration, so the 64 bit lanes can't overflow
+	before the final carry propagation. The result is @f$ < 2n @f$ and a single conditional subtraction brings it below n.
+
+	@param output receives the result (may be the same array as lhs or rhs)
+	@param lhs left hand side operands (@f$ < n @f$)
+	@param rhs right hand side operands (@f$ < n @f$)
+	*/
+	BATCH_MONTGOMERY_TARGET void BatchMontgomery::multiply (uint64_t *output, const uint64_t *lhs, const uint64_t *rhs) const {
+		const size_t digitCount = this->digitCount;
+		const uint64_t *modulusDigits = &this->modulusDigits[0];
+
+		//the masked shifts avoid the undefined pass-through operand of the unmasked intrinsics
+		const __mmask8 allLanes = 0xFF;
+		const __m512i zero = _mm512_setzero_si512();
+		const __m512i digitMask = _mm512_set1_epi64((static_cast<long long>(1) << BATCH_MONTGOMERY_DIGIT_SIZE) - 1);
+		const __m512i inverse = _mm512_set1_epi64(static_cast<long long>(this->modulusInverse));
+
+		__m512i accumulators[2 * BatchMontgomery::maxDigitCount + 1];
+		for (size_t k = 0; k <= 2 * digitCount; ++k) {
+			accumulators[k] = zero;
+		}
+
+		for (size_t i = 0; i < digitCount; ++i) {
+			__m512i a = _mm512_loadu_si512(lhs + i * BATCH_MONTGOMERY_LANE_COUNT);
+			__m512i b = _mm512_loadu_si512(rhs);
+			__m512i n = _mm512_loadu_si512(modulusDigits);
+
+			//the lowest digit determines m
+			__m512i t = _mm512_madd52lo_epu64(accumulators[i], a, b);
+			__m512i m = _mm512_and_si512(_mm512_madd52lo_epu64(zero, t, inverse), digitMask);
+			t = _mm512_madd52lo_epu64(t, m, n);
+			__m512i carry = _mm512_maskz_srli_epi64(allLanes, t, BATCH_MONTGOMERY_DIGIT_SIZE);
+
+			for (size_t j = 1; j < digitCount; ++j) {
+				__m512i previousB = b;
+				__m512i previousN = n;
+				b = _mm512_loadu_si512(rhs + j * BATCH_MONTGOMERY_LANE_COUNT);
+				n = _mm512_loadu_si512(modulusDigits + j * BATCH_MONTGOMERY_LANE_COUNT);
+
+				t = accumulators[i + j];
+				t = _mm512_madd52hi_epu64(t, a, previousB);
+				t = _mm512_madd52lo_epu64(t, a, b);
+				t = _mm512_madd52hi_epu64(t, m, previousN);
+				t = _mm512_madd52lo_epu64(t, m, n);
+				accumulators[i + j] = t;
+			}
+
+			accumulators[i + 1] = _mm512_add_epi64(accumulators[i + 1], carry);
+			accumulators[i + digitCount] = _mm512_madd52hi_epu64(_mm512_madd52hi_epu64(accumulators[i + digitCount], a, b), m, n);
+		}
+
+		//propagate the carries
+		for (size_t k = digitCount; k < 2 * digitCount; ++k) {
+			accumulators[k + 1] = _mm512_add_epi64(accumulators[k + 1], _mm512_maskz_srli_epi64(allLanes, accumulators[k], BATCH_MONTGOMERY_DIGIT_SIZE));
+			accumulators[k] = _mm512_and_si512(accumulators[k], digitMask);
+		}
+
+		//subtract n from the lanes where the result is >= n
+		__m512i difference[BatchMontgomery::maxDigitCount];
+		__m512i borrow = zero;
+		for (size_t j = 0; j < digitCount; ++j) {
+			__m512i t = _mm512_sub_epi64(_mm512_sub_epi64(accumulators[digitCount + j], _mm512_loadu_si512(modulusDigits + j * BATCH_MONTGOMERY_LANE_COUNT)), borrow);
+			borrow = _mm512_maskz_srli_epi64(allLanes, t, 63);
+			difference[j] = _mm512_and_si512(t, digitMask);
+		}
+		__mmask8 keep = _mm512_cmplt_epi64_mask(_mm512_sub_epi64(accumulators[2 * digitCount], borrow), zero);
+
+		for (size_t j = 0; j < digitCount; ++j) {
+			_mm512_storeu_si512(output + j * BATCH_MONTGOMERY_LANE_COUNT, _mm512_mask_blend_epi64(keep, difference[j], accumulators[digitCount + j]));
+		}
+	}
+#else
+	/**
+	Not available without the IFMA kernel (BatchMontgomery::IsAvailable returns false).
+
+	@throws std::runtime_error always
+	*/
+	void BatchMontgomery::multiply (uint64_t *, const uint64_t *, const uint64_t *) const {
+		throw std::runtime_error("The batch Montgomery multiplication requires AVX-512 IFMA.");
+	}
+#endif
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
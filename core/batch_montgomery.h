@@ -0,0 +1,186 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/batch_montgomery.h
+@brief Definition of class BatchMontgomery.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef BATCH_MONTGOMERY_HEADER_GUARD
+#define BATCH_MONTGOMERY_HEADER_GUARD
+
+//include our headers
+#include "big_integer_gmp.h"
+
+//include C++ headers
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+//the AVX-512 IFMA kernel requires the GCC / Clang target attributes (other compilers use the scalar fallback)
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+	#define BATCH_MONTGOMERY_IFMA
+#endif
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief The number of operations performed in parallel by BatchMontgomery (one per 64 bit lane of an AVX-512 register).
+	*/
+	#define BATCH_MONTGOMERY_LANE_COUNT 8
+
+	/**
+	@brief The size (in bits) of the digits used by BatchMontgomery (the operand size of the IFMA instructions).
+	*/
+	#define BATCH_MONTGOMERY_DIGIT_SIZE 52
+
+	/**
+	@brief The largest modulus (in bits) handled by BatchMontgomery.
+
+	Covers @f$ n^2 @f$ for 3072 bit Paillier moduli.
+	*/
+	#define BATCH_MONTGOMERY_MAX_MODULUS_SIZE 6144
+
+	/**
+	@brief The smallest modulus (in bits) handled by BatchMontgomery.
+
+	For small moduli, the conversions cost more than the regular GMP functions.
+	*/
+	#define BATCH_MONTGOMERY_MIN_MODULUS_SIZE 256
+
+	/**
+	@brief The smallest batch of modular multiplications handed to BatchMontgomery.
+
+	A batch always costs as much as BATCH_MONTGOMERY_LANE_COUNT operations, so smaller batches are computed one by one with GMP.
+	*/
+	#define BATCH_MONTGOMERY_MIN_MULTIPLICATION_COUNT 4
+
+	/**
+	@brief The smallest modulus (in bits) for which the modular multiplications are handed to BatchMontgomery.
+
+	A single multiplication doesn't amortize the conversions to and from the lane-sliced digits for smaller moduli.
+	*/
+	#define BATCH_MONTGOMERY_MIN_MULTIPLICATION_MODULUS_SIZE 2048
+
+	/**
+	@brief The smallest batch of modular exponentiations handed to BatchMontgomery.
+	*/
+	#define BATCH_MONTGOMERY_MIN_EXPONENTIATION_COUNT 2
+
+	/**
+	@brief The number of contexts cached (per thread) by BatchMontgomery::GetInstance
+	*/
+	#define BATCH_MONTGOMERY_CACHE_SIZE 4
+
+	/**
+	@brief Montgomery arithmetic on BATCH_MONTGOMERY_LANE_COUNT independent operands at once, for a fixed, odd modulus.
+
+	The operands are split into BATCH_MONTGOMERY_DIGIT_SIZE bit digits and stored lane-sliced (digit @f$ j @f$ of all the operands is stored in one AVX-512 register),
+	so that each AVX-512 IFMA instruction (vpmadd52luq / vpmadd52huq) advances the Montgomery multiplications of all the lanes by one digit product.
+	The accumulators have 12 spare bits, so the carries are propagated only once, at the end of each multiplication.
+
+	The IFMA kernel is selected at runtime (BatchMontgomery::IsAvailable). CPUs without AVX-512 IFMA use the GMP functions, one operation at a time
+	(an AVX2 kernel would be limited to 32 x 32 bit products, which don't outperform the GMP mulx / adx assembly code).
+
+	Used by BigIntegerGmp::BatchMulModN and BigIntegerGmp::BatchPowModN.
+	*/
+	class BatchMontgomery {
+	public:
+		/// Checks if the IFMA kernel can be used on the current CPU
+		static bool IsAvailable ();
+
+		/// Checks if n can be handled by this class
+		static bool IsSupported (mpz_srcptr n);
+
+		/// Returns a (thread local) cached context for n
+		static const BatchMontgomery &GetInstance (mpz_srcptr n);
+
+		/// Constructor
+		BatchMontgomery (mpz_srcptr n);
+
+		/// Destructor
+		~BatchMontgomery ();
+
+		/// Checks if the current context was created for n
+		bool Matches (mpz_srcptr n) const;
+
+		/// Computes @f$ lhs_i \cdot rhs_i \pmod n @f$
+		void MulModN (mpz_ptr *outputs, const mpz_srcptr *lhs, const mpz_srcptr *rhs, const size_t count) const;
+
+		/// Computes @f$ bases_i^{exponents_i} \pmod n @f$
+		void PowModN (mpz_ptr *outputs, const mpz_srcptr *bases, const mpz_srcptr *exponents, const size_t count) const;
+
+	private:
+		/// The maximum number of digits of the modulus
+		static const size_t maxDigitCount = (BATCH_MONTGOMERY_MAX_MODULUS_SIZE + BATCH_MONTGOMERY_DIGIT_SIZE - 1) / BATCH_MONTGOMERY_DIGIT_SIZE;
+
+		/// The number of 64 bit words used to convert the digits of one operand (includes a spare word for the digits which span two words)
+		static const size_t maxWordCount = BatchMontgomery::maxDigitCount * BATCH_MONTGOMERY_DIGIT_SIZE / 64 + 2;
+
+		/// The modulus
+		mpz_t modulus;
+
+		/// The number of digits of the modulus
+		size_t digitCount;
+
+		/// @f$ -n^{-1} \bmod 2^{52} @f$
+		uint64_t modulusInverse;
+
+		/// The digits of the modulus (replicated in all the lanes)
+		std::vector<uint64_t> modulusDigits;
+
+		/// @f$ R \bmod n @f$ (1 in Montgomery form, replicated in all the lanes), where @f$ R = 2^{52 \cdot digitCount} @f$
+		std::vector<uint64_t> one;
+
+		/// @f$ R^2 \bmod n @f$ (replicated in all the lanes)
+		std::vector<uint64_t> rSquared;
+
+		/// 1 (replicated in all the lanes), used to convert values back from the Montgomery form
+		std::vector<uint64_t> unit;
+
+		/// Loads up to BATCH_MONTGOMERY_LANE_COUNT inputs into lane-sliced digits, reducing them modulo n if required
+		void load (uint64_t *output, const mpz_srcptr *inputs, const size_t count) const;
+
+		/// Splits a non-negative value into the digits of one lane
+		void loadLane (uint64_t *output, const size_t lane, mpz_srcptr input) const;
+
+		/// Loads the same value into all the lanes
+		void broadcast (std::vector<uint64_t> &output, mpz_srcptr input) const;
+
+		/// Stores the first count lanes into the outputs
+		void store (mpz_ptr *outputs, const uint64_t *input, const size_t count) const;
+
+		/// Montgomery multiplication of all the lanes
+		void multiply (uint64_t *output, const uint64_t *lhs, const uint64_t *rhs) const;
+
+		/// Copy constructor - not implemented
+		BatchMontgomery (BatchMontgomery const &);
+
+		/// Copy assignment operator - not implemented
+		BatchMontgomery operator= (BatchMontgomery const &);
+	};
+}//namespace Core
+}//namespace SeComLib
+
+#endif//BATCH_MONTGOMERY_HEADER_GUARD
\ No newline at end of file
@@ -33,14 +33,14 @@ limitations under the License.
 #include "big_integer_base.h"
 
 //MPIR is compatible with GMPs functions
-#if defined(LIB_GMP) || defined(LIB_MPIR)
+#if defined(LIB_GMP) || defined(LIB_GMP_MONTGOMERY) || defined(LIB_MPIR)
 	#include "big_integer_gmp.h"
 #endif
 
 namespace SeComLib {
 namespace Core {
 	//MPIR is compatible with GMPs functions
-	#if defined(LIB_GMP) || defined(LIB_MPIR)
+	#if defined(LIB_GMP) || defined(LIB_GMP_MONTGOMERY) || defined(LIB_MPIR)
 		/// Masks the big integer library wrapper classes under a common name
 		typedef BigIntegerBase<BigIntegerGmp> BigInteger;
 	#else
@@ -33,6 +33,8 @@ limitations under the License.
 #include <iostream>
 #include <string>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace SeComLib {
 namespace Core {
@@ -41,7 +43,10 @@ namespace Core {
 
 	@tparam T_Impl The big integer library wrapper
 
-	@todo It would be nice to enable move semantics for this class. Even better, it should be replaced with boost::multiprecision: http://www.boost.org/doc/libs/1_53_0/libs/multiprecision/doc/html/boost_multiprecision/intro.html
+	Move construction and move assignment swap the underlying implementation-defined data, so temporaries returned by the operators below are never deep-copied.
+	The binary non-member operators taking an rvalue left hand side operand reuse its storage for the result.
+
+	@todo It should be replaced with boost::multiprecision: http://www.boost.org/doc/libs/1_53_0/libs/multiprecision/doc/html/boost_multiprecision/intro.html
 	*/
 	template <typename T_Impl>
 	class BigIntegerBase {
@@ -60,6 +65,9 @@ namespace Core {
 		/// Copy constructor
 		BigIntegerBase (const BigIntegerBase<T_Impl> &input);
 
+		/// Move constructor
+		BigIntegerBase (BigIntegerBase<T_Impl> &&input) noexcept;
+
 		/// Initialize current instance with a long value
 		BigIntegerBase (const long input);
 
@@ -90,6 +98,8 @@ namespace Core {
 
 		/// BigIntegerBase assignment operator
 		BigIntegerBase<T_Impl> &operator= (const BigIntegerBase<T_Impl> &input);
+		/// BigIntegerBase move assignment operator
+		BigIntegerBase<T_Impl> &operator= (BigIntegerBase<T_Impl> &&input) noexcept;
 		/// long assignment operator
 		BigIntegerBase<T_Impl> &operator= (const long input);
 		/// unsigned long assignment operator
@@ -382,6 +392,15 @@ namespace Core {
 		/// Computes the inverse modulo n
 		BigIntegerBase<T_Impl> GetInverseModN (const BigIntegerBase<T_Impl> &n) const;
 
+		/// Adds input to the current instance modulo n
+		BigIntegerBase<T_Impl> &AddModN (const BigIntegerBase<T_Impl> &input, const BigIntegerBase<T_Impl> &n);
+
+		/// Subtracts input from the current instance modulo n
+		BigIntegerBase<T_Impl> &SubtractModN (const BigIntegerBase<T_Impl> &input, const BigIntegerBase<T_Impl> &n);
+
+		/// Multiplies the current instance with input modulo n
+		BigIntegerBase<T_Impl> &MultiplyModN (const BigIntegerBase<T_Impl> &input, const BigIntegerBase<T_Impl> &n);
+
 		/* /Utility methods */
 		
 		/* Static utility methods */
@@ -395,6 +414,36 @@ namespace Core {
 		/// Computes the least common multiple of lhs and rhs
 		static BigIntegerBase<T_Impl> Lcm (const BigIntegerBase<T_Impl> &lhs, const BigIntegerBase<T_Impl> &rhs);
 
+		/// Computes @f$ lhs \cdot rhs \pmod n @f$ into output
+		static void MulModN (BigIntegerBase<T_Impl> &output, const BigIntegerBase<T_Impl> &lhs, const BigIntegerBase<T_Impl> &rhs, const BigIntegerBase<T_Impl> &n);
+
+		/// Computes @f$ input^2 \pmod n @f$ into output
+		static void SquareModN (BigIntegerBase<T_Impl> &output, const BigIntegerBase<T_Impl> &input, const BigIntegerBase<T_Impl> &n);
+
+		/// Computes @f$ multiplier \cdot base^{power} \pmod n @f$ into output
+		static void PowMulModN (BigIntegerBase<T_Impl> &output, const BigIntegerBase<T_Impl> &multiplier, const BigIntegerBase<T_Impl> &base, const BigIntegerBase<T_Impl> &power, const BigIntegerBase<T_Impl> &n);
+
+		/// Computes @f$ lhs \cdot rhs + addend \pmod n @f$ into output
+		static void MulAddModN (BigIntegerBase<T_Impl> &output, const BigIntegerBase<T_Impl> &lhs, const BigIntegerBase<T_Impl> &rhs, const BigIntegerBase<T_Impl> &addend, const BigIntegerBase<T_Impl> &n);
+
+		/// Computes @f$ \prod_i bases_i^{exponents_i} \pmod n @f$ (simultaneous multi-exponentiation)
+		static BigIntegerBase<T_Impl> MultiPowModN (const std::vector<BigIntegerBase<T_Impl>> &bases, const std::vector<BigIntegerBase<T_Impl>> &exponents, const BigIntegerBase<T_Impl> &n);
+
+		/// Computes @f$ \prod_i bases_i^{exponents_i} \pmod n @f$ (simultaneous multi-exponentiation, without copying the operands)
+		static BigIntegerBase<T_Impl> MultiPowModN (const std::vector<const BigIntegerBase<T_Impl> *> &bases, const std::vector<const BigIntegerBase<T_Impl> *> &exponents, const BigIntegerBase<T_Impl> &n);
+
+		/// Computes @f$ inputs_i^{-1} \pmod n @f$ for all the inputs with a single modular inversion (simultaneous inversion)
+		static std::vector<BigIntegerBase<T_Impl>> BatchInverseModN (const std::vector<BigIntegerBase<T_Impl>> &inputs, const BigIntegerBase<T_Impl> &n);
+
+		/// Computes @f$ inputs_i^{-1} \pmod n @f$ for all the inputs with a single modular inversion (simultaneous inversion, without copying the operands)
+		static std::vector<BigIntegerBase<T_Impl>> BatchInverseModN (const std::vector<const BigIntegerBase<T_Impl> *> &inputs, const BigIntegerBase<T_Impl> &n);
+
+		/// Computes @f$ lhs_i \cdot rhs_i \pmod n @f$ for all the operand pairs (vectorized when the implementation supports it)
+		static std::vector<BigIntegerBase<T_Impl>> BatchMulModN (const std::vector<const BigIntegerBase<T_Impl> *> &lhs, const std::vector<const BigIntegerBase<T_Impl> *> &rhs, const BigIntegerBase<T_Impl> &n);
+
+		/// Computes @f$ bases_i^{exponents_i} \pmod n @f$ for all the bases (vectorized when the implementation supports it)
+		static std::vector<BigIntegerBase<T_Impl>> BatchPowModN (const std::vector<const BigIntegerBase<T_Impl> *> &bases, const std::vector<const BigIntegerBase<T_Impl> *> &exponents, const BigIntegerBase<T_Impl> &n);
+
 		/* /Static utility methods */
 
 		/* Conversion methods */
@@ -405,6 +454,15 @@ namespace Core {
 		/// Convert to unsigned long
 		unsigned long ToUnsignedLong () const;
 
+		/// Gets the number of bytes required to export the integer
+		size_t GetByteSize () const;
+
+		/// Export to a fixed-width, little-endian binary buffer
+		void Export (unsigned char *buffer, const size_t byteCount) const;
+
+		/// Import from a fixed-width, little-endian binary buffer
+		BigIntegerBase<T_Impl> &Import (const unsigned char *buffer, const size_t byteCount);
+
 		/* /Conversion methods */
 
 	private:
@@ -412,6 +470,30 @@ namespace Core {
 		typename T_Impl::BigIntegerType data;
 	};
 
+	/* Rvalue non-member operators */
+
+	/// Unary negation operator which reuses the storage of input
+	template <typename T_Impl>
+	BigIntegerBase<T_Impl> operator- (BigIntegerBase<T_Impl> &&input);
+
+	/// BigIntegerBase addition binary operator which reuses the storage of lhs
+	template <typename T_Impl>
+	BigIntegerBase<T_Impl> operator+ (BigIntegerBase<T_Impl> &&lhs, const BigIntegerBase<T_Impl> &rhs);
+	/// BigIntegerBase subtraction binary operator which reuses the storage of lhs
+	template <typename T_Impl>
+	BigIntegerBase<T_Impl> operator- (BigIntegerBase<T_Impl> &&lhs, const BigIntegerBase<T_Impl> &rhs);
+	/// BigIntegerBase multiplication binary operator which reuses the storage of lhs
+	template <typename T_Impl>
+	BigIntegerBase<T_Impl> operator* (BigIntegerBase<T_Impl> &&lhs, const BigIntegerBase<T_Impl> &rhs);
+	/// BigIntegerBase division binary operator which reuses the storage of lhs
+	template <typename T_Impl>
+	BigIntegerBase<T_Impl> operator/ (BigIntegerBase<T_Impl> &&lhs, const BigIntegerBase<T_Impl> &rhs);
+	/// BigIntegerBase modulus binary operator which reuses the storage of lhs
+	template <typename T_Impl>
+	BigIntegerBase<T_Impl> operator% (BigIntegerBase<T_Impl> &&lhs, const BigIntegerBase<T_Impl> &rhs);
+
+	/* /Rvalue non-member operators */
+
 	/* Binary non-member operators */
 
 	/// long addition binary operator
@@ -50,6 +50,17 @@ namespace Core {
 		T_Impl::Initialize(*this, input);
 	}
 
+	/**
+	Takes over the underlying data of input, which is left holding 0.
+
+	@param input BigIntegerBase rvalue reference
+	*/
+	template <typename T_Impl>
+	inline BigIntegerBase<T_Impl>::BigIntegerBase (BigIntegerBase<T_Impl> &&input) noexcept {
+		T_Impl::Initialize(*this);
+		T_Impl::Swap(*this, input);
+	}
+
 	/**
 	@param input long value
 	*/
@@ -137,6 +148,18 @@ namespace Core {
 		return *this;
 	}
 
+	/**
+	Swaps the underlying data, so the previous value of the current instance is released when input is destroyed.
+
+	@param input BigIntegerBase rvalue reference
+	@return A reference to the current instance.
+	*/
+	template <typename T_Impl>
+	inline BigIntegerBase<T_Impl> &BigIntegerBase<T_Impl>::operator= (BigIntegerBase<T_Impl> &&input) noexcept {
+		T_Impl::Swap(*this, input);
+		return *this;
+	}
+
 	/**
 	@param input long value
 	@return A reference to the current instance.
@@ -1551,6 +1574,41 @@ namespace Core {
 		return output;
 	}
 
+	/**
+	@param input the addend
+	@param n the modulus
+	@return A reference to the current instance, containing @f$ (this + input) \pmod n @f$.
+	*/
+	template <typename T_Impl>
+	inline BigIntegerBase<T_Impl> &BigIntegerBase<T_Impl>::AddModN (const BigIntegerBase<T_Impl> &input, const BigIntegerBase<T_Impl> &n) {
+		T_Impl::Add(*this, *this, input);
+		T_Impl::Modulo(*this, *this, n);
+		return *this;
+	}
+
+	/**
+	@param input the subtrahend
+	@param n the modulus
+	@return A reference to the current instance, containing @f$ (this - input) \pmod n @f$.
+	*/
+	template <typename T_Impl>
+	inline BigIntegerBase<T_Impl> &BigIntegerBase<T_Impl>::SubtractModN (const BigIntegerBase<T_Impl> &input, const BigIntegerBase<T_Impl> &n) {
+		T_Impl::Subtract(*this, *this, input);
+		T_Impl::Modulo(*this, *this, n);
+		return *this;
+	}
+
+	/**
+	@param input the multiplier
+	@param n the modulus
+	@return A reference to the current instance, containing @f$ this \cdot input \pmod n @f$.
+	*/
+	template <typename T_Impl>
+	inline BigIntegerBase<T_Impl> &BigIntegerBase<T_Impl>::MultiplyModN (const BigIntegerBase<T_Impl> &input, const BigIntegerBase<T_Impl> &n) {
+		T_Impl::MulModN(*this, *this, input, n);
+		return *this;
+	}
+
 	/* /Utility methods */
 
 	/* Static utility methods */
@@ -1592,6 +1650,185 @@ namespace Core {
 		return output;
 	}
 
+	/**
+	Fused multiplication and reduction, which avoids allocating a new instance for the double-width product.
+	Any of the operands may be the same instance as output.
+
+	@param output receives the result
+	@param lhs left hand side operand
+	@param rhs right hand side operand
+	@param n the modulus
+	*/
+	template <typename T_Impl>
+	void BigIntegerBase<T_Impl>::MulModN (BigIntegerBase<T_Impl> &output, const BigIntegerBase<T_Impl> &lhs, const BigIntegerBase<T_Impl> &rhs, const BigIntegerBase<T_Impl> &n) {
+		T_Impl::MulModN(output, lhs, rhs, n);
+	}
+
+	/**
+	@param output receives the result
+	@param input the operand
+	@param n the modulus
+	*/
+	template <typename T_Impl>
+	void BigIntegerBase<T_Impl>::SquareModN (BigIntegerBase<T_Impl> &output, const BigIntegerBase<T_Impl> &input, const BigIntegerBase<T_Impl> &n) {
+		T_Impl::SquareModN(output, input, n);
+	}
+
+	/**
+	Typical use: homomorphic scalar multiplication followed by an addition, @f$ [a + b \cdot e] = [a] [b]^e @f$.
+	Any of the operands may be the same instance as output.
+
+	@param output receives the result
+	@param multiplier the multiplier
+	@param base the base
+	@param power the exponent
+	@param n the modulus
+	*/
+	template <typename T_Impl>
+	void BigIntegerBase<T_Impl>::PowMulModN (BigIntegerBase<T_Impl> &output, const BigIntegerBase<T_Impl> &multiplier, const BigIntegerBase<T_Impl> &base, const BigIntegerBase<T_Impl> &power, const BigIntegerBase<T_Impl> &n) {
+		T_Impl::PowMulModN(output, multiplier, base, power, n);
+	}
+
+	/**
+	Typical use: CRT recombination, @f$ x = x_p \cdot q (q^{-1} \bmod p) + x_q \cdot p (p^{-1} \bmod q) \pmod n @f$.
+	Any of the operands may be the same instance as output.
+
+	@param output receives the result
+	@param lhs left hand side operand
+	@param rhs right hand side operand
+	@param addend the term added to the product
+	@param n the modulus
+	*/
+	template <typename T_Impl>
+	void BigIntegerBase<T_Impl>::MulAddModN (BigIntegerBase<T_Impl> &output, const BigIntegerBase<T_Impl> &lhs, const BigIntegerBase<T_Impl> &rhs, const BigIntegerBase<T_Impl> &addend, const BigIntegerBase<T_Impl> &n) {
+		T_Impl::MulAddModN(output, lhs, rhs, addend, n);
+	}
+
+	/**
+	Typical use: homomorphic dot product, @f$ [\sum_i x_i \cdot s_i] = \prod_i [x_i]^{s_i} @f$.
+
+	@param bases the bases
+	@param exponents the exponents (same size as bases)
+	@param n the modulus
+	@return @f$ \prod_i bases_i^{exponents_i} \pmod n @f$
+	*/
+	template <typename T_Impl>
+	BigIntegerBase<T_Impl> BigIntegerBase<T_Impl>::MultiPowModN (const std::vector<BigIntegerBase<T_Impl>> &bases, const std::vector<BigIntegerBase<T_Impl>> &exponents, const BigIntegerBase<T_Impl> &n) {
+		std::vector<const BigIntegerBase<T_Impl> *> basePointers;
+		basePointers.reserve(bases.size());
+		for (typename std::vector<BigIntegerBase<T_Impl>>::const_iterator iterator = bases.begin(); iterator != bases.end(); ++iterator) {
+			basePointers.push_back(&(*iterator));
+		}
+
+		std::vector<const BigIntegerBase<T_Impl> *> exponentPointers;
+		exponentPointers.reserve(exponents.size());
+		for (typename std::vector<BigIntegerBase<T_Impl>>::const_iterator iterator = exponents.begin(); iterator != exponents.end(); ++iterator) {
+			exponentPointers.push_back(&(*iterator));
+		}
+
+		return BigIntegerBase<T_Impl>::MultiPowModN(basePointers, exponentPointers, n);
+	}
+
+	/**
+	@param bases pointers to the bases
+	@param exponents pointers to the exponents (same size as bases)
+	@param n the modulus
+	@return @f$ \prod_i bases_i^{exponents_i} \pmod n @f$
+	*/
+	template <typename T_Impl>
+	BigIntegerBase<T_Impl> BigIntegerBase<T_Impl>::MultiPowModN (const std::vector<const BigIntegerBase<T_Impl> *> &bases, const std::vector<const BigIntegerBase<T_Impl> *> &exponents, const BigIntegerBase<T_Impl> &n) {
+		BigIntegerBase<T_Impl> output;
+		T_Impl::MultiPowModN(output, bases, exponents, n);
+
+		return output;
+	}
+
+	/**
+	Typical use: homomorphic negation and subtraction of many ciphertexts, @f$ [-x_i] = [x_i]^{-1} @f$.
+
+	@param inputs the values to invert
+	@param n the modulus
+	@return A vector containing @f$ inputs_i^{-1} \pmod n @f$
+	@throws std::runtime_error the inverse of (at least) one of the inputs does not exist.
+	*/
+	template <typename T_Impl>
+	std::vector<BigIntegerBase<T_Impl>> BigIntegerBase<T_Impl>::BatchInverseModN (const std::vector<BigIntegerBase<T_Impl>> &inputs, const BigIntegerBase<T_Impl> &n) {
+		std::vector<const BigIntegerBase<T_Impl> *> inputPointers;
+		inputPointers.reserve(inputs.size());
+		for (typename std::vector<BigIntegerBase<T_Impl>>::const_iterator iterator = inputs.begin(); iterator != inputs.end(); ++iterator) {
+			inputPointers.push_back(&(*iterator));
+		}
+
+		return BigIntegerBase<T_Impl>::BatchInverseModN(inputPointers, n);
+	}
+
+	/**
+	Montgomery's trick: computes the prefix products @f$ p_i = \prod_{j \leq i} inputs_j \pmod n @f$, inverts @f$ p_{k - 1} @f$ and then walks back, using @f$ inputs_i^{-1} = p_i^{-1} p_{i - 1} @f$ and @f$ p_{i - 1}^{-1} = p_i^{-1} inputs_i @f$.
+	This requires a single modular inversion and @f$ 3 (k - 1) @f$ modular multiplications for @f$ k @f$ inputs.
+
+	@param inputs pointers to the values to invert
+	@param n the modulus
+	@return A vector containing @f$ inputs_i^{-1} \pmod n @f$
+	@throws std::runtime_error the inverse of (at least) one of the inputs does not exist.
+	*/
+	template <typename T_Impl>
+	std::vector<BigIntegerBase<T_Impl>> BigIntegerBase<T_Impl>::BatchInverseModN (const std::vector<const BigIntegerBase<T_Impl> *> &inputs, const BigIntegerBase<T_Impl> &n) {
+		std::vector<BigIntegerBase<T_Impl>> output(inputs.size());
+		if (inputs.empty()) {
+			return output;
+		}
+
+		//store the prefix products in the output vector, which is overwritten with the inverses in the second pass
+		output[0] = *inputs[0] % n;
+		for (size_t i = 1; i < inputs.size(); ++i) {
+			T_Impl::MulModN(output[i], output[i - 1], *inputs[i], n);
+		}
+
+		BigIntegerBase<T_Impl> inverse = output.back().GetInverseModN(n);
+
+		for (size_t i = inputs.size() - 1; i > 0; --i) {
+			T_Impl::MulModN(output[i], inverse, output[i - 1], n);
+			T_Impl::MulModN(inverse, inverse, *inputs[i], n);
+		}
+		output[0] = std::move(inverse);
+
+		return output;
+	}
+
+	/**
+	Typical use: homomorphic addition of many ciphertext pairs, @f$ [x_i + y_i] = [x_i] \cdot [y_i] @f$.
+
+	@param lhs pointers to the left hand side operands
+	@param rhs pointers to the right hand side operands (same size as lhs)
+	@param n the modulus
+	@return A vector containing @f$ lhs_i \cdot rhs_i \pmod n @f$
+	@throws std::runtime_error the number of lhs operands differs from the number of rhs operands.
+	*/
+	template <typename T_Impl>
+	std::vector<BigIntegerBase<T_Impl>> BigIntegerBase<T_Impl>::BatchMulModN (const std::vector<const BigIntegerBase<T_Impl> *> &lhs, const std::vector<const BigIntegerBase<T_Impl> *> &rhs, const BigIntegerBase<T_Impl> &n) {
+		std::vector<BigIntegerBase<T_Impl>> output;
+		T_Impl::BatchMulModN(output, lhs, rhs, n);
+
+		return output;
+	}
+
+	/**
+	Typical use: homomorphic multiplication of many ciphertexts by scalars, @f$ [x_i \cdot s_i] = [x_i]^{s_i} @f$.
+
+	@param bases pointers to the bases
+	@param exponents pointers to the exponents (same size as bases)
+	@param n the modulus
+	@return A vector containing @f$ bases_i^{exponents_i} \pmod n @f$
+	@throws std::runtime_error the number of bases differs from the number of exponents.
+	*/
+	template <typename T_Impl>
+	std::vector<BigIntegerBase<T_Impl>> BigIntegerBase<T_Impl>::BatchPowModN (const std::vector<const BigIntegerBase<T_Impl> *> &bases, const std::vector<const BigIntegerBase<T_Impl> *> &exponents, const BigIntegerBase<T_Impl> &n) {
+		std::vector<BigIntegerBase<T_Impl>> output;
+		T_Impl::BatchPowModN(output, bases, exponents, n);
+
+		return output;
+	}
+
 	/* /Static utility methods */
 
 	/* Conversion methods */
@@ -1613,8 +1850,110 @@ namespace Core {
 		return T_Impl::ToUnsignedLong(*this);
 	}
 
+	/**
+	@return The number of bytes of the absolute value of the integer (at least 1).
+	*/
+	template <typename T_Impl>
+	inline size_t BigIntegerBase<T_Impl>::GetByteSize () const {
+		return (T_Impl::GetSize(*this, 2) + 7) / 8;
+	}
+
+	/**
+	Writes the integer into exactly byteCount bytes, least significant byte first, padded with zeros. No string conversion is involved.
+
+	@param buffer the destination (byteCount bytes)
+	@param byteCount the width of the exported integer
+	@throws std::runtime_error the integer is negative or it doesn't fit in byteCount bytes
+	*/
+	template <typename T_Impl>
+	inline void BigIntegerBase<T_Impl>::Export (unsigned char *buffer, const size_t byteCount) const {
+		T_Impl::Export(*this, buffer, byteCount);
+	}
+
+	/**
+	Reads byteCount bytes, least significant byte first, into the current instance, reusing its storage.
+
+	@param buffer the source (byteCount bytes)
+	@param byteCount the width of the imported integer
+	@return A reference to the current instance.
+	*/
+	template <typename T_Impl>
+	inline BigIntegerBase<T_Impl> &BigIntegerBase<T_Impl>::Import (const unsigned char *buffer, const size_t byteCount) {
+		T_Impl::Import(*this, buffer, byteCount);
+		return *this;
+	}
+
 	/* /Conversion methods */
 
+	/* Rvalue non-member operators */
+
+	/**
+	@param input BigIntegerBase rvalue reference
+	@return input, having the sign inverted.
+	*/
+	template <typename T_Impl>
+	inline BigIntegerBase<T_Impl> operator- (BigIntegerBase<T_Impl> &&input) {
+		T_Impl::InvertSign(input, input);
+		return std::move(input);
+	}
+
+	/**
+	@param lhs left hand side operand (rvalue reference)
+	@param rhs right hand side operand
+	@return lhs, overwritten with the sum.
+	*/
+	template <typename T_Impl>
+	inline BigIntegerBase<T_Impl> operator+ (BigIntegerBase<T_Impl> &&lhs, const BigIntegerBase<T_Impl> &rhs) {
+		T_Impl::Add(lhs, lhs, rhs);
+		return std::move(lhs);
+	}
+
+	/**
+	@param lhs left hand side operand (rvalue reference)
+	@param rhs right hand side operand
+	@return lhs, overwritten with the difference.
+	*/
+	template <typename T_Impl>
+	inline BigIntegerBase<T_Impl> operator- (BigIntegerBase<T_Impl> &&lhs, const BigIntegerBase<T_Impl> &rhs) {
+		T_Impl::Subtract(lhs, lhs, rhs);
+		return std::move(lhs);
+	}
+
+	/**
+	@param lhs left hand side operand (rvalue reference)
+	@param rhs right hand side operand
+	@return lhs, overwritten with the product.
+	*/
+	template <typename T_Impl>
+	inline BigIntegerBase<T_Impl> operator* (BigIntegerBase<T_Impl> &&lhs, const BigIntegerBase<T_Impl> &rhs) {
+		T_Impl::Multiply(lhs, lhs, rhs);
+		return std::move(lhs);
+	}
+
+	/**
+	@param lhs left hand side operand (rvalue reference)
+	@param rhs right hand side operand
+	@return lhs, overwritten with the quotient.
+	*/
+	template <typename T_Impl>
+	inline BigIntegerBase<T_Impl> operator/ (BigIntegerBase<T_Impl> &&lhs, const BigIntegerBase<T_Impl> &rhs) {
+		T_Impl::Divide(lhs, lhs, rhs);
+		return std::move(lhs);
+	}
+
+	/**
+	@param lhs left hand side operand (rvalue reference)
+	@param rhs right hand side operand
+	@return lhs, overwritten with the remainder.
+	*/
+	template <typename T_Impl>
+	inline BigIntegerBase<T_Impl> operator% (BigIntegerBase<T_Impl> &&lhs, const BigIntegerBase<T_Impl> &rhs) {
+		T_Impl::Modulo(lhs, lhs, rhs);
+		return std::move(lhs);
+	}
+
+	/* /Rvalue non-member operators */
+
 	/* Binary non-member operators */
 
 	/**
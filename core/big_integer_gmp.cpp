@@ -27,6 +27,11 @@ limitations under the License.
 */
 
 #include "big_integer_gmp.h"
+#include "batch_montgomery.h"
+
+#if defined(LIB_GMP_MONTGOMERY)
+	#include "montgomery_context.h"
+#endif
 
 namespace SeComLib {
 namespace Core {
@@ -692,6 +697,8 @@ namespace Core {
 
 	Should we use mpz_powm_sec instead, in order to prevent side-channel attacks?
 
+	When built with LIB_GMP_MONTGOMERY, non-negative powers modulo odd n are computed by MontgomeryContext::PowModN instead.
+
 	@param output BigInteger instance
 	@param input BigInteger instance containing the original data
 	@param power the exponent
@@ -700,6 +707,13 @@ namespace Core {
 	@throws Division by zero if the power is negative and an inverse doesn't exist.
 	*/
 	void BigIntegerGmp::PowModN (BigIntegerBase<BigIntegerGmp> &output, const BigIntegerBase<BigIntegerGmp> &input, const BigIntegerBase<BigIntegerGmp> &power, const BigIntegerBase<BigIntegerGmp> &n) {
+	#if defined(LIB_GMP_MONTGOMERY)
+		if (mpz_sgn(power.data) >= 0 && MontgomeryContext::IsSupported(n.data)) {
+			MontgomeryContext::GetInstance(n.data).PowModN(output.data, input.data, power.data);
+			return;
+		}
+	#endif
+
 		mpz_powm(output.data, input.data, power.data, n.data);
 	}
 	
@@ -774,6 +788,287 @@ namespace Core {
 		}
 	}
 
+	/**
+	Calls the GMP mpz_mul and mpz_mod functions, using output as the double-width intermediate, so no temporaries are allocated once output has grown to twice the size of n.
+
+	GMP allows lhs and rhs to overlap with output. If output overlaps with n, the result is computed in a temporary.
+
+	@param output BigInteger instance
+	@param lhs left hand side BigInteger operand
+	@param rhs right hand side BigInteger operand
+	@param n the modulus
+	*/
+	void BigIntegerGmp::MulModN (BigIntegerBase<BigIntegerGmp> &output, const BigIntegerBase<BigIntegerGmp> &lhs, const BigIntegerBase<BigIntegerGmp> &rhs, const BigIntegerBase<BigIntegerGmp> &n) {
+		if (&output == &n) {
+			BigIntegerBase<BigIntegerGmp> temp;
+			BigIntegerGmp::MulModN(temp, lhs, rhs, n);
+			mpz_swap(output.data, temp.data);
+			return;
+		}
+
+		mpz_mul(output.data, lhs.data, rhs.data);
+		mpz_mod(output.data, output.data, n.data);
+	}
+
+	/**
+	Calls the GMP mpz_mul function with identical operands (which GMP detects and computes as a squaring) followed by mpz_mod.
+
+	@param output BigInteger instance
+	@param input BigInteger instance containing the original data
+	@param n the modulus
+	*/
+	void BigIntegerGmp::SquareModN (BigIntegerBase<BigIntegerGmp> &output, const BigIntegerBase<BigIntegerGmp> &input, const BigIntegerBase<BigIntegerGmp> &n) {
+		BigIntegerGmp::MulModN(output, input, input, n);
+	}
+
+	/**
+	Computes @f$ multiplier \cdot base^{power} \pmod n @f$ using the GMP mpz_powm, mpz_mul and mpz_mod functions.
+
+	The exponentiation is performed directly in output, so a temporary is only required when output overlaps with multiplier or n.
+	When built with LIB_GMP_MONTGOMERY, non-negative powers modulo odd n are computed by MontgomeryContext::PowMulModN instead.
+
+	@param output BigInteger instance
+	@param multiplier the multiplier
+	@param base the base
+	@param power the exponent
+	@param n the modulus
+	@throws Division by zero if the power is negative and an inverse doesn't exist.
+	*/
+	void BigIntegerGmp::PowMulModN (BigIntegerBase<BigIntegerGmp> &output, const BigIntegerBase<BigIntegerGmp> &multiplier, const BigIntegerBase<BigIntegerGmp> &base, const BigIntegerBase<BigIntegerGmp> &power, const BigIntegerBase<BigIntegerGmp> &n) {
+		if (&output == &multiplier || &output == &n) {
+			BigIntegerBase<BigIntegerGmp> temp;
+			BigIntegerGmp::PowMulModN(temp, multiplier, base, power, n);
+			mpz_swap(output.data, temp.data);
+			return;
+		}
+
+	#if defined(LIB_GMP_MONTGOMERY)
+		if (mpz_sgn(power.data) >= 0 && MontgomeryContext::IsSupported(n.data)) {
+			//handles overlapping operands by itself
+			MontgomeryContext::GetInstance(n.data).PowMulModN(output.data, multiplier.data, base.data, power.data);
+			return;
+		}
+	#endif
+
+		mpz_powm(output.data, base.data, power.data, n.data);
+		mpz_mul(output.data, output.data, multiplier.data);
+		mpz_mod(output.data, output.data, n.data);
+	}
+
+	/**
+	Computes @f$ lhs \cdot rhs + addend \pmod n @f$ using the GMP mpz_mul / mpz_addmul, mpz_add and mpz_mod functions.
+
+	If output overlaps with addend, mpz_addmul accumulates the product directly into it.
+
+	@param output BigInteger instance
+	@param lhs left hand side BigInteger operand
+	@param rhs right hand side BigInteger operand
+	@param addend the term added to the product
+	@param n the modulus
+	*/
+	void BigIntegerGmp::MulAddModN (BigIntegerBase<BigIntegerGmp> &output, const BigIntegerBase<BigIntegerGmp> &lhs, const BigIntegerBase<BigIntegerGmp> &rhs, const BigIntegerBase<BigIntegerGmp> &addend, const BigIntegerBase<BigIntegerGmp> &n) {
+		if (&output == &n) {
+			BigIntegerBase<BigIntegerGmp> temp;
+			BigIntegerGmp::MulAddModN(temp, lhs, rhs, addend, n);
+			mpz_swap(output.data, temp.data);
+			return;
+		}
+
+		if (&output == &addend) {
+			mpz_addmul(output.data, lhs.data, rhs.data);
+		}
+		else {
+			mpz_mul(output.data, lhs.data, rhs.data);
+			mpz_add(output.data, output.data, addend.data);
+		}
+		mpz_mod(output.data, output.data, n.data);
+	}
+
+	/**
+	Computes @f$ \prod_i bases_i^{exponents_i} \pmod n @f$ using Straus' simultaneous exponentiation (interleaved fixed windows).
+
+	A table containing @f$ bases_i^j, 1 \leq j < 2^w @f$ is computed for every term, after which all the exponents are scanned together, from the most significant window down.
+	This way, the squarings are shared by all the terms: @f$ \max_i size(exponents_i) @f$ squarings are required instead of @f$ \sum_i size(exponents_i) @f$.
+	The window size, @f$ w @f$, minimizes the total number of multiplications (table and accumulation) for the given number of terms and exponent size.
+
+	Negative exponents use the inverse of the base. Terms with a 0 exponent are skipped. Output may be the same instance as any of the inputs.
+
+	@param output BigInteger instance
+	@param bases the bases
+	@param exponents the exponents
+	@param n the modulus
+	@throws std::runtime_error the number of bases differs from the number of exponents.
+	@throws std::runtime_error a base with a negative exponent is not invertible modulo n.
+	*/
+	void BigIntegerGmp::MultiPowModN (BigIntegerBase<BigIntegerGmp> &output, const std::vector<const BigIntegerBase<BigIntegerGmp> *> &bases, const std::vector<const BigIntegerBase<BigIntegerGmp> *> &exponents, const BigIntegerBase<BigIntegerGmp> &n) {
+		if (bases.size() != exponents.size()) {
+			throw std::runtime_error("The number of bases must be equal to the number of exponents.");
+		}
+
+		//the indexes of the terms with non-zero exponents
+		std::vector<size_t> terms;
+		size_t maxBitCount = 0;
+		for (size_t i = 0; i < bases.size(); ++i) {
+			if (mpz_sgn(exponents[i]->data) != 0) {
+				terms.push_back(i);
+				maxBitCount = std::max(maxBitCount, mpz_sizeinbase(exponents[i]->data, 2));
+			}
+		}
+
+		//the window size is capped in order to keep the tables reasonably small
+		const size_t maxWindowSize = 6;
+		size_t windowSize = 1;
+		size_t minCost = maxBitCount;
+		for (size_t i = 2; i <= maxWindowSize; ++i) {
+			size_t cost = (static_cast<size_t>(1) << i) - 2 + (maxBitCount + i - 1) / i;
+			if (cost < minCost) {
+				minCost = cost;
+				windowSize = i;
+			}
+		}
+
+		//table[term * tableSize + j] = base^(j + 1) (negative exponents use the inverse of the base)
+		size_t tableSize = (static_cast<size_t>(1) << windowSize) - 1;
+		std::vector<BigIntegerBase<BigIntegerGmp>> table(terms.size() * tableSize);
+		//the absolute values of the exponents (mpz_tstbit uses the two's complement for negative values)
+		std::vector<BigIntegerBase<BigIntegerGmp>> absoluteExponents(terms.size());
+
+		for (size_t term = 0; term < terms.size(); ++term) {
+			BigIntegerBase<BigIntegerGmp> *powers = &table[term * tableSize];
+
+			if (mpz_sgn(exponents[terms[term]]->data) < 0) {
+				BigIntegerGmp::InvertModN(powers[0], *bases[terms[term]], n);
+			}
+			else {
+				mpz_mod(powers[0].data, bases[terms[term]]->data, n.data);
+			}
+
+			for (size_t j = 1; j < tableSize; ++j) {
+				BigIntegerGmp::MulModN(powers[j], powers[j - 1], powers[0], n);
+			}
+
+			mpz_abs(absoluteExponents[term].data, exponents[terms[term]]->data);
+		}
+
+		BigIntegerBase<BigIntegerGmp> result;
+		bool resultInitialized = false;
+
+		for (size_t window = (maxBitCount + windowSize - 1) / windowSize; window > 0; --window) {
+			if (resultInitialized) {
+				for (size_t i = 0; i < windowSize; ++i) {
+					BigIntegerGmp::SquareModN(result, result, n);
+				}
+			}
+
+			mp_bitcnt_t lowestBit = static_cast<mp_bitcnt_t>((window - 1) * windowSize);
+
+			for (size_t term = 0; term < terms.size(); ++term) {
+				size_t value = 0;
+				for (size_t bit = windowSize; bit > 0; --bit) {
+					value = (value << 1) | static_cast<size_t>(mpz_tstbit(absoluteExponents[term].data, lowestBit + bit - 1));
+				}
+
+				if (value != 0) {
+					if (resultInitialized) {
+						BigIntegerGmp::MulModN(result, result, table[term * tableSize + value - 1], n);
+					}
+					else {
+						//the first non-zero window initializes the result, so the leading squarings of 1 are skipped
+						mpz_set(result.data, table[term * tableSize + value - 1].data);
+						resultInitialized = true;
+					}
+				}
+			}
+		}
+
+		//the empty product
+		if (!resultInitialized) {
+			mpz_set_ui(result.data, 1);
+			mpz_mod(result.data, result.data, n.data);
+		}
+
+		mpz_swap(output.data, result.data);
+	}
+
+	/**
+	When the CPU supports AVX-512 IFMA, batches of at least BATCH_MONTGOMERY_MIN_MULTIPLICATION_COUNT products modulo odd n
+	(between BATCH_MONTGOMERY_MIN_MULTIPLICATION_MODULUS_SIZE and BATCH_MONTGOMERY_MAX_MODULUS_SIZE bits) are computed by BatchMontgomery::MulModN,
+	BATCH_MONTGOMERY_LANE_COUNT at a time. Otherwise, BigIntegerGmp::MulModN is called for each pair of operands.
+
+	@param output receives the results (resized to the number of operands; must not contain any of the inputs)
+	@param lhs the left hand side operands
+	@param rhs the right hand side operands (same size as lhs)
+	@param n the modulus
+	@throws std::runtime_error the number of lhs operands differs from the number of rhs operands.
+	*/
+	void BigIntegerGmp::BatchMulModN (std::vector<BigIntegerBase<BigIntegerGmp>> &output, const std::vector<const BigIntegerBase<BigIntegerGmp> *> &lhs, const std::vector<const BigIntegerBase<BigIntegerGmp> *> &rhs, const BigIntegerBase<BigIntegerGmp> &n) {
+		if (lhs.size() != rhs.size()) {
+			throw std::runtime_error("The number of lhs operands must be equal to the number of rhs operands.");
+		}
+
+		output.resize(lhs.size());
+
+		if (lhs.size() >= BATCH_MONTGOMERY_MIN_MULTIPLICATION_COUNT && mpz_sizeinbase(n.data, 2) >= BATCH_MONTGOMERY_MIN_MULTIPLICATION_MODULUS_SIZE && BatchMontgomery::IsAvailable() && BatchMontgomery::IsSupported(n.data)) {
+			std::vector<mpz_ptr> outputData(lhs.size());
+			std::vector<mpz_srcptr> lhsData(lhs.size());
+			std::vector<mpz_srcptr> rhsData(rhs.size());
+			for (size_t i = 0; i < lhs.size(); ++i) {
+				outputData[i] = output[i].data;
+				lhsData[i] = lhs[i]->data;
+				rhsData[i] = rhs[i]->data;
+			}
+
+			BatchMontgomery::GetInstance(n.data).MulModN(&outputData[0], &lhsData[0], &rhsData[0], lhs.size());
+			return;
+		}
+
+		for (size_t i = 0; i < lhs.size(); ++i) {
+			BigIntegerGmp::MulModN(output[i], *lhs[i], *rhs[i], n);
+		}
+	}
+
+	/**
+	When the CPU supports AVX-512 IFMA, batches of at least BATCH_MONTGOMERY_MIN_EXPONENTIATION_COUNT exponentiations with non-negative exponents modulo odd n
+	(supported by BatchMontgomery::IsSupported) are computed by BatchMontgomery::PowModN, BATCH_MONTGOMERY_LANE_COUNT at a time.
+	Otherwise, BigIntegerGmp::PowModN is called for each base.
+
+	@param output receives the results (resized to the number of bases; must not contain any of the inputs)
+	@param bases the bases
+	@param exponents the exponents (same size as bases)
+	@param n the modulus
+	@throws std::runtime_error the number of bases differs from the number of exponents.
+	*/
+	void BigIntegerGmp::BatchPowModN (std::vector<BigIntegerBase<BigIntegerGmp>> &output, const std::vector<const BigIntegerBase<BigIntegerGmp> *> &bases, const std::vector<const BigIntegerBase<BigIntegerGmp> *> &exponents, const BigIntegerBase<BigIntegerGmp> &n) {
+		if (bases.size() != exponents.size()) {
+			throw std::runtime_error("The number of bases must be equal to the number of exponents.");
+		}
+
+		output.resize(bases.size());
+
+		bool nonNegativeExponents = true;
+		for (size_t i = 0; i < exponents.size() && nonNegativeExponents; ++i) {
+			nonNegativeExponents = mpz_sgn(exponents[i]->data) >= 0;
+		}
+
+		if (nonNegativeExponents && bases.size() >= BATCH_MONTGOMERY_MIN_EXPONENTIATION_COUNT && BatchMontgomery::IsAvailable() && BatchMontgomery::IsSupported(n.data)) {
+			std::vector<mpz_ptr> outputData(bases.size());
+			std::vector<mpz_srcptr> baseData(bases.size());
+			std::vector<mpz_srcptr> exponentData(exponents.size());
+			for (size_t i = 0; i < bases.size(); ++i) {
+				outputData[i] = output[i].data;
+				baseData[i] = bases[i]->data;
+				exponentData[i] = exponents[i]->data;
+			}
+
+			BatchMontgomery::GetInstance(n.data).PowModN(&outputData[0], &baseData[0], &exponentData[0], bases.size());
+			return;
+		}
+
+		for (size_t i = 0; i < bases.size(); ++i) {
+			BigIntegerGmp::PowModN(output[i], *bases[i], *exponents[i], n);
+		}
+	}
+
 	/**
 	@param lhs left hand side BigInteger operand
 	@param rhs right hand side BigInteger operand
@@ -876,5 +1171,46 @@ namespace Core {
 		return mpz_get_ui(input.data);
 	}
 
+	/**
+	Calls the GMP mpz_export function. Whole limbs are exported when byteCount is a multiple of the limb size, which lets GMP copy the limbs directly on little-endian machines.
+
+	@param input BigInteger instance containing the original data
+	@param buffer the destination (byteCount bytes)
+	@param byteCount the width of the exported integer
+	@throws std::runtime_error input is negative or it doesn't fit in byteCount bytes
+	*/
+	void BigIntegerGmp::Export (const BigIntegerBase<BigIntegerGmp> &input, unsigned char *buffer, const size_t byteCount) {
+		if (mpz_sgn(input.data) < 0) {
+			throw std::runtime_error("Negative integers can't be exported.");
+		}
+
+		if ((mpz_sizeinbase(input.data, 2) + 7) / 8 > byteCount) {
+			throw std::runtime_error("The integer doesn't fit in the export buffer.");
+		}
+
+		size_t wordSize = 0 == byteCount % sizeof(mp_limb_t) ? sizeof(mp_limb_t) : 1;
+		size_t wordCount = 0;
+
+		//mpz_export writes nothing for 0
+		if (mpz_sgn(input.data) != 0) {
+			mpz_export(buffer, &wordCount, -1, wordSize, -1, 0, input.data);
+		}
+
+		std::memset(buffer + wordCount * wordSize, 0, byteCount - wordCount * wordSize);
+	}
+
+	/**
+	Calls the GMP mpz_import function (see BigIntegerGmp::Export).
+
+	@param output BigInteger instance which receives the imported data
+	@param buffer the source (byteCount bytes)
+	@param byteCount the width of the imported integer
+	*/
+	void BigIntegerGmp::Import (BigIntegerBase<BigIntegerGmp> &output, const unsigned char *buffer, const size_t byteCount) {
+		size_t wordSize = 0 == byteCount % sizeof(mp_limb_t) ? sizeof(mp_limb_t) : 1;
+
+		mpz_import(output.data, byteCount / wordSize, -1, wordSize, -1, 0, buffer);
+	}
+
 }//namespace Core
 }//namespace SeComLib
\ No newline at end of file
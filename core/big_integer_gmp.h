@@ -32,12 +32,16 @@ limitations under the License.
 #include "big_integer_base.h"
 
 //include C++ headers
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <stdexcept>
+#include <vector>
 
 //include 3rd party library headers
-#if defined(LIB_GMP)
+//LIB_GMP_MONTGOMERY uses GMP, with Montgomery exponentiation on fixed-width limb arrays (see MontgomeryContext)
+#if defined(LIB_GMP) || defined(LIB_GMP_MONTGOMERY)
 	#if defined(_WIN32)
 		#pragma warning(push)
 		#pragma warning(disable: 4127)//disable "warning C4127: conditional expression is constant"
@@ -201,6 +205,21 @@ namespace Core {
 		/// Inverts input modulo n
 		static void InvertModN (BigIntegerBase<BigIntegerGmp> &output, const BigIntegerBase<BigIntegerGmp> &input, const BigIntegerBase<BigIntegerGmp> &n);
 
+		/// Multiplies lhs with rhs modulo n
+		static void MulModN (BigIntegerBase<BigIntegerGmp> &output, const BigIntegerBase<BigIntegerGmp> &lhs, const BigIntegerBase<BigIntegerGmp> &rhs, const BigIntegerBase<BigIntegerGmp> &n);
+		/// Squares input modulo n
+		static void SquareModN (BigIntegerBase<BigIntegerGmp> &output, const BigIntegerBase<BigIntegerGmp> &input, const BigIntegerBase<BigIntegerGmp> &n);
+		/// Multiplies multiplier with base raised to the specified power modulo n
+		static void PowMulModN (BigIntegerBase<BigIntegerGmp> &output, const BigIntegerBase<BigIntegerGmp> &multiplier, const BigIntegerBase<BigIntegerGmp> &base, const BigIntegerBase<BigIntegerGmp> &power, const BigIntegerBase<BigIntegerGmp> &n);
+		/// Multiplies lhs with rhs and adds addend modulo n
+		static void MulAddModN (BigIntegerBase<BigIntegerGmp> &output, const BigIntegerBase<BigIntegerGmp> &lhs, const BigIntegerBase<BigIntegerGmp> &rhs, const BigIntegerBase<BigIntegerGmp> &addend, const BigIntegerBase<BigIntegerGmp> &n);
+		/// Computes the product of the bases raised to the exponents modulo n (simultaneous multi-exponentiation)
+		static void MultiPowModN (BigIntegerBase<BigIntegerGmp> &output, const std::vector<const BigIntegerBase<BigIntegerGmp> *> &bases, const std::vector<const BigIntegerBase<BigIntegerGmp> *> &exponents, const BigIntegerBase<BigIntegerGmp> &n);
+		/// Multiplies each lhs operand with the corresponding rhs operand modulo n (vectorized when possible)
+		static void BatchMulModN (std::vector<BigIntegerBase<BigIntegerGmp>> &output, const std::vector<const BigIntegerBase<BigIntegerGmp> *> &lhs, const std::vector<const BigIntegerBase<BigIntegerGmp> *> &rhs, const BigIntegerBase<BigIntegerGmp> &n);
+		/// Raises each base to the corresponding exponent modulo n (vectorized when possible)
+		static void BatchPowModN (std::vector<BigIntegerBase<BigIntegerGmp>> &output, const std::vector<const BigIntegerBase<BigIntegerGmp> *> &bases, const std::vector<const BigIntegerBase<BigIntegerGmp> *> &exponents, const BigIntegerBase<BigIntegerGmp> &n);
+
 		/// Swaps lhs with rhs efficiently
 		static void Swap (BigIntegerBase<BigIntegerGmp> &lhs, BigIntegerBase<BigIntegerGmp> &rhs);
 
@@ -213,6 +232,11 @@ namespace Core {
 		static std::string ToString (const BigIntegerBase<BigIntegerGmp> &input, const unsigned int base = 2);
 		/// Convert input to unsigned long
 		static unsigned long ToUnsignedLong (const BigIntegerBase<BigIntegerGmp> &input);
+
+		/// Export input to a fixed-width, little-endian binary buffer
+		static void Export (const BigIntegerBase<BigIntegerGmp> &input, unsigned char *buffer, const size_t byteCount);
+		/// Import output from a fixed-width, little-endian binary buffer
+		static void Import (BigIntegerBase<BigIntegerGmp> &output, const unsigned char *buffer, const size_t byteCount);
 	};
 
 
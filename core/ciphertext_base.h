@@ -34,6 +34,7 @@ limitations under the License.
 //include C++ headers
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 namespace SeComLib {
 namespace Core {
@@ -56,6 +57,9 @@ namespace Core {
 		/// Constructor with data and encryption modulus initialization
 		CiphertextBase (const BigInteger &data, const std::shared_ptr<BigInteger> &encryptionModulus);
 
+		/// Constructor with data (taken over) and encryption modulus initialization
+		CiphertextBase (BigInteger &&data, const std::shared_ptr<BigInteger> &encryptionModulus);
+
 		/// Homomorphic negation unary operator
 		T_CiphertextImpl operator- () const;
 
@@ -69,6 +73,21 @@ namespace Core {
 		template <typename T_DataType>
 		T_CiphertextImpl operator* (const T_DataType &input) const;
 
+		/// Returns the encryption modulus
+		const std::shared_ptr<BigInteger> &GetEncryptionModulus () const;
+
+		/// Returns the number of bytes of a serialized ciphertext
+		static size_t GetSerializedSize (const BigInteger &encryptionModulus);
+
+		/// Serializes a vector of ciphertexts into one contiguous buffer
+		static void Serialize (const std::vector<T_CiphertextImpl> &ciphertexts, std::vector<unsigned char> &buffer);
+
+		/// Deserializes a vector of ciphertexts from a contiguous buffer
+		static void Deserialize (const unsigned char *buffer, const size_t bufferSize, const std::shared_ptr<BigInteger> &encryptionModulus, std::vector<T_CiphertextImpl> &ciphertexts);
+
+		/// Deserializes a vector of ciphertexts from a contiguous buffer
+		static void Deserialize (const std::vector<unsigned char> &buffer, const std::shared_ptr<BigInteger> &encryptionModulus, std::vector<T_CiphertextImpl> &ciphertexts);
+
 	private:
 		/// The encryption modulus
 		std::shared_ptr<BigInteger> encryptionModulus;
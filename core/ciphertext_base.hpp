@@ -55,6 +55,15 @@ namespace Core {
 	CiphertextBase<T_CiphertextImpl>::CiphertextBase (const BigInteger &data, const std::shared_ptr<BigInteger> &encryptionModulus) : data(data), encryptionModulus(encryptionModulus) {
 	}
 
+	/**
+	Takes over the data (usually a temporary resulting from a homomorphic operation) and initializes the encryptionModulus
+	@param data the ciphertext data
+	@param encryptionModulus The encryption modulus
+	*/
+	template <typename T_CiphertextImpl>
+	CiphertextBase<T_CiphertextImpl>::CiphertextBase (BigInteger &&data, const std::shared_ptr<BigInteger> &encryptionModulus) : data(std::move(data)), encryptionModulus(encryptionModulus) {
+	}
+
 	/**
 	Computes @f$ [-this] = [this]^{-1} \pmod n @f$
 	@return A new instance containing @f$ [-this] @f$
@@ -81,7 +90,8 @@ namespace Core {
 			throw std::runtime_error("This operation requires the encryption modulus.");
 		}
 
-		T_CiphertextImpl output((this->data * input.data) % (*this->encryptionModulus), this->encryptionModulus);
+		T_CiphertextImpl output(this->encryptionModulus);
+		BigInteger::MulModN(output.data, this->data, input.data, *this->encryptionModulus);
 
 		return output;
 	}
@@ -97,7 +107,8 @@ namespace Core {
 			throw std::runtime_error("This operation requires the encryption modulus.");
 		}
 
-		T_CiphertextImpl output((this->data * input.data.GetInverseModN(*this->encryptionModulus)) % (*this->encryptionModulus), this->encryptionModulus);
+		T_CiphertextImpl output(input.data.GetInverseModN(*this->encryptionModulus), this->encryptionModulus);
+		BigInteger::MulModN(output.data, output.data, this->data, *this->encryptionModulus);
 
 		return output;
 	}
@@ -127,6 +138,92 @@ namespace Core {
 
 		return output;
 	}
+
+	/**
+	@return The (shared) encryption modulus, which can be passed to the constructors of new ciphertexts
+	*/
+	template <typename T_CiphertextImpl>
+	const std::shared_ptr<BigInteger> &CiphertextBase<T_CiphertextImpl>::GetEncryptionModulus () const {
+		return this->encryptionModulus;
+	}
+
+	/**
+	All ciphertexts are serialized with the same width, which is enough for any value @f$ < encryptionModulus @f$.
+
+	@param encryptionModulus the encryption modulus
+	@return The number of bytes of a serialized ciphertext
+	*/
+	template <typename T_CiphertextImpl>
+	size_t CiphertextBase<T_CiphertextImpl>::GetSerializedSize (const BigInteger &encryptionModulus) {
+		return encryptionModulus.GetByteSize();
+	}
+
+	/**
+	The ciphertexts are stored back to back, each one as a fixed-width, little-endian integer (see BigInteger::Export), without any header.
+	The width is given by the encryption modulus of the ciphertexts, so the reader only requires the encryption modulus to split the buffer.
+
+	@param ciphertexts the ciphertexts (all encrypted with the same modulus)
+	@param buffer receives the serialized ciphertexts (its previous contents are discarded)
+	@throws std::runtime_error the encryption modulus is not set or a ciphertext is larger than the encryption modulus
+	*/
+	template <typename T_CiphertextImpl>
+	void CiphertextBase<T_CiphertextImpl>::Serialize (const std::vector<T_CiphertextImpl> &ciphertexts, std::vector<unsigned char> &buffer) {
+		if (ciphertexts.empty()) {
+			buffer.clear();
+			return;
+		}
+
+		if (!ciphertexts.front().GetEncryptionModulus()) {
+			throw std::runtime_error("This operation requires the encryption modulus.");
+		}
+
+		size_t ciphertextSize = CiphertextBase<T_CiphertextImpl>::GetSerializedSize(*ciphertexts.front().GetEncryptionModulus());
+
+		buffer.resize(ciphertexts.size() * ciphertextSize);
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			ciphertexts[i].data.Export(&buffer[i * ciphertextSize], ciphertextSize);
+		}
+	}
+
+	/**
+	The ciphertexts are deserialized in place: the existing elements of the output vector are overwritten and reuse their storage,
+	so deserializing into the same vector repeatedly does not allocate memory once the vector has the right size.
+
+	@param buffer the serialized ciphertexts (see Serialize)
+	@param bufferSize the size of the buffer
+	@param encryptionModulus the encryption modulus of the ciphertexts
+	@param ciphertexts receives the ciphertexts (resized to the number of serialized ciphertexts)
+	@throws std::runtime_error the encryption modulus is not set or the size of the buffer is not a multiple of the ciphertext size
+	*/
+	template <typename T_CiphertextImpl>
+	void CiphertextBase<T_CiphertextImpl>::Deserialize (const unsigned char *buffer, const size_t bufferSize, const std::shared_ptr<BigInteger> &encryptionModulus, std::vector<T_CiphertextImpl> &ciphertexts) {
+		if (!encryptionModulus) {
+			throw std::runtime_error("This operation requires the encryption modulus.");
+		}
+
+		size_t ciphertextSize = CiphertextBase<T_CiphertextImpl>::GetSerializedSize(*encryptionModulus);
+
+		if (0 != bufferSize % ciphertextSize) {
+			throw std::runtime_error("The buffer size is not a multiple of the ciphertext size.");
+		}
+
+		ciphertexts.resize(bufferSize / ciphertextSize, T_CiphertextImpl(encryptionModulus));
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			ciphertexts[i].data.Import(buffer + i * ciphertextSize, ciphertextSize);
+			static_cast<CiphertextBase<T_CiphertextImpl> &>(ciphertexts[i]).encryptionModulus = encryptionModulus;
+		}
+	}
+
+	/**
+	@param buffer the serialized ciphertexts (see Serialize)
+	@param encryptionModulus the encryption modulus of the ciphertexts
+	@param ciphertexts receives the ciphertexts (resized to the number of serialized ciphertexts)
+	@throws std::runtime_error the size of the buffer is not a multiple of the ciphertext size
+	*/
+	template <typename T_CiphertextImpl>
+	void CiphertextBase<T_CiphertextImpl>::Deserialize (const std::vector<unsigned char> &buffer, const std::shared_ptr<BigInteger> &encryptionModulus, std::vector<T_CiphertextImpl> &ciphertexts) {
+		CiphertextBase<T_CiphertextImpl>::Deserialize(buffer.empty() ? NULL : &buffer[0], buffer.size(), encryptionModulus, ciphertexts);
+	}
 }//namespace Core
 }//namespace SeComLib
 
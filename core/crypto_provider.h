@@ -35,10 +35,13 @@ limitations under the License.
 #include "randomizer_container.h"
 #include "randomizer_base.h"
 #include "randomizer_cache.h"
+#include "precomputed_ciphertext.h"
+#include "worker_pool.h"
 
 //include C++ headers
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 namespace SeComLib {
 namespace Core {
@@ -62,6 +65,9 @@ namespace Core {
 		/// Provide public access to the T_Randomizer type
 		typedef T_Randomizer Randomizer;
 
+		/// Data type of the randomizer cache
+		typedef RandomizerCache<RandomizerContainer<CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>, RandomizerCacheParameters>> RandomizerCacheType;
+
 		/// Constructor
 		CryptoProvider (const unsigned int keyLength);
 
@@ -106,6 +112,36 @@ namespace Core {
 		T_Ciphertext HomomorphicMultiply (const T_Ciphertext &lhs, const BigInteger &rhs) const;
 	#endif
 
+		/// Compute the homomorphic dot product of a vector of ciphertexts and a vector of plaintext scalars
+		T_Ciphertext HomomorphicDotProduct (const std::vector<T_Ciphertext> &ciphertexts, const std::vector<BigInteger> &scalars) const;
+
+		/// Compute the homomorphic dot product of a vector of precomputed ciphertexts and a vector of plaintext scalars
+		T_Ciphertext HomomorphicDotProduct (const std::vector<PrecomputedCiphertext<T_Ciphertext>> &ciphertexts, const std::vector<BigInteger> &scalars) const;
+
+		/// Homomorphically negate a vector of ciphertexts with a single modular inversion
+		std::vector<T_Ciphertext> BatchNegate (const std::vector<T_Ciphertext> &ciphertexts) const;
+
+		/// Homomorphically subtract two vectors of ciphertexts (element by element) with a single modular inversion
+		std::vector<T_Ciphertext> BatchSubtract (const std::vector<T_Ciphertext> &lhs, const std::vector<T_Ciphertext> &rhs) const;
+
+		/// Homomorphically subtract each element of a vector of ciphertexts from the same ciphertext with a single modular inversion
+		std::vector<T_Ciphertext> BatchSubtract (const T_Ciphertext &lhs, const std::vector<T_Ciphertext> &rhs) const;
+
+		/// Homomorphically add two vectors of ciphertexts (element by element), vectorizing the modular multiplications when possible
+		std::vector<T_Ciphertext> BatchAdd (const std::vector<T_Ciphertext> &lhs, const std::vector<T_Ciphertext> &rhs) const;
+
+		/// Homomorphically multiply each ciphertext with the corresponding plaintext scalar, vectorizing the modular exponentiations when possible
+		std::vector<T_Ciphertext> BatchMultiply (const std::vector<T_Ciphertext> &ciphertexts, const std::vector<BigInteger> &scalars) const;
+
+		/// Encrypt a vector of plaintexts in parallel (on the WorkerPool)
+		std::vector<T_Ciphertext> EncryptBatch (const std::vector<BigInteger> &plaintexts) const;
+
+		/// Decrypt a vector of ciphertexts in parallel (on the WorkerPool)
+		std::vector<BigInteger> DecryptBatch (const std::vector<T_Ciphertext> &ciphertexts) const;
+
+		/// Re-randomize a vector of ciphertexts in parallel (on the WorkerPool)
+		std::vector<T_Ciphertext> RandomizeBatch (const std::vector<T_Ciphertext> &ciphertexts) const;
+
 		/// Returns the modulus required for reducing the encryption after randomization
 		const BigInteger &GetEncryptionModulus () const;
 
@@ -118,6 +154,9 @@ namespace Core {
 		/// Returns the message space bit size
 		virtual size_t GetMessageSpaceSize () const = 0;
 
+		/// Returns a string which identifies the public key
+		virtual std::string GetPublicKeyFingerprint () const = 0;
+
 		/// Public key getter
 		const T_PublicKey &GetPublicKey () const;
 
@@ -129,11 +168,11 @@ namespace Core {
 
 		/// Returns [1]
 		Ciphertext GetEncryptedOne (const bool randomized = true) const;
+
+		/// Returns the randomizer cache
+		RandomizerCacheType &GetRandomizerCache () const;
 		
 	protected:
-		/// Data type of the randomizer cache
-		typedef RandomizerCache<RandomizerContainer<CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>, RandomizerCacheParameters>> RandomizerCacheType;
-
 		/// Lazy loading randomizer cache
 		std::unique_ptr<RandomizerCacheType> randomizerCache;
 
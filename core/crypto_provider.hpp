@@ -122,6 +122,273 @@ namespace Core {
 	}
 #endif
 
+	/**
+	Computes @f$ [\sum_i ciphertexts_i \cdot scalars_i] = \prod_i [ciphertexts_i]^{scalars_i} \pmod n @f$ with a single simultaneous multi-exponentiation (see BigInteger::MultiPowModN),
+	which is considerably cheaper than accumulating the terms one by one for vectors of more than a few elements.
+
+	Unlike the homomorphic multiplication operator, 0 scalars are allowed (the corresponding terms are skipped). The output is not randomized.
+
+	Requires a ciphertext type exposing a single BigInteger data member (ElGamal provides its own implementation).
+
+	@param ciphertexts the encrypted vector
+	@param scalars the plaintext vector
+	@return A new instance containing @f$ [\sum_i ciphertexts_i \cdot scalars_i] @f$
+	@throws std::runtime_error the two vectors have different sizes
+	*/
+	template <typename T_PublicKey, typename T_PrivateKey, typename T_Ciphertext, typename T_Randomizer>
+	T_Ciphertext CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>::HomomorphicDotProduct (const std::vector<T_Ciphertext> &ciphertexts, const std::vector<BigInteger> &scalars) const {
+		if (ciphertexts.size() != scalars.size()) {
+			throw std::runtime_error("The number of ciphertexts must be equal to the number of scalars.");
+		}
+
+		std::vector<const BigInteger *> bases;
+		std::vector<const BigInteger *> exponents;
+		bases.reserve(ciphertexts.size());
+		exponents.reserve(scalars.size());
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			bases.push_back(&ciphertexts[i].data);
+			exponents.push_back(&scalars[i]);
+		}
+
+		return T_Ciphertext(BigInteger::MultiPowModN(bases, exponents, *this->encryptionModulus), this->encryptionModulus);
+	}
+
+	/**
+	Computes @f$ [\sum_i ciphertexts_i \cdot scalars_i] = \prod_i [ciphertexts_i]^{scalars_i} \pmod n @f$. The terms covered by the exponentiation table of their
+	precomputed ciphertext are computed from the table (no squarings are required) and multiplied one by one, while all the other terms share a single
+	simultaneous multi-exponentiation (BigInteger::MultiPowModN).
+
+	As above, 0 scalars are allowed (the corresponding terms are skipped) and the output is not randomized.
+
+	@param ciphertexts the precomputed encrypted vector
+	@param scalars the plaintext vector
+	@return A new instance containing @f$ [\sum_i ciphertexts_i \cdot scalars_i] @f$
+	@throws std::runtime_error the two vectors have different sizes
+	*/
+	template <typename T_PublicKey, typename T_PrivateKey, typename T_Ciphertext, typename T_Randomizer>
+	T_Ciphertext CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>::HomomorphicDotProduct (const std::vector<PrecomputedCiphertext<T_Ciphertext>> &ciphertexts, const std::vector<BigInteger> &scalars) const {
+		if (ciphertexts.size() != scalars.size()) {
+			throw std::runtime_error("The number of ciphertexts must be equal to the number of scalars.");
+		}
+
+		T_Ciphertext output(BigInteger(1), this->encryptionModulus);
+		T_Ciphertext term;
+		std::vector<const BigInteger *> bases;
+		std::vector<const BigInteger *> exponents;
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			if (scalars[i] == 0) {
+				continue;
+			}
+
+			if (ciphertexts[i].MultiplyWithTable(term, scalars[i])) {
+				BigInteger::MulModN(output.data, output.data, term.data, *this->encryptionModulus);
+			}
+			else {
+				bases.push_back(&ciphertexts[i].GetCiphertext().data);
+				exponents.push_back(&scalars[i]);
+			}
+		}
+
+		if (!bases.empty()) {
+			BigInteger::MulModN(output.data, output.data, BigInteger::MultiPowModN(bases, exponents, *this->encryptionModulus), *this->encryptionModulus);
+		}
+
+		return output;
+	}
+
+	/**
+	Computes @f$ [-ciphertexts_i] = [ciphertexts_i]^{-1} \pmod n @f$ for all the ciphertexts using BigInteger::BatchInverseModN, which replaces the @f$ k @f$ modular inversions with one inversion and @f$ 3 (k - 1) @f$ modular multiplications.
+
+	Requires a ciphertext type exposing a single BigInteger data member (ElGamal provides its own implementation).
+
+	@param ciphertexts the encrypted vector
+	@return A vector containing @f$ [-ciphertexts_i] @f$
+	*/
+	template <typename T_PublicKey, typename T_PrivateKey, typename T_Ciphertext, typename T_Randomizer>
+	std::vector<T_Ciphertext> CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>::BatchNegate (const std::vector<T_Ciphertext> &ciphertexts) const {
+		std::vector<const BigInteger *> inputs;
+		inputs.reserve(ciphertexts.size());
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			inputs.push_back(&ciphertexts[i].data);
+		}
+
+		std::vector<BigInteger> inverses = BigInteger::BatchInverseModN(inputs, *this->encryptionModulus);
+
+		std::vector<T_Ciphertext> output;
+		output.reserve(inverses.size());
+		for (size_t i = 0; i < inverses.size(); ++i) {
+			output.emplace_back(std::move(inverses[i]), this->encryptionModulus);
+		}
+
+		return output;
+	}
+
+	/**
+	Computes @f$ [lhs_i - rhs_i] = [lhs_i] [rhs_i]^{-1} \pmod n @f$ (see BatchNegate).
+
+	@param lhs left hand side encrypted vector
+	@param rhs right hand side encrypted vector
+	@return A vector containing @f$ [lhs_i - rhs_i] @f$
+	@throws std::runtime_error the two vectors have different sizes
+	*/
+	template <typename T_PublicKey, typename T_PrivateKey, typename T_Ciphertext, typename T_Randomizer>
+	std::vector<T_Ciphertext> CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>::BatchSubtract (const std::vector<T_Ciphertext> &lhs, const std::vector<T_Ciphertext> &rhs) const {
+		if (lhs.size() != rhs.size()) {
+			throw std::runtime_error("The two ciphertext vectors must have the same size.");
+		}
+
+		std::vector<T_Ciphertext> output = this->BatchNegate(rhs);
+		for (size_t i = 0; i < output.size(); ++i) {
+			BigInteger::MulModN(output[i].data, output[i].data, lhs[i].data, *this->encryptionModulus);
+		}
+
+		return output;
+	}
+
+	/**
+	Computes @f$ [lhs - rhs_i] = [lhs] [rhs_i]^{-1} \pmod n @f$ (see BatchNegate). Typical use: @f$ [1 - b_i] @f$ for encrypted bits.
+
+	@param lhs left hand side ciphertext
+	@param rhs right hand side encrypted vector
+	@return A vector containing @f$ [lhs - rhs_i] @f$
+	*/
+	template <typename T_PublicKey, typename T_PrivateKey, typename T_Ciphertext, typename T_Randomizer>
+	std::vector<T_Ciphertext> CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>::BatchSubtract (const T_Ciphertext &lhs, const std::vector<T_Ciphertext> &rhs) const {
+		std::vector<T_Ciphertext> output = this->BatchNegate(rhs);
+		for (size_t i = 0; i < output.size(); ++i) {
+			BigInteger::MulModN(output[i].data, output[i].data, lhs.data, *this->encryptionModulus);
+		}
+
+		return output;
+	}
+
+	/**
+	Computes @f$ [lhs_i + rhs_i] = [lhs_i] [rhs_i] \pmod n @f$ for all the ciphertexts using BigInteger::BatchMulModN.
+
+	Requires a ciphertext type exposing a single BigInteger data member (ElGamal provides its own implementation).
+
+	@param lhs left hand side encrypted vector
+	@param rhs right hand side encrypted vector
+	@return A vector containing @f$ [lhs_i + rhs_i] @f$
+	@throws std::runtime_error the two vectors have different sizes
+	*/
+	template <typename T_PublicKey, typename T_PrivateKey, typename T_Ciphertext, typename T_Randomizer>
+	std::vector<T_Ciphertext> CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>::BatchAdd (const std::vector<T_Ciphertext> &lhs, const std::vector<T_Ciphertext> &rhs) const {
+		if (lhs.size() != rhs.size()) {
+			throw std::runtime_error("The two ciphertext vectors must have the same size.");
+		}
+
+		std::vector<const BigInteger *> lhsData;
+		std::vector<const BigInteger *> rhsData;
+		lhsData.reserve(lhs.size());
+		rhsData.reserve(rhs.size());
+		for (size_t i = 0; i < lhs.size(); ++i) {
+			lhsData.push_back(&lhs[i].data);
+			rhsData.push_back(&rhs[i].data);
+		}
+
+		std::vector<BigInteger> products = BigInteger::BatchMulModN(lhsData, rhsData, *this->encryptionModulus);
+
+		std::vector<T_Ciphertext> output;
+		output.reserve(products.size());
+		for (size_t i = 0; i < products.size(); ++i) {
+			output.emplace_back(std::move(products[i]), this->encryptionModulus);
+		}
+
+		return output;
+	}
+
+	/**
+	Computes @f$ [ciphertexts_i \cdot scalars_i] = [ciphertexts_i]^{scalars_i} \pmod n @f$ for all the ciphertexts using BigInteger::BatchPowModN.
+
+	Requires a ciphertext type exposing a single BigInteger data member (ElGamal provides its own implementation).
+
+	@param ciphertexts the encrypted vector
+	@param scalars the plaintext scalars (same size as ciphertexts, non-zero)
+	@return A vector containing @f$ [ciphertexts_i \cdot scalars_i] @f$
+	@throws std::runtime_error the two vectors have different sizes
+	@throws std::runtime_error one of the scalars is 0
+	*/
+	template <typename T_PublicKey, typename T_PrivateKey, typename T_Ciphertext, typename T_Randomizer>
+	std::vector<T_Ciphertext> CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>::BatchMultiply (const std::vector<T_Ciphertext> &ciphertexts, const std::vector<BigInteger> &scalars) const {
+		if (ciphertexts.size() != scalars.size()) {
+			throw std::runtime_error("The number of ciphertexts must be equal to the number of scalars.");
+		}
+
+		std::vector<const BigInteger *> bases;
+		std::vector<const BigInteger *> exponents;
+		bases.reserve(ciphertexts.size());
+		exponents.reserve(scalars.size());
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			//same restriction as CiphertextBase::operator*
+			if (scalars[i] == 0) {
+				throw std::runtime_error("The plaintext term should not be 0.");
+			}
+
+			bases.push_back(&ciphertexts[i].data);
+			exponents.push_back(&scalars[i]);
+		}
+
+		std::vector<BigInteger> powers = BigInteger::BatchPowModN(bases, exponents, *this->encryptionModulus);
+
+		std::vector<T_Ciphertext> output;
+		output.reserve(powers.size());
+		for (size_t i = 0; i < powers.size(); ++i) {
+			output.emplace_back(std::move(powers[i]), this->encryptionModulus);
+		}
+
+		return output;
+	}
+
+	/**
+	Each plaintext is encrypted with EncryptInteger, so the encryptions share the randomizer cache and the precomputed tables of the crypto provider.
+
+	@param plaintexts the plaintexts
+	@return A vector containing @f$ [plaintexts_i] @f$, in the same order as the plaintexts
+	@throws std::runtime_error one of the plaintexts is outside the message space (see EncryptInteger)
+	*/
+	template <typename T_PublicKey, typename T_PrivateKey, typename T_Ciphertext, typename T_Randomizer>
+	std::vector<T_Ciphertext> CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>::EncryptBatch (const std::vector<BigInteger> &plaintexts) const {
+		std::vector<T_Ciphertext> output(plaintexts.size());
+
+		WorkerPool::GetInstance().ParallelFor(plaintexts.size(), [this, &plaintexts, &output] (const size_t index) {
+			output[index] = this->EncryptInteger(plaintexts[index]);
+		});
+
+		return output;
+	}
+
+	/**
+	@param ciphertexts the ciphertexts
+	@return A vector containing the decrypted values, in the same order as the ciphertexts
+	@throws std::runtime_error the private key is not available (see DecryptInteger)
+	*/
+	template <typename T_PublicKey, typename T_PrivateKey, typename T_Ciphertext, typename T_Randomizer>
+	std::vector<BigInteger> CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>::DecryptBatch (const std::vector<T_Ciphertext> &ciphertexts) const {
+		std::vector<BigInteger> output(ciphertexts.size());
+
+		WorkerPool::GetInstance().ParallelFor(ciphertexts.size(), [this, &ciphertexts, &output] (const size_t index) {
+			output[index] = this->DecryptInteger(ciphertexts[index]);
+		});
+
+		return output;
+	}
+
+	/**
+	@param ciphertexts the ciphertexts
+	@return A vector containing a fresh randomization of each ciphertext, in the same order as the ciphertexts
+	*/
+	template <typename T_PublicKey, typename T_PrivateKey, typename T_Ciphertext, typename T_Randomizer>
+	std::vector<T_Ciphertext> CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>::RandomizeBatch (const std::vector<T_Ciphertext> &ciphertexts) const {
+		std::vector<T_Ciphertext> output(ciphertexts.size());
+
+		WorkerPool::GetInstance().ParallelFor(ciphertexts.size(), [this, &ciphertexts, &output] (const size_t index) {
+			output[index] = this->RandomizeCiphertext(ciphertexts[index]);
+		});
+
+		return output;
+	}
+
 	/**
 	@return a read-only reference to the encryption modulus
 	*/
@@ -154,6 +421,21 @@ namespace Core {
 		return this->privateKey;
 	}
 
+	/**
+	Gives the offline phase (see PrecomputationPlan) access to the randomizers consumed by the encryptions and the re-randomizations.
+
+	@return a reference to the randomizer cache
+	@throws std::runtime_error the keys were not generated or loaded yet
+	*/
+	template <typename T_PublicKey, typename T_PrivateKey, typename T_Ciphertext, typename T_Randomizer>
+	typename CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>::RandomizerCacheType &CryptoProvider<T_PublicKey, T_PrivateKey, T_Ciphertext, T_Randomizer>::GetRandomizerCache () const {
+		if (!this->randomizerCache) {
+			throw std::runtime_error("The randomizer cache is not initialized.");
+		}
+
+		return *this->randomizerCache;
+	}
+
 	/**
 	@param randomized if true, the encryption will be randomized (defaults to true)
 	@return Re-randomized [0]
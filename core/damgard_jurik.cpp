@@ -0,0 +1,449 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/damgard_jurik.cpp
+@brief Implementation of class DamgardJurik.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "damgard_jurik.h"
+
+namespace SeComLib {
+namespace Core {
+	/**
+	Does not initialize the encryptionModulus.
+	*/
+	DamgardJurikCiphertext::DamgardJurikCiphertext () :
+		CiphertextBase<DamgardJurikCiphertext> () {
+	}
+
+	/**
+	Initializes the encryptionModulus
+	@param encryptionModulus The encryption modulus
+	*/
+	DamgardJurikCiphertext::DamgardJurikCiphertext (const std::shared_ptr<BigInteger> &encryptionModulus) :
+		CiphertextBase<DamgardJurikCiphertext> (encryptionModulus) {
+	}
+
+	/**
+	Initializes the data and the encryptionModulus
+	@param data the ciphertext data
+	@param encryptionModulus The encryption modulus
+	*/
+	DamgardJurikCiphertext::DamgardJurikCiphertext (const BigInteger &data, const std::shared_ptr<BigInteger> &encryptionModulus) :
+		CiphertextBase<DamgardJurikCiphertext> (data, encryptionModulus) {
+	}
+
+	/**
+	@param data the ciphertext data, moved into the current instance
+	@param encryptionModulus The encryption modulus
+	*/
+	DamgardJurikCiphertext::DamgardJurikCiphertext (BigInteger &&data, const std::shared_ptr<BigInteger> &encryptionModulus) :
+		CiphertextBase<DamgardJurikCiphertext> (std::move(data), encryptionModulus) {
+	}
+
+	/**
+	*/
+	DamgardJurikRandomizer::DamgardJurikRandomizer () : RandomizerBase() {
+	}
+
+	/**
+	Initializes the data
+	@param data the randomizer data
+	*/
+	DamgardJurikRandomizer::DamgardJurikRandomizer (const BigInteger &data) : RandomizerBase(data) {
+	}
+
+	/**
+	Takes over the data
+	@param data the randomizer data
+	*/
+	DamgardJurikRandomizer::DamgardJurikRandomizer (BigInteger &&data) : RandomizerBase(std::move(data)) {
+	}
+
+	/**
+	Sets the specified key size (defaults to 1024) and the expansion degree s (defaults to 2) from the configuration file.
+	*/
+	DamgardJurik::DamgardJurik () : CryptoProvider<DamgardJurikPublicKey, DamgardJurikPrivateKey, DamgardJurikCiphertext, DamgardJurikRandomizer>(Utils::Config::GetInstance().GetParameter("Core.DamgardJurik.keySize", 1024)),
+		parallelDecryption(false) {
+		this->publicKey.s = Utils::Config::GetInstance().GetParameter("Core.DamgardJurik.s", 2U);
+
+		this->validateParameters();
+	}
+
+	/**
+	Performs required precomputations.
+
+	@param publicKey a DamgardJurikPublicKey structure
+	@throws std::runtime_error the expansion degree is 0
+	*/
+	DamgardJurik::DamgardJurik (const DamgardJurikPublicKey &publicKey) : CryptoProvider<DamgardJurikPublicKey, DamgardJurikPrivateKey, DamgardJurikCiphertext, DamgardJurikRandomizer>(publicKey, Utils::Config::GetInstance().GetParameter("Core.DamgardJurik.keySize", 1024)),
+		parallelDecryption(false) {
+		this->validateParameters();
+
+		//C++ doesn't allow us to call a virtual method in the constructor of the base class
+		this->doPrecomputations();
+	}
+
+	/**
+	Performs required precomputations.
+
+	@param publicKey a DamgardJurikPublicKey structure
+	@param privateKey a DamgardJurikPrivateKey structure
+	@throws std::runtime_error the expansion degree is 0
+	*/
+	DamgardJurik::DamgardJurik (const DamgardJurikPublicKey &publicKey, const DamgardJurikPrivateKey &privateKey) :
+		CryptoProvider<DamgardJurikPublicKey, DamgardJurikPrivateKey, DamgardJurikCiphertext, DamgardJurikRandomizer>(publicKey, privateKey, Utils::Config::GetInstance().GetParameter("Core.DamgardJurik.keySize", 1024)),
+		parallelDecryption(false) {
+		this->validateParameters();
+
+		//C++ doesn't allow us to call a virtual method in the constructor of the base class
+		this->doPrecomputations();
+	}
+
+	/**
+	Stops the producer threads of the randomizer cache before the members they use are destroyed.
+	*/
+	DamgardJurik::~DamgardJurik () {
+		this->randomizerCache.reset();
+	}
+
+	/**
+	Generates the Damgard-Jurik cryptosystem keys (the same as the Paillier keys).
+
+	Produces @f$ p @f$ and @f$ q @f$, each having half of the key length, and computes @f$ n = p q @f$, enforcing @f$ n @f$ to have the length specified by the key length.
+
+	@return Always true, for now
+	*/
+	bool DamgardJurik::GenerateKeys () {
+		//stop the producer threads of the randomizer cache before the keys change
+		this->randomizerCache.reset();
+
+		/// Set the length of primes p and q
+		unsigned int primeLength = (unsigned int)(this->keyLength / 2);
+
+		do {
+			this->privateKey.p = PrimeSearch::GetMaxLengthRandomPrime(primeLength);
+			this->privateKey.q = PrimeSearch::GetMaxLengthRandomPrime(primeLength);
+
+			/// If both are equal (highly unlikely) seek another prime
+			while (this->privateKey.p == this->privateKey.q) {
+				this->privateKey.p = PrimeSearch::GetMaxLengthRandomPrime(primeLength);
+			}
+
+			/// Compute @f$ n = p q @f$
+			this->publicKey.n = this->privateKey.p * this->privateKey.q;
+		}
+		while (this->publicKey.n.GetSize() != this->keyLength);
+
+		//precompute values for optimization purposes
+		this->doPrecomputations();
+
+		return true;
+	}
+
+	/**
+	Decrypts the ciphertext modulo @f$ p^s @f$ and @f$ q^s @f$ (see decryptModPrimePower) and combines the results via CRT.
+
+	If @f$ plaintext \geq \lfloor messagespace / 2 @f$, it is remapped to a negative value.
+
+	@param ciphertext the ciphertext integer
+	@return Deciphered plaintext
+	@throws std::runtime_error operation requires the private key
+	*/
+	BigInteger DamgardJurik::DecryptInteger (const DamgardJurik::Ciphertext &ciphertext) const {
+		if (!this->hasPrivateKey) {
+			throw std::runtime_error("This operation requires the private key.");
+		}
+
+		BigInteger mp;
+		BigInteger mq;
+
+		/// For large keys, @f$ m_p @f$ and @f$ m_q @f$ are computed in parallel (the calling thread hands one of them off to the WorkerPool)
+		if (this->parallelDecryption) {
+			WorkerPool::GetInstance().ParallelFor(2, [this, &ciphertext, &mp, &mq] (const size_t index) {
+				if (0 == index) {
+					mp = this->decryptModPrimePower(ciphertext.data, this->pContext);
+				}
+				else {
+					mq = this->decryptModPrimePower(ciphertext.data, this->qContext);
+				}
+			});
+		}
+		else {
+			mp = this->decryptModPrimePower(ciphertext.data, this->pContext);
+			mq = this->decryptModPrimePower(ciphertext.data, this->qContext);
+		}
+
+		/// @f$ m = m_p q^s (q^{-s} \pmod {p^s}) + m_q p^s (p^{-s} \pmod {q^s}) \pmod {n^s} @f$
+		BigInteger output = mq * this->pPowSTimesInvModQPowS;
+		BigInteger::MulAddModN(output, mp, this->qPowSTimesInvModPPowS, output, this->GetMessageSpaceUpperBound());
+
+		/// If @f$ plaintext \leq \lfloor messagespace / 2 \rfloor \Rightarrow plaintext \geq 0 @f$ otherwise @f$ plaintext < 0 \Rightarrow plaintext = plaintext - messagespace  @f$
+		if (output > this->positiveNegativeBoundary) {
+			output -= this->GetMessageSpaceUpperBound();
+		}
+
+		return output;
+	}
+
+	/**
+	Computes @f$ c = (1 + n)^m = \sum_{k = 0}^{s} \binom{m}{k} n^k \pmod {n^{s + 1}} @f$, which does not need any exponentiation.
+
+	@param plaintext the plaintext integer
+	@return Encrypted ciphertext
+	*/
+	DamgardJurik::Ciphertext DamgardJurik::EncryptIntegerNonrandom (const BigInteger &plaintext) const {
+		Ciphertext output(this->encryptionModulus);
+
+		/// If @f$ plaintext < 0 @f$, we remap it to the second half of the message space
+		BigInteger m = plaintext < 0 ? this->GetMessageSpaceUpperBound() + plaintext : plaintext;
+
+		output.data = 1;
+
+		//the binomial coefficients are computed iteratively, C(m, k) = C(m, k - 1) (m - k + 1) / k (the divisions are exact)
+		BigInteger binomialCoefficient(1);
+		for (unsigned int k = 1; k <= this->publicKey.s; ++k) {
+			binomialCoefficient *= m - (k - 1);
+			binomialCoefficient /= k;
+
+			//C(m, k) = 0 for all k > m
+			if (binomialCoefficient == 0) {
+				break;
+			}
+
+			output.data += binomialCoefficient * this->nPowers[k];
+		}
+
+		output.data %= this->GetEncryptionModulus();
+
+		return output;
+	}
+
+	/**
+	Generates a random number @f$ r \in \mathbb{Z}_n^* @f$ and computes @f$ r^{n^s} \pmod {n^{s + 1}} @f$.
+
+	If the private key is available, the randomizer is computed modulo @f$ p^{s + 1} @f$ and @f$ q^{s + 1} @f$ (see getRandomResidue) and combined via CRT.
+
+	@return the randomizer
+	*/
+	DamgardJurik::Randomizer DamgardJurik::GetRandomizer () const {
+		if (!this->hasPrivateKey) {
+			return Randomizer((RandomProvider::GetInstance().GetRandomInteger(this->nMinusOne) + 1).GetPowModN(this->GetMessageSpaceUpperBound(), this->GetEncryptionModulus()));
+		}
+
+		/// Fast version: @f$ CRT(y_p^{p^s} \bmod p^{s + 1}, y_q^{q^s} \bmod q^{s + 1}) @f$
+		BigInteger output = this->getRandomResidue(this->qContext) * this->pPowSPlusOneTimesInvModQPowSPlusOne;
+		BigInteger::MulAddModN(output, this->getRandomResidue(this->pContext), this->qPowSPlusOneTimesInvModPPowSPlusOne, output, this->GetEncryptionModulus());
+
+		return Randomizer(std::move(output));
+	}
+
+	/**
+	Computes @f$ c = c r^{n^s} \pmod {n^{s + 1}} @f$.
+
+	@param ciphertext the ciphertext integer
+	@return The randomized ciphertext
+	*/
+	DamgardJurik::Ciphertext DamgardJurik::RandomizeCiphertext (const DamgardJurik::Ciphertext &ciphertext) const {
+		Ciphertext output(this->encryptionModulus);
+		BigInteger::MulModN(output.data, ciphertext.data, this->randomizerCache->Pop().randomizer.data, this->GetEncryptionModulus());
+
+		return output;
+	}
+
+	/**
+	@return @f$ n^s @f$
+	*/
+	const BigInteger &DamgardJurik::GetMessageSpaceUpperBound () const {
+		return this->nPowers[this->publicKey.s];
+	}
+
+	/**
+	@return The message space bit size.
+	*/
+	size_t DamgardJurik::GetMessageSpaceSize () const {
+		return this->GetMessageSpaceUpperBound().GetSize();
+	}
+
+	/**
+	@return The provider name, the hexadecimal public key modulus and the expansion degree.
+	*/
+	std::string DamgardJurik::GetPublicKeyFingerprint () const {
+		return "DamgardJurik:n=" + this->publicKey.n.ToString(16) + ",s=" + std::to_string(static_cast<unsigned long long>(this->publicKey.s));
+	}
+
+	/**
+	@param context the context to initialize
+	@param prime @f$ p @f$
+	@throws std::runtime_error s is not smaller than p (k! is not invertible modulo the powers of p)
+	*/
+	void DamgardJurik::initializePrimeContext (PrimeContext &context, const BigInteger &prime) const {
+		context.prime = prime;
+		context.primeMinusOne = prime - 1;
+
+		context.powers.assign(1, BigInteger(1));
+		for (unsigned int j = 1; j <= this->publicKey.s + 1; ++j) {
+			context.powers.emplace_back(context.powers.back() * prime);
+		}
+
+		context.factorialInverses.assign(1, BigInteger(1));
+		BigInteger factorial(1);
+		for (unsigned int k = 1; k <= this->publicKey.s; ++k) {
+			factorial *= k;
+			context.factorialInverses.emplace_back(factorial.GetInverseModN(context.powers[this->publicKey.s]));
+		}
+
+		/// @f$ h_p = \log_{1 + p}(g^{p - 1} \pmod {p^{s + 1}})^{-1} \pmod {p^s} @f$, with @f$ g = n + 1 @f$
+		context.h = this->extractExponent((this->publicKey.n + 1).GetPowModN(context.primeMinusOne, context.powers[this->publicKey.s + 1]), context).InvertModN(context.powers[this->publicKey.s]);
+	}
+
+	/**
+	Every element of @f$ \mathbb{Z}_{p^{s + 1}}^* @f$ which is congruent to 1 modulo @f$ p @f$ is a power of @f$ 1 + p @f$.
+	The exponent is extracted one power of @f$ p @f$ at a time, from @f$ L_p(a \bmod p^{j + 1}) = \sum_{k = 1}^{j} \binom{x}{k} p^{k - 1} \pmod {p^j} @f$, for @f$ j = 1 \dots s @f$
+	(the algorithm of Damgard and Jurik, with @f$ n @f$ replaced by @f$ p @f$).
+
+	@param a @f$ (1 + p)^x \pmod {p^{s + 1}} @f$
+	@param context the values precomputed for @f$ p @f$
+	@return @f$ x @f$
+	*/
+	BigInteger DamgardJurik::extractExponent (const BigInteger &a, const PrimeContext &context) const {
+		BigInteger i(0);
+
+		for (unsigned int j = 1; j <= this->publicKey.s; ++j) {
+			const BigInteger &modulus = context.powers[j];
+
+			/// @f$ t_1 = L_p(a \bmod p^{j + 1}) = \frac{(a \bmod p^{j + 1}) - 1}{p} @f$
+			BigInteger t1 = ((a % context.powers[j + 1]) - 1) / context.prime;
+			BigInteger t2 = i;
+
+			/// Subtract @f$ \binom{i}{k} p^{k - 1} @f$, for @f$ k = 2 \dots j @f$, where @f$ i @f$ is the exponent modulo @f$ p^{j - 1} @f$
+			for (unsigned int k = 2; k <= j; ++k) {
+				i -= 1;
+				t2.MultiplyModN(i, modulus);
+
+				t1 -= t2 * context.powers[k - 1] * context.factorialInverses[k];
+				t1 %= modulus;
+			}
+
+			i = std::move(t1);
+		}
+
+		return i;
+	}
+
+	/**
+	Computes @f$ m_p = \log_{1 + p}(c^{p - 1} \pmod {p^{s + 1}}) h_p \pmod {p^s} @f$.
+
+	Since the order of @f$ \mathbb{Z}_{p^{s + 1}}^* @f$ is @f$ p^s (p - 1) @f$, raising @f$ c = (1 + n)^m r^{n^s} @f$ to @f$ p - 1 @f$ removes the randomizer.
+
+	@param ciphertext the ciphertext data, @f$ c @f$
+	@param context the values precomputed for @f$ p @f$
+	@return @f$ m \bmod p^s @f$
+	*/
+	BigInteger DamgardJurik::decryptModPrimePower (const BigInteger &ciphertext, const PrimeContext &context) const {
+		BigInteger output = this->extractExponent(ciphertext.GetPowModN(context.primeMinusOne, context.powers[this->publicKey.s + 1]), context);
+		output.MultiplyModN(context.h, context.powers[this->publicKey.s]);
+
+		return output;
+	}
+
+	/**
+	Since @f$ (y + k p)^{p^s} \equiv y^{p^s} \pmod {p^{s + 1}} @f$, the @f$ n^s @f$-th residues modulo @f$ p^{s + 1} @f$ are exactly the values @f$ y_p^{p^s} \pmod {p^{s + 1}} @f$,
+	with @f$ y_p \in \mathbb{Z}_p^* @f$ (the same distribution as @f$ r^{n^s} \pmod {p^{s + 1}} @f$, with exponents and moduli half as long).
+
+	@param context the values precomputed for @f$ p @f$
+	@return @f$ y_p^{p^s} \pmod {p^{s + 1}} @f$, for a random @f$ y_p @f$
+	*/
+	BigInteger DamgardJurik::getRandomResidue (const PrimeContext &context) const {
+		BigInteger y = RandomProvider::GetInstance().GetRandomInteger(context.primeMinusOne) + 1;
+
+		return y.GetPowModN(context.powers[this->publicKey.s], context.powers[this->publicKey.s + 1]);
+	}
+
+	/**
+	@throws std::runtime_error the expansion degree is 0
+	*/
+	void DamgardJurik::validateParameters () {
+		if (this->publicKey.s < 1) {
+			throw std::runtime_error("The s parameter must be at least 1.");
+		}
+	}
+
+	/**
+	Precomputes the powers of @f$ n @f$ and, if the private key is available, the values required by the CRT decryption and randomizers.
+
+	Reads Core.DamgardJurik.parallelDecryptionKeySize.
+
+	Precomputes [0] and [1].
+	*/
+	void DamgardJurik::doPrecomputations () {
+		this->nMinusOne = this->publicKey.n - 1;
+
+		this->nPowers.assign(1, BigInteger(1));
+		for (unsigned int j = 1; j <= this->publicKey.s + 1; ++j) {
+			this->nPowers.emplace_back(this->nPowers.back() * this->publicKey.n);
+		}
+
+		if (this->hasPrivateKey) {
+			this->initializePrimeContext(this->pContext, this->privateKey.p);
+			this->initializePrimeContext(this->qContext, this->privateKey.q);
+
+			const BigInteger &pPowS = this->pContext.powers[this->publicKey.s];
+			const BigInteger &qPowS = this->qContext.powers[this->publicKey.s];
+			const BigInteger &pPowSPlusOne = this->pContext.powers[this->publicKey.s + 1];
+			const BigInteger &qPowSPlusOne = this->qContext.powers[this->publicKey.s + 1];
+
+			/// Speed optimizations for decryption and for the randomizers: precompute the CRT coefficients modulo @f$ n^s @f$ and @f$ n^{s + 1} @f$
+			try {
+				this->pPowSTimesInvModQPowS = pPowS * pPowS.GetInverseModN(qPowS);
+				this->qPowSTimesInvModPPowS = qPowS * qPowS.GetInverseModN(pPowS);
+				this->pPowSPlusOneTimesInvModQPowSPlusOne = pPowSPlusOne * pPowSPlusOne.GetInverseModN(qPowSPlusOne);
+				this->qPowSPlusOneTimesInvModPPowSPlusOne = qPowSPlusOne * qPowSPlusOne.GetInverseModN(pPowSPlusOne);
+			}
+			/// @todo Catch a custom exception here
+			catch (const std::runtime_error &) {
+				//if gcd(p, q) != 1, throw an error
+				throw std::runtime_error("p and q are not coprime.");
+			}
+		}
+
+		/// The two CRT halves of the decryption run in parallel for keys of at least Core.DamgardJurik.parallelDecryptionKeySize bits (0, the default, disables it)
+		size_t parallelDecryptionKeySize = Utils::Config::GetInstance().GetParameter<size_t>("Core.DamgardJurik.parallelDecryptionKeySize", 0);
+		this->parallelDecryption = this->hasPrivateKey && parallelDecryptionKeySize > 0 && this->publicKey.n.GetSize() >= parallelDecryptionKeySize;
+
+		//set the encryption modulus, @f$ n^{s + 1} @f$
+		this->encryptionModulus = std::make_shared<BigInteger>(this->nPowers[this->publicKey.s + 1]);
+
+		//precompute the limit between positive and negative values in the message space
+		this->positiveNegativeBoundary = this->GetMessageSpaceUpperBound() / 2;
+
+		/// Populate the randomizer cache
+		this->randomizerCache = std::unique_ptr<RandomizerCacheType>(new RandomizerCacheType(*this, "Core.RandomizerCache"));
+
+		this->encryptedZero = this->EncryptInteger(BigInteger(0));
+
+		this->encryptedOne = this->EncryptInteger(BigInteger(1));
+	}
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
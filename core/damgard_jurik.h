@@ -0,0 +1,229 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/damgard_jurik.h
+@brief Definition of class DamgardJurik.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef DAMGARD_JURIK_HEADER_GUARD
+#define DAMGARD_JURIK_HEADER_GUARD
+
+#include "big_integer.h"
+#include "random_provider.h"
+#include "prime_search.h"
+#include "ciphertext_base.h"
+#include "crypto_provider.h"
+#include "utils/config.h"
+#include "worker_pool.h"
+
+//include C++ headers
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief The public key container structure for the Damgard-Jurik cryptosystem
+	*/
+	struct DamgardJurikPublicKey {
+	public:
+		/// @f$ n @f$
+		BigInteger n;
+		/// @f$ s @f$, the expansion degree (the plaintexts are integers modulo @f$ n^s @f$)
+		unsigned int s;
+	};
+
+	/**
+	@brief The private key container structure for the Damgard-Jurik cryptosystem
+	*/
+	struct DamgardJurikPrivateKey {
+	public:
+		/// @f$ p @f$
+		BigInteger p;
+		/// @f$ q @f$
+		BigInteger q;
+	};
+
+	/**
+	@brief Damgard-Jurik cipertext
+	*/
+	class DamgardJurikCiphertext : public CiphertextBase<DamgardJurikCiphertext> {
+	public:
+		/// Default constructor
+		DamgardJurikCiphertext ();
+
+		/// Constructor with encryption modulus initialization
+		DamgardJurikCiphertext (const std::shared_ptr<BigInteger> &encryptionModulus);
+
+		/// Constructor with data and encryption modulus initialization
+		DamgardJurikCiphertext (const BigInteger &data, const std::shared_ptr<BigInteger> &encryptionModulus);
+
+		/// Constructor with data (taken over) and encryption modulus initialization
+		DamgardJurikCiphertext (BigInteger &&data, const std::shared_ptr<BigInteger> &encryptionModulus);
+	};
+
+	/**
+	@brief The randomizer type for Damgard-Jurik
+	*/
+	struct DamgardJurikRandomizer : public RandomizerBase {
+		/// Default constructor
+		DamgardJurikRandomizer ();
+
+		/// Constructor with initialization
+		DamgardJurikRandomizer (const BigInteger &data);
+
+		/// Constructor with initialization (takes over the input)
+		DamgardJurikRandomizer (BigInteger &&data);
+	};
+
+	/**
+	@brief Implementation of the public-key Damgard-Jurik Cryptosystem
+
+	Generalization of Paillier with the expansion degree @f$ s \geq 1 @f$ (Core.DamgardJurik.s): the plaintexts are integers modulo @f$ n^s @f$
+	and the ciphertexts are integers modulo @f$ n^{s + 1} @f$, so the ciphertext expansion drops from 2 (Paillier, @f$ s = 1 @f$) to @f$ (s + 1) / s @f$.
+	Uses @f$ g = n + 1 @f$, like the "shortcut" version of Paillier.
+
+	The key holders decrypt and compute the randomizers via CRT, modulo @f$ p^{s + 1} @f$ and @f$ q^{s + 1} @f$.
+	*/
+	class DamgardJurik : public CryptoProvider<DamgardJurikPublicKey, DamgardJurikPrivateKey, DamgardJurikCiphertext, DamgardJurikRandomizer> {
+	public:
+		/// Default constructor
+		DamgardJurik ();
+
+		/// Creates an instance of the class for homomorphic operations and ecryption
+		DamgardJurik (const DamgardJurikPublicKey &publicKey);
+
+		/// Creates an instance of the class for homomorphic operations, ecryption and decryption
+		DamgardJurik (const DamgardJurikPublicKey &publicKey, const DamgardJurikPrivateKey &privateKey);
+
+		/// Destructor
+		~DamgardJurik ();
+
+		/* Base class methods */
+
+		/// Generate the public and private keys
+		virtual bool GenerateKeys ();
+
+		/// Decrypt number
+		virtual BigInteger DecryptInteger (const Ciphertext &ciphertext) const;
+
+		/// Encrypt number without randomization
+		virtual Ciphertext EncryptIntegerNonrandom (const BigInteger &plaintext) const;
+
+		/// Compute the random factor required for the encryption operation
+		virtual Randomizer GetRandomizer () const;
+
+		/// Randomize encrypted number with a self-generated random value
+		virtual Ciphertext RandomizeCiphertext (const Ciphertext &ciphertext) const;
+
+		/// Returns the message space upper bound
+		virtual const BigInteger &GetMessageSpaceUpperBound () const;
+
+		/// Returns the message space bit size
+		virtual size_t GetMessageSpaceSize () const;
+
+		/// Returns a string which identifies the public key
+		virtual std::string GetPublicKeyFingerprint () const;
+
+		/* /Base class methods */
+
+	private:
+		/// @brief The values precomputed for one of the primes (decryption and randomizers via CRT)
+		struct PrimeContext {
+			/// @f$ p @f$
+			BigInteger prime;
+
+			/// @f$ p - 1 @f$
+			BigInteger primeMinusOne;
+
+			/// @f$ p^j @f$, for @f$ j = 0 \dots s + 1 @f$
+			std::vector<BigInteger> powers;
+
+			/// @f$ (k!)^{-1} \pmod {p^s} @f$, for @f$ k = 0 \dots s @f$
+			std::vector<BigInteger> factorialInverses;
+
+			/// @f$ \log_{1 + p}(g^{p - 1} \pmod {p^{s + 1}})^{-1} \pmod {p^s} @f$
+			BigInteger h;
+		};
+
+		/// Contains @f$ n - 1 @f$
+		BigInteger nMinusOne;
+
+		/// @f$ n^j @f$, for @f$ j = 0 \dots s + 1 @f$ (@f$ n^s @f$ is the message space upper bound, @f$ n^{s + 1} @f$ the encryption modulus)
+		std::vector<BigInteger> nPowers;
+
+		/// The values precomputed for @f$ p @f$
+		PrimeContext pContext;
+
+		/// The values precomputed for @f$ q @f$
+		PrimeContext qContext;
+
+		/// @f$ p^s (p^{-s} \pmod {q^s}) @f$
+		BigInteger pPowSTimesInvModQPowS;
+
+		/// @f$ q^s (q^{-s} \pmod {p^s}) @f$
+		BigInteger qPowSTimesInvModPPowS;
+
+		/// @f$ p^{s + 1} (p^{-(s + 1)} \pmod {q^{s + 1}}) @f$
+		BigInteger pPowSPlusOneTimesInvModQPowSPlusOne;
+
+		/// @f$ q^{s + 1} (q^{-(s + 1)} \pmod {p^{s + 1}}) @f$
+		BigInteger qPowSPlusOneTimesInvModPPowSPlusOne;
+
+		/// Flag which indicates if the two CRT halves of the decryption run on two threads (key size of at least Core.DamgardJurik.parallelDecryptionKeySize bits)
+		bool parallelDecryption;
+
+		/// Precomputes the values required by the CRT operations modulo the powers of a prime
+		void initializePrimeContext (PrimeContext &context, const BigInteger &prime) const;
+
+		/// Computes @f$ x \in \mathbb{Z}_{p^s} @f$ such that @f$ a = (1 + p)^x \pmod {p^{s + 1}} @f$
+		BigInteger extractExponent (const BigInteger &a, const PrimeContext &context) const;
+
+		/// Decrypts the ciphertext modulo @f$ p^s @f$ (or @f$ q^s @f$)
+		BigInteger decryptModPrimePower (const BigInteger &ciphertext, const PrimeContext &context) const;
+
+		/// Computes a random @f$ n^s @f$-th residue modulo @f$ p^{s + 1} @f$ (or @f$ q^{s + 1} @f$)
+		BigInteger getRandomResidue (const PrimeContext &context) const;
+
+		/* Base class methods */
+
+		/// Validates the expansion degree
+		virtual void validateParameters ();
+
+		/// Precompute values for speedups
+		virtual void doPrecomputations ();
+
+		/* /Base class methods */
+
+		/// Copy constructor - not implemented
+		DamgardJurik (const DamgardJurik &);
+
+		/// Copy assignment operator - not implemented
+		DamgardJurik operator= (const DamgardJurik &);
+	};
+}//namespace Core
+}//namespace SeComLib
+
+#endif//DAMGARD_JURIK_HEADER_GUARD
\ No newline at end of file
@@ -32,8 +32,11 @@ limitations under the License.
 #include "utils/config.h"
 
 //include C++ headers
+#include <algorithm>
 #include <deque>
+#include <iterator>
 #include <stdexcept>
+#include <vector>
 
 namespace SeComLib {
 namespace Core {
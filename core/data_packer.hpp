@@ -52,12 +52,14 @@ namespace Core {
 	/**
 	Packs the unencrypted bucket vector into a vector of encrypted data
 
+	The packed plaintexts are encrypted together with T_CryptoProvider::EncryptBatch.
+
 	@param input a vector of unencrypted data buckets
 	@return A vector of encrypted and packed data buckets.
 	*/
 	template <typename T_CryptoProvider>
 	typename DataPacker<T_CryptoProvider>::PackedData DataPacker<T_CryptoProvider>::Pack (const typename DataPacker<T_CryptoProvider>::UnpackedData &input) const {
-		typename DataPacker<T_CryptoProvider>::PackedData output;
+		std::vector<BigInteger> plaintexts;
 
 		//initialize the packed buckets
 		BigInteger packedBuckets(0);
@@ -66,7 +68,7 @@ namespace Core {
 		for (typename DataPacker<T_CryptoProvider>::UnpackedData::const_iterator bucketIterator = input.begin(); bucketIterator != input.end(); ++bucketIterator) {
 			//test if we packed enough buckets to fill the entire span of the message space
 			if (packedBucketCounter == this->bucketsPerEncryption) {
-				output.emplace_back(this->cryptoProvider.EncryptInteger(packedBuckets));
+				plaintexts.emplace_back(std::move(packedBuckets));
 
 				//create the next packed bucket
 				packedBuckets = BigInteger(0);
@@ -92,14 +94,18 @@ namespace Core {
 		}
 
 		//don't forget to store the last set of packed buckets (it might not contain as many as this->bucketsPerEncryption buckets, so we need to know how many buckets to unpack)
-		output.emplace_back(this->cryptoProvider.EncryptInteger(packedBuckets));
+		plaintexts.emplace_back(std::move(packedBuckets));
 
-		return output;
+		std::vector<typename T_CryptoProvider::Ciphertext> ciphertexts = this->cryptoProvider.EncryptBatch(plaintexts);
+
+		return typename DataPacker<T_CryptoProvider>::PackedData(std::make_move_iterator(ciphertexts.begin()), std::make_move_iterator(ciphertexts.end()));
 	}
 
 	/**
 	Unpacks the encrypted packed data into a vector of data buckets
 
+	Only the encryptions which hold the first totalBucketCount buckets are decrypted, together, with T_CryptoProvider::DecryptBatch.
+
 	@param input a vector of encrypted packed data
 	@param totalBucketCount the number of buckets to unpack
 	@return A vector of unencrypted data buckets.
@@ -108,9 +114,14 @@ namespace Core {
 	typename DataPacker<T_CryptoProvider>::UnpackedData DataPacker<T_CryptoProvider>::Unpack (const typename DataPacker<T_CryptoProvider>::PackedData &input, const size_t totalBucketCount) const {
 		typename DataPacker<T_CryptoProvider>::UnpackedData output;
 
-		for (typename DataPacker<T_CryptoProvider>::PackedData::const_iterator packedDataIterator = input.begin(); packedDataIterator != input.end(); ++packedDataIterator) {
-			//decrypt the packed buckets
-			BigInteger packedBuckets = this->cryptoProvider.DecryptInteger(*packedDataIterator);
+		size_t decryptionCount = std::min(input.size(), (totalBucketCount + this->bucketsPerEncryption - 1) / this->bucketsPerEncryption);
+		std::vector<typename T_CryptoProvider::Ciphertext> ciphertexts(input.begin(), input.begin() + decryptionCount);
+
+		//decrypt the packed buckets
+		std::vector<BigInteger> decryptions = this->cryptoProvider.DecryptBatch(ciphertexts);
+
+		for (std::vector<BigInteger>::iterator packedBucketsIterator = decryptions.begin(); packedBucketsIterator != decryptions.end(); ++packedBucketsIterator) {
+			BigInteger &packedBuckets = *packedBucketsIterator;
 
 			//extract each data bucket
 			for (size_t i = 0; i < this->bucketsPerEncryption; ++i) {
@@ -164,37 +175,38 @@ namespace Core {
 	}
 
 	/**
+	The packed encryptions are added together with T_CryptoProvider::BatchAdd. If the two vectors have different sizes, the extra encryptions are ignored.
+
 	@param lhs left hand side term - a vector of encrypted packed data
 	@param rhs right hand side term - a vector of encrypted packed data
 	@return A vector of encrypted packed data.
 	*/
 	template <typename T_CryptoProvider>
 	typename DataPacker<T_CryptoProvider>::PackedData DataPacker<T_CryptoProvider>::HomomorphicAdd (const typename DataPacker<T_CryptoProvider>::PackedData &rhs, const typename DataPacker<T_CryptoProvider>::PackedData &lhs) {
-		typename DataPacker<T_CryptoProvider>::PackedData output;
+		size_t size = std::min(lhs.size(), rhs.size());
+		std::vector<typename T_CryptoProvider::Ciphertext> lhsVector(lhs.begin(), lhs.begin() + size);
+		std::vector<typename T_CryptoProvider::Ciphertext> rhsVector(rhs.begin(), rhs.begin() + size);
 
-		for (typename DataPacker<T_CryptoProvider>::PackedData::const_iterator lhsIterator = lhs.begin(), rhsIterator = rhs.begin(); 
-				lhsIterator != lhs.end(), rhsIterator != rhs.end();
-				++lhsIterator, ++rhsIterator) {
-			output.emplace_back(*lhsIterator + *rhsIterator);
-		}
+		std::vector<typename T_CryptoProvider::Ciphertext> sums = this->cryptoProvider.BatchAdd(lhsVector, rhsVector);
 
-		return output;
+		return typename DataPacker<T_CryptoProvider>::PackedData(std::make_move_iterator(sums.begin()), std::make_move_iterator(sums.end()));
 	}
 
 	/**
+	The packed encryptions are multiplied with T_CryptoProvider::BatchMultiply.
+
 	@param lhs left hand side term - a vector of encrypted packed data
 	@param rhs right hand side term - a plaintext integer
 	@return A vector of encrypted packed data.
 	*/
 	template <typename T_CryptoProvider>
 	typename DataPacker<T_CryptoProvider>::PackedData DataPacker<T_CryptoProvider>::HomomorphicMultiply (const typename DataPacker<T_CryptoProvider>::PackedData &lhs, const BigInteger &rhs) {
-		typename DataPacker<T_CryptoProvider>::PackedData output;
+		std::vector<typename T_CryptoProvider::Ciphertext> lhsVector(lhs.begin(), lhs.end());
+		std::vector<BigInteger> scalars(lhs.size(), rhs);
 
-		for (typename DataPacker<T_CryptoProvider>::PackedData::const_iterator lhsIterator = lhs.begin(); lhsIterator != lhs.end(); ++lhsIterator) {
-			output.emplace_back(*lhsIterator * rhs);
-		}
+		std::vector<typename T_CryptoProvider::Ciphertext> products = this->cryptoProvider.BatchMultiply(lhsVector, scalars);
 
-		return output;
+		return typename DataPacker<T_CryptoProvider>::PackedData(std::make_move_iterator(products.begin()), std::make_move_iterator(products.end()));
 	}
 	
 	/**
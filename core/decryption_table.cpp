@@ -0,0 +1,432 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/decryption_table.cpp
+@brief Implementation of class DecryptionTable.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "decryption_table.h"
+
+//include C++ libraries
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <iomanip>
+
+//include system headers
+#if defined(_WIN32)
+	#include <fcntl.h>
+	#include <io.h>
+	#include <sys/stat.h>
+#else
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+//include boost libraries
+#include <boost/filesystem.hpp>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	The table is empty and all lookups fail.
+	*/
+	DecryptionTable::DecryptionTable () :
+		first(0),
+		count(0),
+		mask(0),
+		slots(NULL) {
+	}
+
+	/**
+	If cacheDirectory is not empty, the table is mapped from its cache file. When the file does not exist (or it doesn't match the parameters),
+	the table is built and the file is (re)written.
+
+	@param base the base (smaller than n)
+	@param n the modulus
+	@param first the smallest exponent (may be negative, if base is invertible modulo n)
+	@param count the number of exponents (the order of base must not be smaller)
+	@param cacheDirectory the directory of the cache files (empty disables the cache)
+	@throws std::runtime_error count is 0, the truncated residues collide or the cache file can't be written
+	*/
+	DecryptionTable::DecryptionTable (const BigInteger &base, const BigInteger &n, const long first, const size_t count, const std::string &cacheDirectory) :
+		first(first),
+		count(count),
+		mask(0),
+		slots(NULL) {
+		if (0 == count) {
+			throw std::runtime_error("The decryption table must contain at least one exponent.");
+		}
+
+		if (cacheDirectory.empty()) {
+			this->build(base, n);
+
+			return;
+		}
+
+		std::string key = DecryptionTable::getKey(base, n, first, count);
+		std::string path = DecryptionTable::GetPath(cacheDirectory, base, n, first, count);
+
+		if (!this->load(path, key, base, n)) {
+			this->build(base, n);
+			this->save(path, key);
+		}
+	}
+
+	/**
+	Used by the crypto providers which don't encode the plaintexts as powers of a base (e.g. elliptic curve ElGamal, which maps an encoded plaintext to a residue).
+	The table is not cached.
+
+	@param residues the residues of the exponents first, first + 1, ...
+	@param first the smallest exponent
+	@throws std::runtime_error residues is empty or the truncated residues collide
+	*/
+	DecryptionTable::DecryptionTable (const std::vector<BigInteger> &residues, const long first) :
+		first(first),
+		count(residues.size()),
+		mask(0),
+		slots(NULL) {
+		if (residues.empty()) {
+			throw std::runtime_error("The decryption table must contain at least one exponent.");
+		}
+
+		std::vector<uint64_t> keys(this->count);
+		for (size_t i = 0; i < this->count; ++i) {
+			keys[i] = DecryptionTable::truncate(residues[i]);
+		}
+
+		this->insert(keys);
+	}
+
+	/**
+	Expected cost: one truncation and less than 2 slot comparisons (the table is at most half full).
+
+	@param residue the residue, @f$ base^{exponent} \pmod n @f$
+	@param exponent receives the exponent
+	@return true if the residue is in the table, false otherwise
+	*/
+	bool DecryptionTable::Find (const BigInteger &residue, long &exponent) const {
+		if (NULL == this->slots) {
+			return false;
+		}
+
+		uint64_t key = DecryptionTable::truncate(residue);
+
+		for (size_t slot = this->getSlot(key); 0 != this->slots[slot].value; slot = (slot + 1) & this->mask) {
+			if (this->slots[slot].key == key) {
+				exponent = this->first + static_cast<long>(this->slots[slot].value - 1);
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	@return true if the table was not built, false otherwise
+	*/
+	bool DecryptionTable::IsEmpty () const {
+		return NULL == this->slots;
+	}
+
+	/**
+	@return true if the table was mapped from the cache directory, false otherwise
+	*/
+	bool DecryptionTable::IsMapped () const {
+		return NULL != this->region;
+	}
+
+	/**
+	The file name is the hexadecimal hash of the parameters, so each key gets its own table.
+
+	@param directory the directory of the cache files
+	@param base the base
+	@param n the modulus
+	@param first the smallest exponent
+	@param count the number of exponents
+	@return directory/<parameters hash>.table
+	*/
+	std::string DecryptionTable::GetPath (const std::string &directory, const BigInteger &base, const BigInteger &n, const long first, const size_t count) {
+		std::ostringstream path;
+		path << directory << "/" << std::hex << std::setw(16) << std::setfill('0') << PrecomputationStore::HashKey(DecryptionTable::getKey(base, n, first, count)) << ".table";
+
+		return path.str();
+	}
+
+	/**
+	The exponents are split into one range per thread of the WorkerPool. Each range starts with @f$ base^{begin} \pmod n @f$ and the following residues
+	are computed by multiplying with base, so the table costs one modular multiplication per entry. The truncated residues are then inserted
+	into the hash table on the calling thread (which is cheap compared to the multiplications).
+
+	@param base the base
+	@param n the modulus
+	@throws std::runtime_error the truncated residues collide
+	*/
+	void DecryptionTable::build (const BigInteger &base, const BigInteger &n) {
+		std::vector<uint64_t> keys(this->count);
+		//small tables are not worth splitting
+		size_t rangeCount = std::min(this->count / 1024 + 1, WorkerPool::GetInstance().GetThreadCount());
+
+		WorkerPool::GetInstance().ParallelFor(rangeCount, [this, &base, &n, &keys, rangeCount] (const size_t range) {
+			size_t begin = this->count * range / rangeCount;
+			size_t end = this->count * (range + 1) / rangeCount;
+
+			BigInteger power = DecryptionTable::getPowModN(base, this->first + static_cast<long>(begin), n);
+			for (size_t i = begin; i < end; ++i) {
+				keys[i] = DecryptionTable::truncate(power);
+				BigInteger::MulModN(power, power, base, n);
+			}
+		});
+
+		this->insert(keys);
+	}
+
+	/**
+	The table gets the smallest power of 2 number of slots which keeps it at most half full.
+
+	@param keys the truncated residues of the exponents first, first + 1, ...
+	@throws std::runtime_error the truncated residues collide
+	*/
+	void DecryptionTable::insert (const std::vector<uint64_t> &keys) {
+		size_t slotCount = 2;
+		while (slotCount < 2 * this->count) {
+			slotCount <<= 1;
+		}
+		this->mask = slotCount - 1;
+
+		std::shared_ptr<std::vector<Entry>> entries = std::make_shared<std::vector<Entry>>(slotCount);
+		for (size_t i = 0; i < this->count; ++i) {
+			size_t slot = this->getSlot(keys[i]);
+			while (0 != (*entries)[slot].value) {
+				if ((*entries)[slot].key == keys[i]) {
+					throw std::runtime_error("The residues of the decryption table collide.");
+				}
+				slot = (slot + 1) & this->mask;
+			}
+
+			(*entries)[slot].key = keys[i];
+			(*entries)[slot].value = i + 1;
+		}
+
+		this->entries = entries;
+		this->slots = &(*entries)[0];
+	}
+
+	/**
+	Besides the header, the entries of the first and the last exponents are checked, which costs two exponentiations.
+
+	@param path the cache file
+	@param key the cache key
+	@param base the base
+	@param n the modulus
+	@return true if the file was mapped, false if it does not exist or it doesn't match the parameters
+	*/
+	bool DecryptionTable::load (const std::string &path, const std::string &key, const BigInteger &base, const BigInteger &n) {
+		if (!PrecomputationStore::Exists(path)) {
+			return false;
+		}
+
+		boost::interprocess::file_mapping mapping(path.c_str(), boost::interprocess::read_only);
+		std::shared_ptr<boost::interprocess::mapped_region> region = std::make_shared<boost::interprocess::mapped_region>(mapping, boost::interprocess::read_only);
+
+		if (region->get_size() < DecryptionTable::headerSize) {
+			return false;
+		}
+
+		const unsigned char *header = static_cast<const unsigned char *>(region->get_address());
+		uint32_t version;
+		uint64_t keyHash;
+		int64_t first;
+		uint64_t count;
+		uint64_t slotCount;
+		std::memcpy(&version, header + 8, sizeof(version));
+		std::memcpy(&keyHash, header + 16, sizeof(keyHash));
+		std::memcpy(&first, header + 24, sizeof(first));
+		std::memcpy(&count, header + 32, sizeof(count));
+		std::memcpy(&slotCount, header + 40, sizeof(slotCount));
+
+		if (std::string(reinterpret_cast<const char *>(header), 8) != DECRYPTION_TABLE_MAGIC || DECRYPTION_TABLE_VERSION != version || PrecomputationStore::HashKey(key) != keyHash
+			|| this->first != first || this->count != count || 0 == slotCount || 0 != (slotCount & (slotCount - 1))
+			|| region->get_size() != DecryptionTable::headerSize + slotCount * sizeof(Entry)) {
+			return false;
+		}
+
+		this->mask = static_cast<size_t>(slotCount - 1);
+		this->slots = reinterpret_cast<const Entry *>(header + DecryptionTable::headerSize);
+
+		long lastExponent = this->first + static_cast<long>(this->count) - 1;
+		long exponent;
+		if (!this->Find(DecryptionTable::getPowModN(base, this->first, n), exponent) || this->first != exponent
+			|| !this->Find(DecryptionTable::getPowModN(base, lastExponent, n), exponent) || lastExponent != exponent) {
+			this->mask = 0;
+			this->slots = NULL;
+
+			return false;
+		}
+
+		this->region = region;
+
+		return true;
+	}
+
+	/**
+	The table is written to a temporary file, which then replaces the cache file. The temporary file gets a unique name, so concurrent builders of
+	the same table don't overwrite each other's file, and it is created exclusively, readable and writable only by its owner.
+
+	@param path the cache file
+	@param key the cache key
+	@throws std::runtime_error the file can't be written
+	*/
+	void DecryptionTable::save (const std::string &path, const std::string &key) const {
+		unsigned char header[DecryptionTable::headerSize] = {0};
+		uint32_t version = DECRYPTION_TABLE_VERSION;
+		uint64_t keyHash = PrecomputationStore::HashKey(key);
+		int64_t first = this->first;
+		uint64_t count = this->count;
+		uint64_t slotCount = this->mask + 1;
+		std::string(DECRYPTION_TABLE_MAGIC).copy(reinterpret_cast<char *>(header), 8);
+		std::memcpy(header + 8, &version, sizeof(version));
+		std::memcpy(header + 16, &keyHash, sizeof(keyHash));
+		std::memcpy(header + 24, &first, sizeof(first));
+		std::memcpy(header + 32, &count, sizeof(count));
+		std::memcpy(header + 40, &slotCount, sizeof(slotCount));
+
+		std::string temporaryPath = boost::filesystem::unique_path(path + ".%%%%-%%%%-%%%%-%%%%.tmp").string();
+
+	#if defined(_WIN32)
+		int file = _open(temporaryPath.c_str(), _O_WRONLY | _O_CREAT | _O_EXCL | _O_BINARY, _S_IREAD | _S_IWRITE);
+	#else
+		int file = open(temporaryPath.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0600);
+	#endif
+		if (-1 == file) {
+			throw std::runtime_error("Can't create the decryption table cache.");
+		}
+
+		bool written = DecryptionTable::writeFile(file, header, DecryptionTable::headerSize) && DecryptionTable::writeFile(file, reinterpret_cast<const unsigned char *>(this->slots), slotCount * sizeof(Entry));
+	#if defined(_WIN32)
+		written = 0 == _close(file) && written;
+
+		//rename doesn't replace an existing file on Windows (the file being replaced doesn't match the parameters)
+		std::remove(path.c_str());
+	#else
+		written = 0 == close(file) && written;
+	#endif
+
+		if (!written || 0 != std::rename(temporaryPath.c_str(), path.c_str())) {
+			std::remove(temporaryPath.c_str());
+
+			throw std::runtime_error("Can't write the decryption table cache.");
+		}
+	}
+
+	/**
+	Retries the writes which are interrupted or which write only a part of the data.
+
+	@param file the file descriptor
+	@param data the data
+	@param byteCount the number of bytes
+	@return true if all the bytes were written, false otherwise
+	*/
+	bool DecryptionTable::writeFile (const int file, const unsigned char *data, size_t byteCount) {
+		//the size of a single write is capped, since _write takes an unsigned int
+		const size_t maximumWriteSize = static_cast<size_t>(1) << 30;
+
+		while (byteCount > 0) {
+		#if defined(_WIN32)
+			int written = _write(file, data, static_cast<unsigned int>(std::min(byteCount, maximumWriteSize)));
+		#else
+			ssize_t written = write(file, data, std::min(byteCount, maximumWriteSize));
+		#endif
+			if (written < 0) {
+				if (EINTR == errno) {
+					continue;
+				}
+
+				return false;
+			}
+
+			data += written;
+			byteCount -= static_cast<size_t>(written);
+		}
+
+		return true;
+	}
+
+	/**
+	The residues are not uniformly distributed in their lowest bits for every base (e.g. small bases), so the key is mixed before it is reduced to a slot index.
+
+	@param key the truncated residue
+	@return The index of the first slot.
+	*/
+	size_t DecryptionTable::getSlot (const uint64_t key) const {
+		return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 16) & this->mask;
+	}
+
+	/**
+	@param base the base
+	@param n the modulus
+	@param first the smallest exponent
+	@param count the number of exponents
+	@return The cache key.
+	*/
+	std::string DecryptionTable::getKey (const BigInteger &base, const BigInteger &n, const long first, const size_t count) {
+		std::ostringstream key;
+		key << "DecryptionTable:base=" << base.ToString(16) << ",n=" << n.ToString(16) << ",first=" << first << ",count=" << count;
+
+		return key.str();
+	}
+
+	/**
+	@param residue the residue
+	@return The lowest 64 bits of residue.
+	*/
+	uint64_t DecryptionTable::truncate (const BigInteger &residue) {
+		uint64_t output = residue.ToUnsignedLong();
+
+		//unsigned long has only 32 bits on some platforms (e.g. Windows)
+		if (sizeof(unsigned long) < sizeof(uint64_t)) {
+			output = (output & 0xFFFFFFFFULL) | (static_cast<uint64_t>((residue >> 32).ToUnsignedLong()) << 32);
+		}
+
+		return output;
+	}
+
+	/**
+	@param base the base
+	@param exponent the exponent
+	@param n the modulus
+	@return @f$ base^{exponent} \pmod n @f$
+	@throws std::runtime_error the exponent is negative and base is not invertible modulo n
+	*/
+	BigInteger DecryptionTable::getPowModN (const BigInteger &base, const long exponent, const BigInteger &n) {
+		if (exponent < 0) {
+			return base.GetInverseModN(n).GetPowModN(-exponent, n);
+		}
+
+		return base.GetPowModN(exponent, n);
+	}
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
@@ -0,0 +1,168 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/decryption_table.h
+@brief Definition of class DecryptionTable.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef DECRYPTION_TABLE_HEADER_GUARD
+#define DECRYPTION_TABLE_HEADER_GUARD
+
+//include our headers
+#include "big_integer.h"
+#include "precomputation_store.h"
+#include "worker_pool.h"
+
+//include C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//include boost libraries
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief The first 8 bytes of a decryption table cache file.
+	*/
+	#define DECRYPTION_TABLE_MAGIC "SCLDTABL"
+
+	/**
+	@brief The version of the decryption table cache file layout.
+	*/
+	#define DECRYPTION_TABLE_VERSION 1
+
+	/**
+	@brief Discrete logarithm lookup table for small exponents, @f$ base^i \pmod n \mapsto i @f$ for @f$ i \in [first, first + count) @f$
+
+	Replaces the std::map based decryption maps of the crypto providers which decrypt by looking up @f$ g^m @f$ (DGK, ElGamal) or @f$ m G @f$ (elliptic curve ElGamal).
+	The table is an open addressing hash table (linear probing, at most half full) of 16 byte entries: the lowest 64 bits of the residue and the exponent.
+	Only the truncated residue is compared, so a lookup touches a single entry in most cases and the table does not depend on the size of the modulus.
+	The truncated residues of the table are distinct (this is checked when the table is built), but a residue which is not in the table is
+	reported as found when its lowest 64 bits match those of a table entry, with a probability of about @f$ count / 2^{64} @f$.
+
+	The entries are computed by successive modular multiplications, on the threads of the WorkerPool (each thread starts its own range with one exponentiation).
+
+	When a cache directory is specified, the table is stored in a file named after the hash of the base, the modulus and the exponent range,
+	which is memory-mapped (read only) by the tables built later for the same parameters instead of computing them again.
+	The file contains data derived from the private key, so it must be protected like the private key.
+	Cache file layout: a header (magic, version, key hash, first exponent, exponent count, number of slots) followed by the slots, in the byte order of the host
+	(the cache is not meant to be moved between machines).
+
+	The tables are immutable, so copies share the same entries.
+	*/
+	class DecryptionTable {
+	public:
+		/// Default constructor (empty table)
+		DecryptionTable ();
+
+		/// Builds the table (or loads it from the cache directory)
+		DecryptionTable (const BigInteger &base, const BigInteger &n, const long first, const size_t count, const std::string &cacheDirectory = "");
+
+		/// Builds the table from precomputed residues (of consecutive exponents)
+		DecryptionTable (const std::vector<BigInteger> &residues, const long first);
+
+		/// Destructor - void implementation
+		~DecryptionTable () {}
+
+		/// Finds the exponent of residue
+		bool Find (const BigInteger &residue, long &exponent) const;
+
+		/// Returns true if the table was not built
+		bool IsEmpty () const;
+
+		/// Returns true if the table was mapped from the cache directory
+		bool IsMapped () const;
+
+		/// Returns the path of the cache file of the table with the given parameters, inside directory
+		static std::string GetPath (const std::string &directory, const BigInteger &base, const BigInteger &n, const long first, const size_t count);
+
+	private:
+		/// @brief A slot of the hash table
+		struct Entry {
+			/// The lowest 64 bits of the residue
+			uint64_t key;
+
+			/// The exponent minus first plus 1 (0 marks an empty slot)
+			uint64_t value;
+		};
+
+		/// The size of the cache file header
+		static const size_t headerSize = 48;
+
+		/// The first exponent
+		long first;
+
+		/// The number of exponents
+		size_t count;
+
+		/// The number of slots minus 1 (the number of slots is a power of 2)
+		size_t mask;
+
+		/// The slots, when the table was built in memory
+		std::shared_ptr<const std::vector<Entry>> entries;
+
+		/// The mapped cache file, when the table was loaded from the cache directory
+		std::shared_ptr<const boost::interprocess::mapped_region> region;
+
+		/// Points to the first slot (inside entries or region)
+		const Entry *slots;
+
+		/// Computes the slots
+		void build (const BigInteger &base, const BigInteger &n);
+
+		/// Inserts the truncated residues into the slots
+		void insert (const std::vector<uint64_t> &keys);
+
+		/// Maps the cache file, if it exists and it matches the parameters
+		bool load (const std::string &path, const std::string &key, const BigInteger &base, const BigInteger &n);
+
+		/// Writes the cache file
+		void save (const std::string &path, const std::string &key) const;
+
+		/// Returns the index of the first slot probed for key
+		size_t getSlot (const uint64_t key) const;
+
+		/// Writes byteCount bytes to an open file descriptor
+		static bool writeFile (const int file, const unsigned char *data, size_t byteCount);
+
+		/// Returns the cache key of the table with the given parameters
+		static std::string getKey (const BigInteger &base, const BigInteger &n, const long first, const size_t count);
+
+		/// Returns the lowest 64 bits of a (non-negative) residue
+		static uint64_t truncate (const BigInteger &residue);
+
+		/// Computes @f$ base^{exponent} \pmod n @f$, for a possibly negative exponent
+		static BigInteger getPowModN (const BigInteger &base, const long exponent, const BigInteger &n);
+	};
+}//namespace Core
+}//namespace SeComLib
+
+#endif//DECRYPTION_TABLE_HEADER_GUARD
\ No newline at end of file
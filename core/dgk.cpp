@@ -56,6 +56,14 @@ namespace Core {
 		CiphertextBase<DgkCiphertext> (data, encryptionModulus) {
 	}
 
+	/**
+	@param data the ciphertext data, moved into the current instance
+	@param encryptionModulus The encryption modulus
+	*/
+	DgkCiphertext::DgkCiphertext (BigInteger &&data, const std::shared_ptr<BigInteger> &encryptionModulus) :
+		CiphertextBase<DgkCiphertext> (std::move(data), encryptionModulus) {
+	}
+
 	/**
 	*/
 	DgkRandomizer::DgkRandomizer () : RandomizerBase() {
@@ -68,6 +76,13 @@ namespace Core {
 	DgkRandomizer::DgkRandomizer (const BigInteger &data) : RandomizerBase(data) {
 	}
 
+	/**
+	Takes over the data
+	@param data the randomizer data
+	*/
+	DgkRandomizer::DgkRandomizer (BigInteger &&data) : RandomizerBase(std::move(data)) {
+	}
+
 	/**
 	Sets the specified key size from the configuration file (defaults to 1024).
 	
@@ -113,6 +128,13 @@ namespace Core {
 		this->doPrecomputations();
 	}
 
+	/**
+	Stops the producer threads of the randomizer cache before the members they use are destroyed.
+	*/
+	Dgk::~Dgk () {
+		this->randomizerCache.reset();
+	}
+
 	/**
 	* Generates the public and private keys via the generateKeys private method and ensures that they are successfully generated.
 	*
@@ -159,15 +181,18 @@ namespace Core {
 	* @throws std::runtime_error parameter errors.
 	*/
 	bool Dgk::GenerateKeys() {
+		//stop the producer threads of the randomizer cache before the keys change
+		this->randomizerCache.reset();
+
 		/// Generate @f$ u @f$ as the smallest prime having more than @f$ \ell + 2 @f$ bits.
 		this->publicKey.u = BigInteger(2).GetPow(this->l + 2).GetNextPrime();
 
 		//std::cout << "Message space: " << this->publicKey.u.ToString(10).c_str() << std::endl;
 
 		/// Generate @f$ v_p @f$ and @f$ v_q @f$, two t bit primes.
-		this->privateKey.vp = RandomProvider::GetInstance().GetMaxLengthRandomPrime(this->t);
+		this->privateKey.vp = PrimeSearch::GetMaxLengthRandomPrime(this->t);
 		do {
-			this->privateKey.vq = RandomProvider::GetInstance().GetMaxLengthRandomPrime(this->t);
+			this->privateKey.vq = PrimeSearch::GetMaxLengthRandomPrime(this->t);
 		}
 		/// We need to prevent @f$ v_p @f$ and @f$ v_q @f$ from dividing both p - 1 and q - 1, so we ensure that @f$ v_p \neq v_q @f$.
 		/// Otherwise, one could compute @f$ a = (n - 1) / u^j @f$, where @f$ u^j @f$ is the maximal power of @f$ u @f$ that divides @f$ n - 1@f$, and, thus, it can be determined which numbers have order @f$ a @f$ in @f$ H @f$.
@@ -191,14 +216,8 @@ namespace Core {
 			throw std::runtime_error("Parameter k is too small.");
 		}
 
-		do {
-			//generate a prime number in the interval [0, 2^sizeRand)
-			pRand = RandomProvider::GetInstance().GetMaxLengthRandomPrime(sizeRand);
-
-			//p = pRand * 2 * u * vp + 1
-			this->privateKey.p = pRand * aux + 1;
-		}
-		while (!this->privateKey.p.IsPrime());
+		//p = pRand * 2 * u * vp + 1, where pRand is a prime in the interval [2^(sizeRand - 1), 2^sizeRand)
+		this->privateKey.p = PrimeSearch::GetLinearFormPrime(pRand, aux, sizeRand, true);
 
 		//precompute 2 * u * vq
 		aux = BigInteger(2) * this->publicKey.u * this->privateKey.vq;
@@ -210,14 +229,8 @@ namespace Core {
 			throw std::runtime_error("Parameter k is too small.");
 		}
 
-		do {
-			//generate a prime number in the interval [0, 2^sizeRand)
-			qRand = RandomProvider::GetInstance().GetMaxLengthRandomPrime(sizeRand);
-			
-			//q = qRand * 2 * u * vq + 1
-			this->privateKey.q = qRand * aux + 1;
-		}
-		while (!this->privateKey.q.IsPrime());
+		//q = qRand * 2 * u * vq + 1, where qRand is a prime in the interval [2^(sizeRand - 1), 2^sizeRand)
+		this->privateKey.q = PrimeSearch::GetLinearFormPrime(qRand, aux, sizeRand, true);
 
 		/// Compute @f$ n = p q @f$
 		this->publicKey.n = this->privateKey.p * this->privateKey.q;
@@ -298,7 +311,8 @@ namespace Core {
 	}
 
 	/**
-	If @f$ plaintext \geq \lfloor messagespace / 2 @f$, it is remapped to a negative value.
+	The plaintexts are in @f$ (-u / 2, u / 2) @f$, so @f$ plaintext > \lfloor messagespace / 2 \rfloor @f$ is returned as a negative value.
+	If the decryption table holds fewer values than @f$ u @f$ (Core.Dgk.babyStepCount), the lookup takes up to @f$ \lceil u / babyStepCount \rceil @f$ giant steps.
 
 	@param ciphertext the ciphertext integer
 	@return Deciphered plaintext
@@ -316,7 +330,7 @@ namespace Core {
 		}
 
 		/// @f$ m @f$ is uniquely determined by either @f$ E_{pk}(m,r)^{v_p} = g^{v_p m} \pmod p @f$ or @f$ E_{pk}(m,r)^{v_q} = g^{v_q m} \pmod q @f$.
-		/// Since we cannot determine @f$ m @f$ directly, we precompute all @f$ g^{v_p m} \pmod p @f$ values, we store them in an std::map and we try to find m that matches @f$ c^{v_p} \pmod p @f$
+		/// Since we cannot determine @f$ m @f$ directly, we precompute all @f$ g^{v_p m} \pmod p @f$ values, we store them in a DecryptionTable and we try to find m that matches @f$ c^{v_p} \pmod p @f$
 
 		BigInteger cPowVpModP = ciphertext.data.GetPowModN(this->privateKey.vp, this->privateKey.p);
 
@@ -325,26 +339,13 @@ namespace Core {
 			return 0;
 		}
 
-		BigInteger output;
-
-		//get an iterator to the required element
-		DecryptionMap::const_iterator iterator = this->decryptionMap.find(cPowVpModP);
-
-		//make sure the key exists
-		if (this->decryptionMap.end() != iterator) {
-			output = BigInteger(iterator->second);
-		}
-		else {
+		long exponent;
+		if (!this->decryptionTable.Find(cPowVpModP, exponent)) {
 			//@todo custom exception
 			throw std::runtime_error("Can't decrypt ciphertext.");
 		}
 
-		/// If @f$ plaintext < \lfloor messagespace / 2 \rfloor \Rightarrow plaintext \geq 0 @f$ otherwise if @f$ plaintext < 0 \Rightarrow plaintext = plaintext - messageSpaceUpperBound  @f$
-		if (output > this->positiveNegativeBoundary) {
-			output -= this->GetMessageSpaceUpperBound();
-		}
-
-		return output;
+		return BigInteger(exponent);
 	}
 
 	/**
@@ -374,19 +375,22 @@ namespace Core {
 		if (!this->hasPrivateKey) {
 			/// Standard version: @f$ c_{nonrand} = g^m \pmod n @f$
 			if (plaintext < 0) {
-				output.data = this->publicKey.g.GetPowModN(this->GetMessageSpaceUpperBound() + plaintext, this->publicKey.n);
+				output.data = this->gTable.GetPowModN(this->GetMessageSpaceUpperBound() + plaintext);
 			}
 			else {
-				output.data = this->publicKey.g.GetPowModN(plaintext, this->publicKey.n);
+				output.data = this->gTable.GetPowModN(plaintext);
 			}
 		}
 		else {
 			/// Fast version: @f$ c_{nonrand} = (g^m \bmod p) q (q^{-1}\bmod p) + (g^m \bmod q) p (p^{-1}\bmod q) \pmod n @f$
 			if (plaintext < 0) {
-				output.data = (this->publicKey.g.GetPowModN(this->GetMessageSpaceUpperBound() + plaintext, this->privateKey.p) * this->qTimesQInvModP + this->publicKey.g.GetPowModN(this->GetMessageSpaceUpperBound() + plaintext, this->privateKey.q) * this->pTimesPInvModQ) % this->publicKey.n;
+				BigInteger exponent = this->GetMessageSpaceUpperBound() + plaintext;
+				output.data = this->gModQTable.GetPowModN(exponent) * this->pTimesPInvModQ;
+				BigInteger::MulAddModN(output.data, this->gModPTable.GetPowModN(exponent), this->qTimesQInvModP, output.data, this->publicKey.n);
 			}
 			else {
-				output.data = (this->publicKey.g.GetPowModN(plaintext, this->privateKey.p) * this->qTimesQInvModP + this->publicKey.g.GetPowModN(plaintext, this->privateKey.q) * this->pTimesPInvModQ) % this->publicKey.n;
+				output.data = this->gModQTable.GetPowModN(plaintext) * this->pTimesPInvModQ;
+				BigInteger::MulAddModN(output.data, this->gModPTable.GetPowModN(plaintext), this->qTimesQInvModP, output.data, this->publicKey.n);
 			}
 		}
 
@@ -420,11 +424,14 @@ namespace Core {
 
 		if (!this->hasPrivateKey) {
 			/// "Standard" version: @f$ h^r \pmod n @f$
-			return Randomizer(this->publicKey.h.GetPowModN(random, this->publicKey.n));
+			return Randomizer(this->hTable.GetPowModN(random));
 		}
 		else {
 			/// "Shortcut" version: @f$ h^r \pmod {n} = (h^r \bmod p) q (q^{-1}\bmod p) + (h^r \bmod q) p (p^{-1}\bmod q) \pmod n @f$
-			return Randomizer((this->publicKey.h.GetPowModN(random, this->privateKey.p) * this->qTimesQInvModP + this->publicKey.h.GetPowModN(random, this->privateKey.q) * this->pTimesPInvModQ) % this->publicKey.n);
+			BigInteger output = this->hModQTable.GetPowModN(random) * this->pTimesPInvModQ;
+			BigInteger::MulAddModN(output, this->hModPTable.GetPowModN(random), this->qTimesQInvModP, output, this->publicKey.n);
+
+			return Randomizer(std::move(output));
 		}
 	}
 
@@ -435,7 +442,10 @@ namespace Core {
 	@return The randomized ciphertext
 	*/
 	Dgk::Ciphertext Dgk::RandomizeCiphertext (const Dgk::Ciphertext &ciphertext) const {
-		return Ciphertext((ciphertext.data * this->randomizerCache->Pop().randomizer.data) % this->GetEncryptionModulus(), this->encryptionModulus);
+		Ciphertext output(this->encryptionModulus);
+		BigInteger::MulModN(output.data, ciphertext.data, this->randomizerCache->Pop().randomizer.data, this->GetEncryptionModulus());
+
+		return output;
 	}
 
 	/**
@@ -452,6 +462,13 @@ namespace Core {
 		return this->publicKey.u.GetSize();
 	}
 
+	/**
+	@return The provider name and the hexadecimal public key components.
+	*/
+	std::string Dgk::GetPublicKeyFingerprint () const {
+		return "Dgk:n=" + this->publicKey.n.ToString(16) + ",g=" + this->publicKey.g.ToString(16) + ",h=" + this->publicKey.h.ToString(16) + ",u=" + this->publicKey.u.ToString(16);
+	}
+
 	/**
 	If and only if @f$ m = 0 @f$, then both @f$ c^{v_p} \pmod p = 1 @f$ and @f$ c^{v_q} \pmod q = 1 @f$. It suffices to test only @f$ c^{v_p} \pmod p @f$.
 
@@ -470,6 +487,36 @@ namespace Core {
 		return test == 1 ? true : false;
 	}
 
+	/**
+	Only the giant steps which cover @f$ [lowerBound, upperBound] @f$ are taken, so a tight range (e.g. the sum of a few bounded values)
+	decrypts faster than DecryptInteger (const Ciphertext &) when the decryption table holds fewer values than @f$ u @f$.
+	The plaintexts are only determined modulo @f$ u @f$, so for a range larger than @f$ u @f$ the smallest matching value is returned.
+
+	@param ciphertext the ciphertext integer
+	@param lowerBound the smallest possible plaintext
+	@param upperBound the largest possible plaintext
+	@return Deciphered plaintext
+	@throws std::runtime_error the plaintext is not in the specified range or the bounds are reversed
+	@throws std::runtime_error operation requires the private key
+	@throws std::runtime_error operation requires the decryption map
+	*/
+	BigInteger Dgk::DecryptInteger (const Ciphertext &ciphertext, const long lowerBound, const long upperBound) const {
+		if (!this->hasPrivateKey) {
+			throw std::runtime_error("This operation requires the private key.");
+		}
+
+		if (!this->precomputeDecryptionMap) {
+			throw std::runtime_error("This operation requires the decryption map.");
+		}
+
+		long exponent;
+		if (!this->decryptionTable.Find(ciphertext.data.GetPowModN(this->privateKey.vp, this->privateKey.p), lowerBound, upperBound, exponent)) {
+			throw std::runtime_error("Can't decrypt ciphertext.");
+		}
+
+		return BigInteger(exponent);
+	}
+
 	/**
 	@throws std::runtime_error the configuration parameters are invalid
 	*/
@@ -502,16 +549,22 @@ namespace Core {
 	/**
 	Precomputes the message space delimiter between positive and negative values.
 
+	Builds the fixed-base tables for @f$ g @f$ and @f$ h @f$ (modulo @f$ p @f$ and @f$ q @f$ if the private key is available, otherwise modulo @f$ n @f$), each within the Core.FixedBaseTable.memoryBudget limit.
+
 	Precomputes [0] and [1].
 	*/
 	void Dgk::doPrecomputations () {
+		size_t memoryBudget = Utils::Config::GetInstance().GetParameter<size_t>("Core.FixedBaseTable.memoryBudget", 1024) * 1024;
+
 		if (this->hasPrivateKey) {
 			/// Precompute all possible values of @f$ g^{v_p m} \pmod p @f$ or @f$ g^{v_q m} \pmod q @f$ to speed up decryption, where @f$ m \in \mathbb{Z}_u @f$.
-			/// We choose to compute @f$ g^{v_p m} \pmod p @f$
+			/// We choose to compute @f$ g^{v_p m} \pmod p @f$, by successive multiplications with @f$ g^{v_p} \pmod p @f$, for @f$ m \in (-u / 2, u / 2) @f$
+			/// (all of them by default, or Core.Dgk.babyStepCount of them, in which case the decryption takes baby-step giant-step lookups)
 			if (this->precomputeDecryptionMap) {
-				for (BigInteger i = 0; i < this->publicKey.u; ++i) {
-					this->decryptionMap[this->publicKey.g.GetPowModN(this->privateKey.vp * i, this->privateKey.p)] = i;
-				}
+				std::string cacheDirectory = Utils::Config::GetInstance().GetParameter<std::string>("Core.DecryptionTable.cacheDirectory", "");
+				size_t babyStepCount = Utils::Config::GetInstance().GetParameter<size_t>("Core.Dgk.babyStepCount", 0);
+				long halfU = static_cast<long>(this->publicKey.u.ToUnsignedLong() / 2);
+				this->decryptionTable = BabyStepGiantStep(this->publicKey.g.GetPowModN(this->privateKey.vp, this->privateKey.p), this->privateKey.p, -halfU, halfU, babyStepCount, cacheDirectory);
 			}
 
 			/// Speed optimizations for encryption: compute @f$ p (p^{-1} \pmod q) @f$ and @f$ q (q^{-1} \pmod p) @f$
@@ -524,6 +577,16 @@ namespace Core {
 				//if gcd(p, q) != 1, throw an error
 				throw std::runtime_error("p and q are not coprime.");
 			}
+
+			/// Encryption exponents are smaller than @f$ u @f$ and randomizer exponents have @f$ 2 t @f$ bits
+			this->gModPTable = FixedBaseTable(this->publicKey.g, this->privateKey.p, this->publicKey.u.GetSize(), memoryBudget);
+			this->gModQTable = FixedBaseTable(this->publicKey.g, this->privateKey.q, this->publicKey.u.GetSize(), memoryBudget);
+			this->hModPTable = FixedBaseTable(this->publicKey.h, this->privateKey.p, 2 * this->t, memoryBudget);
+			this->hModQTable = FixedBaseTable(this->publicKey.h, this->privateKey.q, 2 * this->t, memoryBudget);
+		}
+		else {
+			this->gTable = FixedBaseTable(this->publicKey.g, this->publicKey.n, this->publicKey.u.GetSize(), memoryBudget);
+			this->hTable = FixedBaseTable(this->publicKey.h, this->publicKey.n, 2 * this->t, memoryBudget);
 		}
 
 		//set the encryption modulus, @f$ n @f$
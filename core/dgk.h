@@ -33,11 +33,13 @@ limitations under the License.
 #include "ciphertext_base.h"
 #include "crypto_provider.h"
 #include "random_provider.h"
+#include "prime_search.h"
+#include "fixed_base_table.h"
+#include "baby_step_giant_step.h"
 #include "utils/config.h"
 
 //include C++ headers
 #include <stdexcept>
-#include <map>
 
 namespace SeComLib {
 namespace Core {
@@ -84,6 +86,9 @@ namespace Core {
 
 		/// Constructor with data and encryption modulus initialization
 		DgkCiphertext (const BigInteger &data, const std::shared_ptr<BigInteger> &encryptionModulus);
+
+		/// Constructor with data (taken over) and encryption modulus initialization
+		DgkCiphertext (BigInteger &&data, const std::shared_ptr<BigInteger> &encryptionModulus);
 	};
 
 	/**
@@ -95,6 +100,9 @@ namespace Core {
 
 		/// Constructor with initialization
 		DgkRandomizer (const BigInteger &data);
+
+		/// Constructor with initialization (takes over the input)
+		DgkRandomizer (BigInteger &&data);
 	};
 
 	/**
@@ -114,7 +122,7 @@ namespace Core {
 		Dgk (const DgkPublicKey &publicKey, const DgkPrivateKey &privateKey, const bool precomputeDecryptionMap = false);
 
 		/// Destructor
-		~Dgk () {}
+		~Dgk ();
 
 		/* Base class methods */
 
@@ -140,15 +148,18 @@ namespace Core {
 		/// Returns the message space bit size
 		virtual size_t GetMessageSpaceSize () const;
 
+		/// Returns a string which identifies the public key
+		virtual std::string GetPublicKeyFingerprint () const;
+
 		/* /Base class methods */
 
 		/// Determines if ciphertext contains an encryption of 0 or not
 		bool IsEncryptedZero (const Ciphertext &ciphertext) const;
 
-	private:
-		/// std::map template specialization
-		typedef std::map<const BigInteger, BigInteger> DecryptionMap;
+		/// Decrypt a number which is known to lie in @f$ [lowerBound, upperBound] @f$
+		BigInteger DecryptInteger (const Ciphertext &ciphertext, const long lowerBound, const long upperBound) const;
 
+	private:
 		/// Parameter @f$ t @f$
 		const unsigned int t;
 
@@ -158,14 +169,27 @@ namespace Core {
 		/// If true, full decryptions are enabled and the decryption map is (pre)computed
 		bool precomputeDecryptionMap;
 
-		/// Contains all possible values of @f$ (g^{v_p v_q})^m \pmod n @f$, where @f$ m \in \mathbb{Z}_u @f$, and it is required for decryption.
-		DecryptionMap decryptionMap;
+		/// Finds @f$ m \in (-u / 2, u / 2) @f$ from @f$ g^{v_p m} \pmod p @f$ (a table of all the values, or of Core.Dgk.babyStepCount of them), and it is required for decryption.
+		BabyStepGiantStep decryptionTable;
 
 		/// Contains @f$ p (p^{-1} \pmod q) @f$
 		BigInteger pTimesPInvModQ;
 		/// Contains @f$ q (q^{-1} \pmod p) @f$
 		BigInteger qTimesQInvModP;
 
+		/// Fixed-base table for @f$ g \pmod n @f$ (used when the private key is not available)
+		FixedBaseTable gTable;
+		/// Fixed-base table for @f$ h \pmod n @f$ (used when the private key is not available)
+		FixedBaseTable hTable;
+		/// Fixed-base table for @f$ g \pmod p @f$
+		FixedBaseTable gModPTable;
+		/// Fixed-base table for @f$ g \pmod q @f$
+		FixedBaseTable gModQTable;
+		/// Fixed-base table for @f$ h \pmod p @f$
+		FixedBaseTable hModPTable;
+		/// Fixed-base table for @f$ h \pmod q @f$
+		FixedBaseTable hModQTable;
+
 		/* Base class methods */
 
 		/// Validate configuration parameters
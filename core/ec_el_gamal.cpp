@@ -0,0 +1,472 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/ec_el_gamal.cpp
+@brief Implementation of class EcElGamal.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "ec_el_gamal.h"
+
+namespace SeComLib {
+namespace Core {
+	/**
+	Initializes @f$ x @f$ and @f$ y @f$ with the point at infinity
+	*/
+	EcElGamalRandomizer::EcElGamalRandomizer () {
+	}
+
+	/**
+	@param x @f$ x @f$ value
+	@param y @f$ y @f$ value
+	*/
+	EcElGamalRandomizer::EcElGamalRandomizer (const EllipticCurve::Point &x, const EllipticCurve::Point &y) : x(x), y(y) {
+	}
+
+	/**
+	Takes over the data
+	@param x @f$ x @f$ value
+	@param y @f$ y @f$ value
+	*/
+	EcElGamalRandomizer::EcElGamalRandomizer (EllipticCurve::Point &&x, EllipticCurve::Point &&y) : x(std::move(x)), y(std::move(y)) {
+	}
+
+	/**
+	The randomizers are never the point at infinity (@f$ r \neq 0 @f$), so only the coordinates are stored.
+
+	@param record the record which receives the data
+	*/
+	void EcElGamalRandomizer::Serialize (PrecomputationStore::RecordWriter &record) const {
+		record.Write(this->x.x);
+		record.Write(this->x.y);
+		record.Write(this->y.x);
+		record.Write(this->y.y);
+	}
+
+	/**
+	@param record the precomputed record
+	*/
+	void EcElGamalRandomizer::Deserialize (PrecomputationStore::RecordReader &record) {
+		BigInteger xx = record.ReadBigInteger();
+		BigInteger xy = record.ReadBigInteger();
+		this->x = EllipticCurve::Point(std::move(xx), std::move(xy));
+
+		BigInteger yx = record.ReadBigInteger();
+		BigInteger yy = record.ReadBigInteger();
+		this->y = EllipticCurve::Point(std::move(yx), std::move(yy));
+	}
+
+	/**
+	The key length is the bit size of the order of the curve.
+
+	@param precomputeDecryptionMap Populate the decryption map, required to do full decryption (defaults to false)
+	*/
+	EcElGamal::EcElGamal (const bool precomputeDecryptionMap) : CryptoProvider<EcElGamalPublicKey, EcElGamalPrivateKey, EcElGamalCiphertext, EcElGamalRandomizer>(static_cast<unsigned int>(EllipticCurve::GetP256()->GetOrder().GetSize())),
+		curve(EllipticCurve::GetP256()),
+		messageSpaceThreshold(BigInteger(2).Pow(Utils::Config::GetInstance().GetParameter<unsigned long>("Core.EcElGamal.messageSpaceThresholdBitSize"))),
+		precomputeDecryptionMap(precomputeDecryptionMap) {
+	}
+
+	/**
+	Performs required precomputations.
+
+	@param publicKey a EcElGamalPublicKey structure
+	@throws std::runtime_error the public key is not a point of the curve
+	*/
+	EcElGamal::EcElGamal (const EcElGamalPublicKey &publicKey) : CryptoProvider<EcElGamalPublicKey, EcElGamalPrivateKey, EcElGamalCiphertext, EcElGamalRandomizer>(publicKey, static_cast<unsigned int>(EllipticCurve::GetP256()->GetOrder().GetSize())),
+		curve(EllipticCurve::GetP256()),
+		messageSpaceThreshold(BigInteger(2).Pow(Utils::Config::GetInstance().GetParameter<unsigned long>("Core.EcElGamal.messageSpaceThresholdBitSize"))),
+		precomputeDecryptionMap(false) {
+		//C++ doesn't allow us to call a virtual method in the constructor of the base class
+		this->doPrecomputations();
+	}
+
+	/**
+	Performs required precomputations.
+
+	@param publicKey a EcElGamalPublicKey structure
+	@param privateKey a EcElGamalPrivateKey structure
+	@param precomputeDecryptionMap Populate the decryption map, required to do full decryption (defaults to false)
+	@throws std::runtime_error the public key is not a point of the curve
+	*/
+	EcElGamal::EcElGamal (const EcElGamalPublicKey &publicKey, const EcElGamalPrivateKey &privateKey, const bool precomputeDecryptionMap) : CryptoProvider<EcElGamalPublicKey, EcElGamalPrivateKey, EcElGamalCiphertext, EcElGamalRandomizer>(publicKey, privateKey, static_cast<unsigned int>(EllipticCurve::GetP256()->GetOrder().GetSize())),
+		curve(EllipticCurve::GetP256()),
+		messageSpaceThreshold(BigInteger(2).Pow(Utils::Config::GetInstance().GetParameter<unsigned long>("Core.EcElGamal.messageSpaceThresholdBitSize"))),
+		precomputeDecryptionMap(precomputeDecryptionMap) {
+		//C++ doesn't allow us to call a virtual method in the constructor of the base class
+		this->doPrecomputations();
+	}
+
+	/**
+	Stops the producer threads of the randomizer cache before the members they use are destroyed.
+	*/
+	EcElGamal::~EcElGamal () {
+		this->randomizerCache.reset();
+	}
+
+	/**
+	Picks @f$ s \in [1, n) @f$ and computes @f$ H = s G @f$.
+
+	@return Always true, for now.
+	*/
+	bool EcElGamal::GenerateKeys () {
+		//stop the producer threads of the randomizer cache before the keys change
+		this->randomizerCache.reset();
+
+		/// Generate @f$ s \in \mathbb{Z}_n^* @f$
+		do {
+			this->privateKey.s = RandomProvider::GetInstance().GetRandomInteger(this->curve->GetOrder());
+		}
+		//s must be != 0
+		while (this->privateKey.s == 0);
+
+		/// @f$ H = s G @f$
+		this->publicKey.h = this->curve->Multiply(this->curve->GetGenerator(), this->privateKey.s);
+
+		//precompute values for optimization purposes
+		this->doPrecomputations();
+
+		return true;
+	}
+
+	/**
+	Computes @f$ M = y - s x = m G @f$ and looks up the key of @f$ M @f$ (its @f$ x @f$ coordinate and the parity of its @f$ y @f$ coordinate) in the decryption table.
+	Since @f$ -M @f$ has the same @f$ x @f$ coordinate and the opposite @f$ y @f$ parity (@f$ p @f$ is odd), the table only stores the positive plaintexts:
+	if the key of @f$ M @f$ is missing, the key with the flipped parity bit (the key of @f$ -M @f$) is looked up and the plaintext is negated.
+
+	@param ciphertext the ciphertext
+	@return Deciphered plaintext
+	@throws std::runtime_error the ciphertext can not be decrypted
+	@throws std::runtime_error operation requires the private key
+	@throws std::runtime_error the ciphertext points are not on the curve
+	*/
+	BigInteger EcElGamal::DecryptInteger (const EcElGamal::Ciphertext &ciphertext) const {
+		if (!this->hasPrivateKey) {
+			throw std::runtime_error("This operation requires the private key.");
+		}
+
+		if (!this->precomputeDecryptionMap) {
+			throw std::runtime_error("This operation requires the decryption map.");
+		}
+
+		EllipticCurve::Point encodedPlaintext = this->getEncodedPlaintext(ciphertext);
+
+		/// Shortcut: if @f$ M @f$ is the point at infinity, then @f$ c = [0] @f$
+		if (encodedPlaintext.infinity) {
+			return 0;
+		}
+
+		BigInteger key = EcElGamal::getDecryptionKey(encodedPlaintext);
+		long exponent;
+		if (this->decryptionTable.Find(key, exponent)) {
+			return BigInteger(exponent);
+		}
+
+		//the key of -M differs only in the lowest bit
+		if (this->decryptionTable.Find(encodedPlaintext.y.GetBit(0) != 0 ? key - 1 : key + 1, exponent)) {
+			return BigInteger(-exponent);
+		}
+
+		throw std::runtime_error("Can't decrypt ciphertext.");
+	}
+
+	/**
+	Negative plaintexts are reduced modulo @f$ n @f$ by the scalar multiplication.
+
+	@param plaintext the plaintext integer
+	@return The pair @f$ (\mathcal{O}, m G) @f$
+	*/
+	EcElGamal::Ciphertext EcElGamal::EncryptIntegerNonrandom (const BigInteger &plaintext) const {
+		/// Set @f$ x = \mathcal{O} @f$ (the point at infinity) and randomize it later (replace it with @f$ r G @f$)
+		return Ciphertext(EllipticCurve::Point(), this->gTable.Multiply(plaintext), this->curve);
+	}
+
+	/**
+	Generates a random integer @f$ r \in \mathbb{Z}_n^* @f$ and computes the randomization pair @f$ (r G, r H) @f$
+
+	@return the random factor
+	*/
+	EcElGamal::Randomizer EcElGamal::GetRandomizer () const {
+		BigInteger random;
+		do {
+			random = RandomProvider::GetInstance().GetRandomInteger(this->curve->GetOrder());
+		}
+		while (random == 0);
+
+		return Randomizer(this->gTable.Multiply(random), this->hTable.Multiply(random));
+	}
+
+	/**
+	Computes the pair @f$ (x + r G, y + r H) @f$
+
+	@param ciphertext the ciphertext
+	@return The randomized ciphertext
+	*/
+	EcElGamal::Ciphertext EcElGamal::RandomizeCiphertext (const EcElGamal::Ciphertext &ciphertext) const {
+		//assign a randomizer to the output (Pop returns the container by value, so the randomizer is moved out of it)
+		Randomizer randomizer = this->randomizerCache->Pop().randomizer;
+
+		return Ciphertext(this->curve->Add(ciphertext.data.x, randomizer.x), this->curve->Add(ciphertext.data.y, randomizer.y), this->curve);
+	}
+
+	/**
+	Computes @f$ [\sum_i ciphertexts_i \cdot scalars_i] = (\sum_i scalars_i x_i, \sum_i scalars_i y_i) @f$ term by term.
+
+	0 scalars are allowed (the corresponding terms are skipped). The output is not randomized.
+
+	@param ciphertexts the encrypted vector
+	@param scalars the plaintext vector
+	@return A new instance containing @f$ [\sum_i ciphertexts_i \cdot scalars_i] @f$
+	@throws std::runtime_error the two vectors have different sizes
+	*/
+	EcElGamal::Ciphertext EcElGamal::HomomorphicDotProduct (const std::vector<EcElGamal::Ciphertext> &ciphertexts, const std::vector<BigInteger> &scalars) const {
+		if (ciphertexts.size() != scalars.size()) {
+			throw std::runtime_error("The number of ciphertexts must be equal to the number of scalars.");
+		}
+
+		Ciphertext output(this->curve);
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			if (scalars[i] != 0) {
+				output = output + ciphertexts[i] * scalars[i];
+			}
+		}
+
+		return output;
+	}
+
+	/**
+	A point negation is a single modular subtraction, so there is nothing to batch.
+
+	@param ciphertexts the encrypted vector
+	@return A vector containing @f$ [-ciphertexts_i] @f$
+	*/
+	std::vector<EcElGamal::Ciphertext> EcElGamal::BatchNegate (const std::vector<EcElGamal::Ciphertext> &ciphertexts) const {
+		std::vector<Ciphertext> output;
+		output.reserve(ciphertexts.size());
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			output.push_back(-ciphertexts[i]);
+		}
+
+		return output;
+	}
+
+	/**
+	@param lhs left hand side encrypted vector
+	@param rhs right hand side encrypted vector
+	@return A vector containing @f$ [lhs_i - rhs_i] @f$
+	@throws std::runtime_error the two vectors have different sizes
+	*/
+	std::vector<EcElGamal::Ciphertext> EcElGamal::BatchSubtract (const std::vector<EcElGamal::Ciphertext> &lhs, const std::vector<EcElGamal::Ciphertext> &rhs) const {
+		if (lhs.size() != rhs.size()) {
+			throw std::runtime_error("The two ciphertext vectors must have the same size.");
+		}
+
+		std::vector<Ciphertext> output;
+		output.reserve(lhs.size());
+		for (size_t i = 0; i < lhs.size(); ++i) {
+			output.push_back(lhs[i] - rhs[i]);
+		}
+
+		return output;
+	}
+
+	/**
+	@param lhs left hand side ciphertext
+	@param rhs right hand side encrypted vector
+	@return A vector containing @f$ [lhs - rhs_i] @f$
+	*/
+	std::vector<EcElGamal::Ciphertext> EcElGamal::BatchSubtract (const EcElGamal::Ciphertext &lhs, const std::vector<EcElGamal::Ciphertext> &rhs) const {
+		std::vector<Ciphertext> output;
+		output.reserve(rhs.size());
+		for (size_t i = 0; i < rhs.size(); ++i) {
+			output.push_back(lhs - rhs[i]);
+		}
+
+		return output;
+	}
+
+	/**
+	@param lhs left hand side encrypted vector
+	@param rhs right hand side encrypted vector
+	@return A vector containing @f$ [lhs_i + rhs_i] @f$
+	@throws std::runtime_error the two vectors have different sizes
+	*/
+	std::vector<EcElGamal::Ciphertext> EcElGamal::BatchAdd (const std::vector<EcElGamal::Ciphertext> &lhs, const std::vector<EcElGamal::Ciphertext> &rhs) const {
+		if (lhs.size() != rhs.size()) {
+			throw std::runtime_error("The two ciphertext vectors must have the same size.");
+		}
+
+		std::vector<Ciphertext> output;
+		output.reserve(lhs.size());
+		for (size_t i = 0; i < lhs.size(); ++i) {
+			output.push_back(lhs[i] + rhs[i]);
+		}
+
+		return output;
+	}
+
+	/**
+	@param ciphertexts the encrypted vector
+	@param scalars the plaintext scalars (same size as ciphertexts, non-zero)
+	@return A vector containing @f$ [ciphertexts_i \cdot scalars_i] @f$
+	@throws std::runtime_error the two vectors have different sizes
+	@throws std::runtime_error one of the scalars is 0
+	*/
+	std::vector<EcElGamal::Ciphertext> EcElGamal::BatchMultiply (const std::vector<EcElGamal::Ciphertext> &ciphertexts, const std::vector<BigInteger> &scalars) const {
+		if (ciphertexts.size() != scalars.size()) {
+			throw std::runtime_error("The number of ciphertexts must be equal to the number of scalars.");
+		}
+
+		std::vector<Ciphertext> output;
+		output.reserve(ciphertexts.size());
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			output.push_back(ciphertexts[i] * scalars[i]);
+		}
+
+		return output;
+	}
+
+	/**
+	@return @f$ n @f$, the order of the curve
+	*/
+	const BigInteger &EcElGamal::GetMessageSpaceUpperBound () const {
+		return this->curve->GetOrder();
+	}
+
+	/**
+	@return The message space bit size.
+	*/
+	size_t EcElGamal::GetMessageSpaceSize () const {
+		return this->curve->GetOrder().GetSize();
+	}
+
+	/**
+	@return The provider name, the curve name and the hexadecimal coordinates of @f$ H @f$.
+	*/
+	std::string EcElGamal::GetPublicKeyFingerprint () const {
+		return "EcElGamal:curve=" + this->curve->GetName() + ",hx=" + this->publicKey.h.x.ToString(16) + ",hy=" + this->publicKey.h.y.ToString(16);
+	}
+
+	/**
+	If and only if @f$ m = 0 @f$, then @f$ y - s x @f$ is the point at infinity.
+
+	This is faster than the actual decryption, since the table lookup is not required.
+
+	@param ciphertext an elliptic curve ElGamal ciphertext
+	@return True if ciphertext = [0] and fase otherwise
+	@throws std::runtime_error the ciphertext points are not on the curve
+	*/
+	bool EcElGamal::IsEncryptedZero (const Ciphertext &ciphertext) const {
+		if (!this->hasPrivateKey) {
+			throw std::runtime_error("This operation requires the private key.");
+		}
+
+		return this->getEncodedPlaintext(ciphertext).infinity;
+	}
+
+	/**
+	@return The curve shared by the ciphertexts
+	*/
+	const std::shared_ptr<const EllipticCurve> &EcElGamal::GetCurve () const {
+		return this->curve;
+	}
+
+	/**
+	The points are checked first, since multiplying a point which is not on the curve by the private key (an invalid curve attack) would leak information about the key.
+
+	@param ciphertext an elliptic curve ElGamal ciphertext
+	@return @f$ y + (n - s) x @f$
+	@throws std::runtime_error the ciphertext points are not on the curve
+	*/
+	EllipticCurve::Point EcElGamal::getEncodedPlaintext (const Ciphertext &ciphertext) const {
+		if (!this->curve->IsOnCurve(ciphertext.data.x) || !this->curve->IsOnCurve(ciphertext.data.y)) {
+			throw std::runtime_error("The ciphertext is not a pair of points of the curve.");
+		}
+
+		return this->curve->Add(ciphertext.data.y, this->curve->Multiply(ciphertext.data.x, this->minusS));
+	}
+
+	/**
+	@param point a point of the curve, other than the point at infinity
+	@return @f$ 2 x + (y \bmod 2) @f$
+	*/
+	BigInteger EcElGamal::getDecryptionKey (const EllipticCurve::Point &point) {
+		return (point.x << 1) + BigInteger(point.y.GetBit(0));
+	}
+
+	/**
+	Checks the public key, builds the fixed-base tables for @f$ G @f$ and @f$ H @f$ and, if requested, the decryption table.
+	The encoded plaintexts are split into one range per thread of the WorkerPool: each range starts with a fixed-base multiplication and continues with point additions.
+
+	Precomputes [0] and [1].
+
+	@throws std::runtime_error the public key is not a point of the curve
+	*/
+	void EcElGamal::doPrecomputations () {
+		if (this->publicKey.h.infinity || !this->curve->IsOnCurve(this->publicKey.h)) {
+			throw std::runtime_error("The public key is not a point of the curve.");
+		}
+
+		//set the encryption modulus, @f$ p @f$ (the ciphertexts are points with coordinates in @f$ \mathbb{Z}_p @f$)
+		this->encryptionModulus = std::make_shared<BigInteger>(this->curve->GetFieldModulus());
+
+		this->gTable = EllipticCurvePointTable(this->curve, this->curve->GetGenerator());
+		this->hTable = EllipticCurvePointTable(this->curve, this->publicKey.h);
+
+		if (this->hasPrivateKey) {
+			this->minusS = this->curve->GetOrder() - this->privateKey.s;
+
+			/// Precompute the keys of @f$ m G @f$, where @f$ 0 < m < 2^t @f$ (the negative plaintexts are found by flipping the parity bit, see DecryptInteger)
+			if (this->precomputeDecryptionMap) {
+				size_t count = static_cast<size_t>(this->messageSpaceThreshold.ToUnsignedLong()) - 1;
+				std::vector<BigInteger> keys(count);
+				//small tables are not worth splitting
+				size_t rangeCount = std::min(count / 1024 + 1, WorkerPool::GetInstance().GetThreadCount());
+
+				WorkerPool::GetInstance().ParallelFor(rangeCount, [this, &keys, count, rangeCount] (const size_t range) {
+					size_t begin = count * range / rangeCount;
+					size_t end = count * (range + 1) / rangeCount;
+
+					EllipticCurve::Point encodedPlaintext = this->gTable.Multiply(BigInteger(static_cast<unsigned long>(begin + 1)));
+					for (size_t i = begin; i < end; ++i) {
+						keys[i] = EcElGamal::getDecryptionKey(encodedPlaintext);
+						encodedPlaintext = this->curve->Add(encodedPlaintext, this->curve->GetGenerator());
+					}
+				});
+
+				this->decryptionTable = DecryptionTable(keys, 1);
+			}
+		}
+
+		this->positiveNegativeBoundary = this->messageSpaceThreshold;
+
+		/// Populate the randomizer cache
+		this->randomizerCache = std::unique_ptr<RandomizerCacheType>(new RandomizerCacheType(*this, "Core.RandomizerCache"));
+
+		this->encryptedZero = this->EncryptInteger(BigInteger(0));
+
+		this->encryptedOne = this->EncryptInteger(BigInteger(1));
+	}
+
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
@@ -0,0 +1,215 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/ec_el_gamal.h
+@brief Definition of class EcElGamal.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef EC_EL_GAMAL_HEADER_GUARD
+#define EC_EL_GAMAL_HEADER_GUARD
+
+#include "big_integer.h"
+#include "random_provider.h"
+#include "crypto_provider.h"
+#include "utils/config.h"
+#include "elliptic_curve.h"
+#include "ec_el_gamal_ciphertext.h"
+#include "decryption_table.h"
+#include "worker_pool.h"
+
+//include C++ headers
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief The public key container structure for the elliptic curve ElGamal cryptosystem
+	*/
+	struct EcElGamalPublicKey {
+	public:
+		/// @f$ H = s G @f$
+		EllipticCurve::Point h;
+	};
+
+	/**
+	@brief The private key container structure for the elliptic curve ElGamal cryptosystem
+	*/
+	struct EcElGamalPrivateKey {
+	public:
+		/// @f$ s @f$
+		BigInteger s;
+	};
+
+	/**
+	@brief The randomizer type for elliptic curve ElGamal
+	*/
+	struct EcElGamalRandomizer {
+		/// @f$ r G @f$
+		EllipticCurve::Point x;
+
+		/// @f$ r H @f$
+		EllipticCurve::Point y;
+
+		/// Default constructor
+		EcElGamalRandomizer ();
+
+		/// Constructor with initialization
+		EcElGamalRandomizer (const EllipticCurve::Point &x, const EllipticCurve::Point &y);
+
+		/// Constructor with initialization (takes over the inputs)
+		EcElGamalRandomizer (EllipticCurve::Point &&x, EllipticCurve::Point &&y);
+
+		/// Serializes the data into a precomputed record
+		void Serialize (PrecomputationStore::RecordWriter &record) const;
+
+		/// Loads the data from a precomputed record
+		void Deserialize (PrecomputationStore::RecordReader &record);
+	};
+
+	/**
+	@brief Implementation of the public-key ElGamal Cryptosystem over the NIST P-256 elliptic curve (additively homomorphic variant)
+
+	The plaintexts are encoded as @f$ m G @f$, so a ciphertext is the pair of points @f$ (r G, m G + r H) @f$. The homomorphic operations are point additions
+	and the randomizers cost two fixed-base scalar multiplications on a 256 bit curve, instead of modular multiplications and exponentiations with 1024+ bit moduli.
+
+	Like ElGamal, only small plaintexts, @f$ |m| < 2^t @f$ (Core.EcElGamal.messageSpaceThresholdBitSize), can be fully decrypted, using a precomputed DecryptionTable of @f$ m G @f$.
+	*/
+	class EcElGamal : public CryptoProvider<EcElGamalPublicKey, EcElGamalPrivateKey, EcElGamalCiphertext, EcElGamalRandomizer> {
+	public:
+		/// Default constructor
+		EcElGamal (const bool precomputeDecryptionMap = false);
+
+		/// Creates an instance of the class for homomorphic operations and ecryption
+		EcElGamal (const EcElGamalPublicKey &publicKey);
+
+		/// Creates an instance of the class for homomorphic operations, ecryption and decryption
+		EcElGamal (const EcElGamalPublicKey &publicKey, const EcElGamalPrivateKey &privateKey, const bool precomputeDecryptionMap = false);
+
+		/// Destructor
+		~EcElGamal ();
+
+		/* Base class methods */
+
+		/// Generate the public and private keys
+		virtual bool GenerateKeys ();
+
+		/// Decrypt number
+		virtual BigInteger DecryptInteger (const Ciphertext &ciphertext) const;
+
+		/// Encrypt number without randomization
+		virtual Ciphertext EncryptIntegerNonrandom (const BigInteger &plaintext) const;
+
+		/// Compute the random factor required for the encryption operation
+		virtual Randomizer GetRandomizer () const;
+
+		/// Randomize encrypted number with a self-generated random value
+		virtual Ciphertext RandomizeCiphertext (const Ciphertext &ciphertext) const;
+
+		/// Compute the homomorphic dot product of a vector of ciphertexts and a vector of plaintext scalars
+		Ciphertext HomomorphicDotProduct (const std::vector<Ciphertext> &ciphertexts, const std::vector<BigInteger> &scalars) const;
+
+		/// Homomorphically negate a vector of ciphertexts
+		std::vector<Ciphertext> BatchNegate (const std::vector<Ciphertext> &ciphertexts) const;
+
+		/// Homomorphically subtract two vectors of ciphertexts (element by element)
+		std::vector<Ciphertext> BatchSubtract (const std::vector<Ciphertext> &lhs, const std::vector<Ciphertext> &rhs) const;
+
+		/// Homomorphically subtract each element of a vector of ciphertexts from the same ciphertext
+		std::vector<Ciphertext> BatchSubtract (const Ciphertext &lhs, const std::vector<Ciphertext> &rhs) const;
+
+		/// Homomorphically add two vectors of ciphertexts (element by element)
+		std::vector<Ciphertext> BatchAdd (const std::vector<Ciphertext> &lhs, const std::vector<Ciphertext> &rhs) const;
+
+		/// Homomorphically multiply each ciphertext with the corresponding plaintext scalar
+		std::vector<Ciphertext> BatchMultiply (const std::vector<Ciphertext> &ciphertexts, const std::vector<BigInteger> &scalars) const;
+
+		/// Returns the message space upper bound
+		virtual const BigInteger &GetMessageSpaceUpperBound () const;
+
+		/// Returns the message space bit size
+		virtual size_t GetMessageSpaceSize () const;
+
+		/// Returns a string which identifies the public key
+		virtual std::string GetPublicKeyFingerprint () const;
+
+		/* /Base class methods */
+
+		/// Determines if ciphertext contains an encryption of 0 or not
+		bool IsEncryptedZero (const Ciphertext &ciphertext) const;
+
+		/// Returns the curve
+		const std::shared_ptr<const EllipticCurve> &GetCurve () const;
+
+	private:
+		/// The curve
+		std::shared_ptr<const EllipticCurve> curve;
+
+		/// @f$ 2^t @f$
+		BigInteger messageSpaceThreshold;
+
+		/// @f$ n - s @f$ (precomputed for decryption)
+		BigInteger minusS;
+
+		/// Fixed-base table for @f$ G @f$
+		EllipticCurvePointTable gTable;
+
+		/// Fixed-base table for @f$ H @f$
+		EllipticCurvePointTable hTable;
+
+		/// If true, full decryptions are enabled and the decryption map is (pre)computed
+		bool precomputeDecryptionMap;
+
+		/// Maps the key (see getDecryptionKey) of @f$ m G @f$ to @f$ m @f$, for @f$ 0 < m < 2^t @f$
+		DecryptionTable decryptionTable;
+
+		/// Computes @f$ y - s x = m G @f$
+		EllipticCurve::Point getEncodedPlaintext (const Ciphertext &ciphertext) const;
+
+		/// Returns the decryption table key of a point, @f$ 2 x + (y \bmod 2) @f$
+		static BigInteger getDecryptionKey (const EllipticCurve::Point &point);
+
+		/* Base class methods */
+
+		/// Do nothing for now
+		virtual void validateParameters () {}
+
+		/// Precompute values for speedups
+		virtual void doPrecomputations ();
+
+		/* /Base class methods */
+
+		/// Copy constructor - not implemented
+		EcElGamal (const EcElGamal &);
+
+		/// Copy assignment operator - not implemented
+		EcElGamal operator= (const EcElGamal &);
+	};
+}//namespace Core
+}//namespace SeComLib
+
+#endif//EC_EL_GAMAL_HEADER_GUARD
\ No newline at end of file
@@ -0,0 +1,128 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/ec_el_gamal_ciphertext.cpp
+@brief Implementation of class EcElGamalCiphertext.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "ec_el_gamal_ciphertext.h"
+
+namespace SeComLib {
+namespace Core {
+	/**
+	Initializes @f$ x @f$ and @f$ y @f$ with the point at infinity
+	*/
+	EcElGamalCiphertext::Data::Data () {
+	}
+
+	/**
+	@param x @f$ x @f$ value
+	@param y @f$ y @f$ value
+	*/
+	EcElGamalCiphertext::Data::Data (const EllipticCurve::Point &x, const EllipticCurve::Point &y) : x(x), y(y) {
+	}
+
+	/**
+	@param x @f$ x @f$ value, moved into the current instance
+	@param y @f$ y @f$ value, moved into the current instance
+	*/
+	EcElGamalCiphertext::Data::Data (EllipticCurve::Point &&x, EllipticCurve::Point &&y) : x(std::move(x)), y(std::move(y)) {
+	}
+
+	/**
+	Does not initialize the curve.
+	*/
+	EcElGamalCiphertext::EcElGamalCiphertext () {
+	}
+
+	/**
+	Initializes the curve
+	@param curve The curve
+	*/
+	EcElGamalCiphertext::EcElGamalCiphertext (const std::shared_ptr<const EllipticCurve> &curve) : curve(curve) {
+	}
+
+	/**
+	Initializes the data and the curve
+	@param x @f$ x @f$ value
+	@param y @f$ y @f$ value
+	@param curve The curve
+	*/
+	EcElGamalCiphertext::EcElGamalCiphertext (const EllipticCurve::Point &x, const EllipticCurve::Point &y, const std::shared_ptr<const EllipticCurve> &curve) : data(x, y), curve(curve) {
+	}
+
+	/**
+	Takes over the data (usually temporaries resulting from a homomorphic operation) and initializes the curve
+	@param x @f$ x @f$ value
+	@param y @f$ y @f$ value
+	@param curve The curve
+	*/
+	EcElGamalCiphertext::EcElGamalCiphertext (EllipticCurve::Point &&x, EllipticCurve::Point &&y, const std::shared_ptr<const EllipticCurve> &curve) : data(std::move(x), std::move(y)), curve(curve) {
+	}
+
+	/**
+	Computes @f$ [-this] = (-x_{this}, -y_{this}) @f$
+	@return A new instance containing @f$ [-this] @f$
+	*/
+	EcElGamalCiphertext EcElGamalCiphertext::operator- () const {
+		if (!this->curve) {
+			throw std::runtime_error("This operation requires the curve.");
+		}
+
+		EcElGamalCiphertext output(this->curve->Negate(this->data.x), this->curve->Negate(this->data.y), this->curve);
+
+		return output;
+	}
+
+	/**
+	Computes @f$ [this + input] = (x_{this} + x_{input}, y_{this} + y_{input}) @f$
+	@param input encrypted input
+	@return A new instance containing @f$ [this + input] @f$
+	*/
+	EcElGamalCiphertext EcElGamalCiphertext::operator+ (const EcElGamalCiphertext &input) const {
+		if (!this->curve) {
+			throw std::runtime_error("This operation requires the curve.");
+		}
+
+		EcElGamalCiphertext output(this->curve->Add(this->data.x, input.data.x), this->curve->Add(this->data.y, input.data.y), this->curve);
+
+		return output;
+	}
+
+	/**
+	Computes @f$ [this - input] = (x_{this} - x_{input}, y_{this} - y_{input}) @f$
+	@param input encrypted input
+	@return A new instance containing @f$ [this - input] @f$
+	*/
+	EcElGamalCiphertext EcElGamalCiphertext::operator- (const EcElGamalCiphertext &input) const {
+		if (!this->curve) {
+			throw std::runtime_error("This operation requires the curve.");
+		}
+
+		EcElGamalCiphertext output(this->curve->Add(this->data.x, this->curve->Negate(input.data.x)), this->curve->Add(this->data.y, this->curve->Negate(input.data.y)), this->curve);
+
+		return output;
+	}
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
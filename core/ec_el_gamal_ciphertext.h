@@ -0,0 +1,106 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/ec_el_gamal_ciphertext.h
+@brief Definition of class EcElGamalCiphertext.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef EC_EL_GAMAL_CIPHERTEXT_HEADER_GUARD
+#define EC_EL_GAMAL_CIPHERTEXT_HEADER_GUARD
+
+#include "big_integer.h"
+#include "elliptic_curve.h"
+
+//include C++ headers
+#include <memory>
+#include <stdexcept>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief Elliptic curve ElGamal cipertext
+	*/
+	class EcElGamalCiphertext {
+	public:
+		/**
+		@brief Elliptic curve ElGamal cipertext container structure
+		*/
+		struct Data {
+		public:
+			/// @f$ r G @f$
+			EllipticCurve::Point x;
+
+			/// @f$ m G + r H @f$
+			EllipticCurve::Point y;
+
+			/// Default constructor
+			Data ();
+
+			/// Constructor with member initialization
+			Data (const EllipticCurve::Point &x, const EllipticCurve::Point &y);
+
+			/// Constructor with member initialization (takes over the inputs)
+			Data (EllipticCurve::Point &&x, EllipticCurve::Point &&y);
+		};
+
+		/// Cipertext container
+		Data data;
+
+		/// Default constructor
+		EcElGamalCiphertext ();
+
+		/// Constructor with curve initialization
+		EcElGamalCiphertext (const std::shared_ptr<const EllipticCurve> &curve);
+
+		/// Constructor with data and curve initialization
+		EcElGamalCiphertext (const EllipticCurve::Point &x, const EllipticCurve::Point &y, const std::shared_ptr<const EllipticCurve> &curve);
+
+		/// Constructor with data (taken over) and curve initialization
+		EcElGamalCiphertext (EllipticCurve::Point &&x, EllipticCurve::Point &&y, const std::shared_ptr<const EllipticCurve> &curve);
+
+		/// Homomorphic negation unary operator
+		EcElGamalCiphertext operator- () const;
+
+		/// Homomorphic addition binary operator
+		EcElGamalCiphertext operator+ (const EcElGamalCiphertext &input) const;
+
+		/// Homomorphic subtraction binary operator
+		EcElGamalCiphertext operator- (const EcElGamalCiphertext &input) const;
+
+		/// Homomorphic multiplication binary operator
+		template <typename T_DataType>
+		EcElGamalCiphertext operator* (const T_DataType &input) const;
+
+	private:
+		/// The curve
+		std::shared_ptr<const EllipticCurve> curve;
+	};
+
+}//namespace Core
+}//namespace SeComLib
+
+//Separate the implementation from the declaration
+#include "ec_el_gamal_ciphertext.hpp"
+
+#endif//EC_EL_GAMAL_CIPHERTEXT_HEADER_GUARD
\ No newline at end of file
@@ -0,0 +1,59 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/ec_el_gamal_ciphertext.hpp
+@brief Implementation of template methods from class EcElGamalCiphertext. To be included in ec_el_gamal_ciphertext.h
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef EC_EL_GAMAL_CIPHERTEXT_IMPLEMENTATION_GUARD
+#define EC_EL_GAMAL_CIPHERTEXT_IMPLEMENTATION_GUARD
+
+namespace SeComLib {
+namespace Core {
+	/**
+	Computes @f$ [this * input] = (input \cdot x_{this}, input \cdot y_{this}) @f$.
+
+	@param input plaintext input
+	@tparam T_DataType Supported types: int, unsigned int, long, unsigned long, BigInteger
+	@return A new instance containing @f$ [this * input] @f$
+	*/
+	template <typename T_DataType>
+	EcElGamalCiphertext EcElGamalCiphertext::operator* (const T_DataType &input) const {
+		if (!this->curve) {
+			throw std::runtime_error("This operation requires the curve.");
+		}
+
+		if (input == 0) {
+			throw std::runtime_error("The plaintext term should not be 0.");
+		}
+
+		BigInteger scalar(input);
+		EcElGamalCiphertext output(this->curve->Multiply(this->data.x, scalar), this->curve->Multiply(this->data.y, scalar), this->curve);
+
+		return output;
+	}
+}//namespace Core
+}//namespace SeComLib
+
+#endif//EC_EL_GAMAL_CIPHERTEXT_IMPLEMENTATION_GUARD
\ No newline at end of file
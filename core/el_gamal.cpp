@@ -45,6 +45,30 @@ namespace Core {
 	ElGamalRandomizer::ElGamalRandomizer (const BigInteger &x, const BigInteger &y) : x(x), y(y) {
 	}
 
+	/**
+	Takes over the data
+	@param x @f$ x @f$ value
+	@param y @f$ y @f$ value
+	*/
+	ElGamalRandomizer::ElGamalRandomizer (BigInteger &&x, BigInteger &&y) : x(std::move(x)), y(std::move(y)) {
+	}
+
+	/**
+	@param record the record which receives the data
+	*/
+	void ElGamalRandomizer::Serialize (PrecomputationStore::RecordWriter &record) const {
+		record.Write(this->x);
+		record.Write(this->y);
+	}
+
+	/**
+	@param record the precomputed record
+	*/
+	void ElGamalRandomizer::Deserialize (PrecomputationStore::RecordReader &record) {
+		this->x = record.ReadBigInteger();
+		this->y = record.ReadBigInteger();
+	}
+
 	/**
 	Sets the specified key size from the configuration file (defaults to 1024).
 
@@ -82,6 +106,13 @@ namespace Core {
 		this->doPrecomputations();
 	}
 
+	/**
+	Stops the producer threads of the randomizer cache before the members they use are destroyed.
+	*/
+	ElGamal::~ElGamal () {
+		this->randomizerCache.reset();
+	}
+
 	/**
 	* Generates the ElGamal cryptosystem keys.
 	* 
@@ -102,6 +133,9 @@ namespace Core {
 	* @throws std::runtime_error parameter errors
 	*/
 	bool ElGamal::GenerateKeys () {
+		//stop the producer threads of the randomizer cache before the keys change
+		this->randomizerCache.reset();
+
 		/// Fetch the size of the large prime factor which @f$ p - 1 @f$ must have (defaults to 160)
 		unsigned int largePrimeFactorSize = Utils::Config::GetInstance().GetParameter("Core.ElGamal.largePrimeFactorSize", 160);
 
@@ -116,21 +150,15 @@ namespace Core {
 		BigInteger r, m, n;
 		unsigned int sizeR = this->keyLength - largePrimeFactorSize;
 		unsigned int sizeMN = (sizeR - 1) / 2;
-		do {
-			//pick a random prime @f$ q @f$ of size specified by largePrimeFactorSize
-			this->publicKey.q = RandomProvider::GetInstance().GetMaxLengthRandomPrime(largePrimeFactorSize);
+		//pick a random prime @f$ q @f$ of size specified by largePrimeFactorSize
+		this->publicKey.q = PrimeSearch::GetMaxLengthRandomPrime(largePrimeFactorSize);
 
-			//generate two random primes in the interval (0, 2^((sizeR - 1) / 2))
-			m = RandomProvider::GetInstance().GetMaxLengthRandomPrime(sizeMN);
-			n = RandomProvider::GetInstance().GetMaxLengthRandomPrime(sizeMN);
+		//generate two random primes in the interval (0, 2^((sizeR - 1) / 2)), searching for n such that p = 2 q m n + 1 is prime
+		m = PrimeSearch::GetMaxLengthRandomPrime(sizeMN);
+		this->publicKey.p = PrimeSearch::GetLinearFormPrime(n, this->publicKey.q * m * 2, sizeMN, true);
 
-			//compute r
-			r = m * n * 2;
-
-			//q and r must divide p - 1
-			this->publicKey.p = this->publicKey.q * r + 1;
-		}
-		while (!this->publicKey.p.IsPrime());
+		//q and r divide p - 1
+		r = m * n * 2;
 
 		/// Pick @f$ g @f$ - a random generator of the cyclic group @f$ \mathbb{Z}_p^* @f$, using Algorithm 4.80
 		do {
@@ -164,7 +192,8 @@ namespace Core {
 	}
 
 	/**
-	If @f$ plaintext \in [0, 2^t) \Rightarrow plaintext \geq 0 @f$ otherwise if @f$ plaintext \in [q - 2^t, q) \Rightarrow plaintext = plaintext - messageSpaceUpperBound  @f$
+	The plaintexts are in @f$ (-2^t, 2^t) @f$ (@f$ plaintext \in [q - 2^t, q) @f$ is returned as @f$ plaintext - q @f$).
+	If the decryption table holds fewer values than @f$ 2^{t + 1} - 1 @f$ (Core.ElGamal.babyStepCount), the lookup takes up to @f$ \lceil 2^{t + 1} / babyStepCount \rceil @f$ giant steps.
 
 	@param ciphertext the ciphertext integer
 	@return Deciphered plaintext
@@ -181,7 +210,8 @@ namespace Core {
 		}
 
 		/// Compute @f$ c.y * c.x^{-s} \pmod p @f$
-		BigInteger cyCxPowMinusSModP = (ciphertext.data.y * ciphertext.data.x.GetPowModN(-this->privateKey.s, this->publicKey.p)) % this->publicKey.p;
+		BigInteger cyCxPowMinusSModP;
+		BigInteger::PowMulModN(cyCxPowMinusSModP, ciphertext.data.y, ciphertext.data.x, this->minusS, this->publicKey.p);
 
 		/// Shortcut: if @f$ c.y * c.x^{-s} \pmod p = 1 @f$, then @f$ c = [0] @f$
 		if (cyCxPowMinusSModP == 1) {
@@ -189,25 +219,14 @@ namespace Core {
 		}
 
 		/// @f$ m \in \mathbb{Z}_q \ (2^t, \lfloor q / 2 \rfloor + 2^t) @f$ is uniquely determined by @f$ g_q^m \pmod p @f$.
-		/// Since we cannot determine m directly, we precompute all @f$ g_q^m \pmod p @f$ values, we store them in an std::map and we try to find m that matches @f$ c.y * c.x^{-s} \pmod p @f$
-		BigInteger output;
-
-		//get an iterator to the required element
-		DecryptionMap::const_iterator iterator = this->decryptionMap.find(cyCxPowMinusSModP);
-
-		//make sure the key exists
-		if (this->decryptionMap.end() != iterator) {
-			output = BigInteger(iterator->second);
-		}
-		else {
+		/// Since we cannot determine m directly, we precompute all @f$ g_q^m \pmod p @f$ values, we store them in a DecryptionTable and we try to find m that matches @f$ c.y * c.x^{-s} \pmod p @f$
+		/// (the table contains the negative exponents as well, so there is no need to map the result to the negative range)
+		long exponent;
+		if (!this->decryptionTable.Find(cyCxPowMinusSModP, exponent)) {
 			throw std::runtime_error("Can't decrypt ciphertext.");
 		}
 
-		if (output > this->positiveNegativeBoundary) {
-			output -= this->GetMessageSpaceUpperBound();
-		}
-		
-		return output;
+		return BigInteger(exponent);
 	}
 
 	/**
@@ -224,10 +243,10 @@ namespace Core {
 		/// Set @f$ x = 1 @f$ and randomize it later (replace it with @f$ g_q^r @f$)
 		output.data.x = 1;
 		if (plaintext < 0) {
-			output.data.y = this->publicKey.gq.GetPowModN(this->GetMessageSpaceUpperBound() + plaintext, this->publicKey.p);
+			output.data.y = this->gqTable.GetPowModN(this->GetMessageSpaceUpperBound() + plaintext);
 		}
 		else {
-			output.data.y = this->publicKey.gq.GetPowModN(plaintext, this->publicKey.p);
+			output.data.y = this->gqTable.GetPowModN(plaintext);
 		}
 
 		return output;
@@ -241,7 +260,7 @@ namespace Core {
 	ElGamal::Randomizer ElGamal::GetRandomizer () const {
 		BigInteger random = RandomProvider::GetInstance().GetRandomInteger(this->publicKey.q);
 
-		return Randomizer(this->publicKey.gq.GetPowModN(random, this->publicKey.p), this->publicKey.h.GetPowModN(random, this->publicKey.p));
+		return Randomizer(this->gqTable.GetPowModN(random), this->hTable.GetPowModN(random));
 	}
 
 	/**
@@ -251,13 +270,13 @@ namespace Core {
 	@return The randomized ciphertext
 	*/
 	ElGamal::Ciphertext ElGamal::RandomizeCiphertext (const ElGamal::Ciphertext &ciphertext) const {
-		//assign a randomizer to the output
+		//assign a randomizer to the output (Pop returns the container by value, so the randomizer is moved out of it)
 		Randomizer randomizer = this->randomizerCache->Pop().randomizer;
 		Ciphertext output(this->encryptionModulus);
 
 		//compose the output with the ciphertext
-		output.data.x = ciphertext.data.x * randomizer.x % this->GetEncryptionModulus();
-		output.data.y = ciphertext.data.y * randomizer.y % this->GetEncryptionModulus();
+		BigInteger::MulModN(output.data.x, ciphertext.data.x, randomizer.x, this->GetEncryptionModulus());
+		BigInteger::MulModN(output.data.y, ciphertext.data.y, randomizer.y, this->GetEncryptionModulus());
 		
 		return output;
 	}
@@ -328,6 +347,169 @@ namespace Core {
 	}
 #endif
 
+	/**
+	Computes @f$ [\sum_i ciphertexts_i \cdot scalars_i] = (\prod_i x_i^{scalars_i} \pmod p, \prod_i y_i^{scalars_i} \pmod p) @f$ with two simultaneous multi-exponentiations (see BigInteger::MultiPowModN).
+
+	0 scalars are allowed (the corresponding terms are skipped). The output is not randomized.
+
+	@param ciphertexts the encrypted vector
+	@param scalars the plaintext vector
+	@return A new instance containing @f$ [\sum_i ciphertexts_i \cdot scalars_i] @f$
+	@throws std::runtime_error the two vectors have different sizes
+	*/
+	ElGamal::Ciphertext ElGamal::HomomorphicDotProduct (const std::vector<ElGamal::Ciphertext> &ciphertexts, const std::vector<BigInteger> &scalars) const {
+		if (ciphertexts.size() != scalars.size()) {
+			throw std::runtime_error("The number of ciphertexts must be equal to the number of scalars.");
+		}
+
+		std::vector<const BigInteger *> xValues;
+		std::vector<const BigInteger *> yValues;
+		std::vector<const BigInteger *> exponents;
+		xValues.reserve(ciphertexts.size());
+		yValues.reserve(ciphertexts.size());
+		exponents.reserve(scalars.size());
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			xValues.push_back(&ciphertexts[i].data.x);
+			yValues.push_back(&ciphertexts[i].data.y);
+			exponents.push_back(&scalars[i]);
+		}
+
+		return Ciphertext(BigInteger::MultiPowModN(xValues, exponents, this->GetEncryptionModulus()), BigInteger::MultiPowModN(yValues, exponents, this->GetEncryptionModulus()), this->encryptionModulus);
+	}
+
+	/**
+	Computes @f$ [-ciphertexts_i] = (x_i^{-1} \pmod p, y_i^{-1} \pmod p) @f$, inverting all the @f$ x_i @f$ and @f$ y_i @f$ values together with BigInteger::BatchInverseModN.
+
+	@param ciphertexts the encrypted vector
+	@return A vector containing @f$ [-ciphertexts_i] @f$
+	*/
+	std::vector<ElGamal::Ciphertext> ElGamal::BatchNegate (const std::vector<ElGamal::Ciphertext> &ciphertexts) const {
+		std::vector<const BigInteger *> inputs;
+		inputs.reserve(2 * ciphertexts.size());
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			inputs.push_back(&ciphertexts[i].data.x);
+			inputs.push_back(&ciphertexts[i].data.y);
+		}
+
+		std::vector<BigInteger> inverses = BigInteger::BatchInverseModN(inputs, this->GetEncryptionModulus());
+
+		std::vector<Ciphertext> output;
+		output.reserve(ciphertexts.size());
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			output.emplace_back(std::move(inverses[2 * i]), std::move(inverses[2 * i + 1]), this->encryptionModulus);
+		}
+
+		return output;
+	}
+
+	/**
+	@param lhs left hand side encrypted vector
+	@param rhs right hand side encrypted vector
+	@return A vector containing @f$ [lhs_i - rhs_i] @f$
+	@throws std::runtime_error the two vectors have different sizes
+	*/
+	std::vector<ElGamal::Ciphertext> ElGamal::BatchSubtract (const std::vector<ElGamal::Ciphertext> &lhs, const std::vector<ElGamal::Ciphertext> &rhs) const {
+		if (lhs.size() != rhs.size()) {
+			throw std::runtime_error("The two ciphertext vectors must have the same size.");
+		}
+
+		std::vector<Ciphertext> output = this->BatchNegate(rhs);
+		for (size_t i = 0; i < output.size(); ++i) {
+			output[i] = lhs[i] + output[i];
+		}
+
+		return output;
+	}
+
+	/**
+	@param lhs left hand side ciphertext
+	@param rhs right hand side encrypted vector
+	@return A vector containing @f$ [lhs - rhs_i] @f$
+	*/
+	std::vector<ElGamal::Ciphertext> ElGamal::BatchSubtract (const ElGamal::Ciphertext &lhs, const std::vector<ElGamal::Ciphertext> &rhs) const {
+		std::vector<Ciphertext> output = this->BatchNegate(rhs);
+		for (size_t i = 0; i < output.size(); ++i) {
+			output[i] = lhs + output[i];
+		}
+
+		return output;
+	}
+
+	/**
+	Computes @f$ [lhs_i + rhs_i] = (lhs_i.x \cdot rhs_i.x \pmod p, lhs_i.y \cdot rhs_i.y \pmod p) @f$, multiplying all the components together with BigInteger::BatchMulModN.
+
+	@param lhs left hand side encrypted vector
+	@param rhs right hand side encrypted vector
+	@return A vector containing @f$ [lhs_i + rhs_i] @f$
+	@throws std::runtime_error the two vectors have different sizes
+	*/
+	std::vector<ElGamal::Ciphertext> ElGamal::BatchAdd (const std::vector<ElGamal::Ciphertext> &lhs, const std::vector<ElGamal::Ciphertext> &rhs) const {
+		if (lhs.size() != rhs.size()) {
+			throw std::runtime_error("The two ciphertext vectors must have the same size.");
+		}
+
+		std::vector<const BigInteger *> lhsData;
+		std::vector<const BigInteger *> rhsData;
+		lhsData.reserve(2 * lhs.size());
+		rhsData.reserve(2 * rhs.size());
+		for (size_t i = 0; i < lhs.size(); ++i) {
+			lhsData.push_back(&lhs[i].data.x);
+			lhsData.push_back(&lhs[i].data.y);
+			rhsData.push_back(&rhs[i].data.x);
+			rhsData.push_back(&rhs[i].data.y);
+		}
+
+		std::vector<BigInteger> products = BigInteger::BatchMulModN(lhsData, rhsData, this->GetEncryptionModulus());
+
+		std::vector<Ciphertext> output;
+		output.reserve(lhs.size());
+		for (size_t i = 0; i < lhs.size(); ++i) {
+			output.emplace_back(std::move(products[2 * i]), std::move(products[2 * i + 1]), this->encryptionModulus);
+		}
+
+		return output;
+	}
+
+	/**
+	Computes @f$ [ciphertexts_i \cdot scalars_i] = (ciphertexts_i.x^{scalars_i} \pmod p, ciphertexts_i.y^{scalars_i} \pmod p) @f$, raising all the components together with BigInteger::BatchPowModN.
+
+	@param ciphertexts the encrypted vector
+	@param scalars the plaintext scalars (same size as ciphertexts, non-zero)
+	@return A vector containing @f$ [ciphertexts_i \cdot scalars_i] @f$
+	@throws std::runtime_error the two vectors have different sizes
+	@throws std::runtime_error one of the scalars is 0
+	*/
+	std::vector<ElGamal::Ciphertext> ElGamal::BatchMultiply (const std::vector<ElGamal::Ciphertext> &ciphertexts, const std::vector<BigInteger> &scalars) const {
+		if (ciphertexts.size() != scalars.size()) {
+			throw std::runtime_error("The number of ciphertexts must be equal to the number of scalars.");
+		}
+
+		std::vector<const BigInteger *> bases;
+		std::vector<const BigInteger *> exponents;
+		bases.reserve(2 * ciphertexts.size());
+		exponents.reserve(2 * scalars.size());
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			if (scalars[i] == 0) {
+				throw std::runtime_error("The plaintext term should not be 0.");
+			}
+
+			bases.push_back(&ciphertexts[i].data.x);
+			bases.push_back(&ciphertexts[i].data.y);
+			exponents.push_back(&scalars[i]);
+			exponents.push_back(&scalars[i]);
+		}
+
+		std::vector<BigInteger> powers = BigInteger::BatchPowModN(bases, exponents, this->GetEncryptionModulus());
+
+		std::vector<Ciphertext> output;
+		output.reserve(ciphertexts.size());
+		for (size_t i = 0; i < ciphertexts.size(); ++i) {
+			output.emplace_back(std::move(powers[2 * i]), std::move(powers[2 * i + 1]), this->encryptionModulus);
+		}
+
+		return output;
+	}
+
 	/**
 	@return @f$ q @f$
 	*/
@@ -342,6 +524,13 @@ namespace Core {
 		return this->publicKey.q.GetSize();
 	}
 
+	/**
+	@return The provider name and the hexadecimal public key components.
+	*/
+	std::string ElGamal::GetPublicKeyFingerprint () const {
+		return "ElGamal:p=" + this->publicKey.p.ToString(16) + ",q=" + this->publicKey.q.ToString(16) + ",gq=" + this->publicKey.gq.ToString(16) + ",h=" + this->publicKey.h.ToString(16);
+	}
+
 	/**
 	If and only if @f$ m = 0 @f$, then @f$ c.y * c.x^{-s} \pmod p = 1 @f$.
 
@@ -355,34 +544,75 @@ namespace Core {
 			throw std::runtime_error("This operation requires the private key.");
 		}
 
-		BigInteger test = (ciphertext.data.y * ciphertext.data.x.GetPowModN(-this->privateKey.s, this->publicKey.p)) % this->publicKey.p;
+		BigInteger test;
+		BigInteger::PowMulModN(test, ciphertext.data.y, ciphertext.data.x, this->minusS, this->publicKey.p);
 
 		return test == 1 ? true : false;
 	}
 
+	/**
+	Only the giant steps which cover @f$ [lowerBound, upperBound] @f$ are taken, so a tight range (e.g. the sum of a few bounded values)
+	decrypts faster than DecryptInteger (const Ciphertext &) when the decryption table holds fewer values than the message space.
+	The range is not limited to @f$ (-2^t, 2^t) @f$, but it must be smaller than @f$ q @f$ for the plaintext to be unique.
+
+	@param ciphertext the ciphertext integer
+	@param lowerBound the smallest possible plaintext
+	@param upperBound the largest possible plaintext
+	@return Deciphered plaintext
+	@throws std::runtime_error the plaintext is not in the specified range or the bounds are reversed
+	@throws std::runtime_error operation requires the private key
+	@throws std::runtime_error operation requires the decryption map
+	*/
+	BigInteger ElGamal::DecryptInteger (const Ciphertext &ciphertext, const long lowerBound, const long upperBound) const {
+		if (!this->hasPrivateKey) {
+			throw std::runtime_error("This operation requires the private key.");
+		}
+
+		if (!this->precomputeDecryptionMap) {
+			throw std::runtime_error("This operation requires the decryption map.");
+		}
+
+		BigInteger cyCxPowMinusSModP;
+		BigInteger::PowMulModN(cyCxPowMinusSModP, ciphertext.data.y, ciphertext.data.x, this->minusS, this->publicKey.p);
+
+		long exponent;
+		if (!this->decryptionTable.Find(cyCxPowMinusSModP, lowerBound, upperBound, exponent)) {
+			throw std::runtime_error("Can't decrypt ciphertext.");
+		}
+
+		return BigInteger(exponent);
+	}
+
 	/**
 	Precomputes the message space delimiter between positive and negative values.
 
+	Builds the fixed-base tables for @f$ g_q @f$ and @f$ h @f$, each within the Core.FixedBaseTable.memoryBudget limit.
+
 	Precomputes [0] and [1].
 	*/
 	void ElGamal::doPrecomputations () {
 		if (this->hasPrivateKey) {
+			this->minusS = -this->privateKey.s;
+
 			/// Precompute all possible values of @f$ g_q^m \pmod p @f$, where @f$ m \in \mathbb{Z}_q \ (2^t, \lfloor q / 2 \rfloor + 2^t) @f$, and it is required for decryption.
+			/// The exponents are @f$ m \in (-2^t, 2^t) @f$, since @f$ g_q^{q - m} = g_q^{-m} \pmod p @f$ (size(positives \ {0}) = size(negatives))
+			/// (all of them by default, or Core.ElGamal.babyStepCount of them, in which case the decryption takes baby-step giant-step lookups)
 			if (this->precomputeDecryptionMap) {
-				//we handle the first part (for m >= 0)
-				for (BigInteger i = 0; i < this->messageSpaceThreshold; ++i) {
-					this->decryptionMap[this->publicKey.gq.GetPowModN(i, this->publicKey.p)] = i;
-				}
-				//and the second part (for m < 0) - we do one less iteration here, because size(positives \ {0}) = size(negatives)
-				for (BigInteger i = this->publicKey.q - this->messageSpaceThreshold + 1; i < this->publicKey.q; ++i) {
-					this->decryptionMap[this->publicKey.gq.GetPowModN(i, this->publicKey.p)] = i;
-				}
+				std::string cacheDirectory = Utils::Config::GetInstance().GetParameter<std::string>("Core.DecryptionTable.cacheDirectory", "");
+				size_t babyStepCount = Utils::Config::GetInstance().GetParameter<size_t>("Core.ElGamal.babyStepCount", 0);
+				long threshold = static_cast<long>(this->messageSpaceThreshold.ToUnsignedLong());
+				this->decryptionTable = BabyStepGiantStep(this->publicKey.gq, this->publicKey.p, 1 - threshold, threshold - 1, babyStepCount, cacheDirectory);
 			}
 		}
 		
 		//set the encryption modulus, @f$ p @f$
 		this->encryptionModulus = std::make_shared<BigInteger>(this->publicKey.p);
 
+		/// All exponents (plaintexts and randomizers) are smaller than @f$ q @f$
+		size_t memoryBudget = Utils::Config::GetInstance().GetParameter<size_t>("Core.FixedBaseTable.memoryBudget", 1024) * 1024;
+		this->gqTable = FixedBaseTable(this->publicKey.gq, this->publicKey.p, this->publicKey.q.GetSize(), memoryBudget);
+		this->hTable = FixedBaseTable(this->publicKey.h, this->publicKey.p, this->publicKey.q.GetSize(), memoryBudget);
+
 		this->positiveNegativeBoundary = this->messageSpaceThreshold;
 		
 		/// Populate the randomizer cache
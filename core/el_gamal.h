@@ -31,13 +31,16 @@ limitations under the License.
 
 #include "big_integer.h"
 #include "random_provider.h"
+#include "prime_search.h"
 #include "crypto_provider.h"
 #include "utils/config.h"
 #include "el_gamal_ciphertext.h"
+#include "fixed_base_table.h"
+#include "baby_step_giant_step.h"
 
 //include C++ headers
-#include <map>
 #include <stdexcept>
+#include <vector>
 
 namespace SeComLib {
 namespace Core {
@@ -80,6 +83,15 @@ namespace Core {
 
 		/// Constructor with initialization
 		ElGamalRandomizer (const BigInteger &x, const BigInteger &y);
+
+		/// Constructor with initialization (takes over the inputs)
+		ElGamalRandomizer (BigInteger &&x, BigInteger &&y);
+
+		/// Serializes the data into a precomputed record
+		void Serialize (PrecomputationStore::RecordWriter &record) const;
+
+		/// Loads the data from a precomputed record
+		void Deserialize (PrecomputationStore::RecordReader &record);
 	};
 
 	/**
@@ -97,7 +109,7 @@ namespace Core {
 		ElGamal (const ElGamalPublicKey &publicKey, const ElGamalPrivateKey &privateKey, const bool precomputeDecryptionMap = false);
 
 		/// Destructor
-		~ElGamal () {}
+		~ElGamal ();
 
 		/* Base class methods */
 
@@ -131,32 +143,62 @@ namespace Core {
 		Ciphertext HomomorphicMultiply (const Ciphertext &lhs, const BigInteger &rhs) const;
 	#endif
 
+		/// Compute the homomorphic dot product of a vector of ciphertexts and a vector of plaintext scalars
+		Ciphertext HomomorphicDotProduct (const std::vector<Ciphertext> &ciphertexts, const std::vector<BigInteger> &scalars) const;
+
+		/// Homomorphically negate a vector of ciphertexts with a single modular inversion
+		std::vector<Ciphertext> BatchNegate (const std::vector<Ciphertext> &ciphertexts) const;
+
+		/// Homomorphically subtract two vectors of ciphertexts (element by element) with a single modular inversion
+		std::vector<Ciphertext> BatchSubtract (const std::vector<Ciphertext> &lhs, const std::vector<Ciphertext> &rhs) const;
+
+		/// Homomorphically subtract each element of a vector of ciphertexts from the same ciphertext with a single modular inversion
+		std::vector<Ciphertext> BatchSubtract (const Ciphertext &lhs, const std::vector<Ciphertext> &rhs) const;
+
+		/// Homomorphically add two vectors of ciphertexts (element by element), vectorizing the modular multiplications when possible
+		std::vector<Ciphertext> BatchAdd (const std::vector<Ciphertext> &lhs, const std::vector<Ciphertext> &rhs) const;
+
+		/// Homomorphically multiply each ciphertext with the corresponding plaintext scalar, vectorizing the modular exponentiations when possible
+		std::vector<Ciphertext> BatchMultiply (const std::vector<Ciphertext> &ciphertexts, const std::vector<BigInteger> &scalars) const;
+
 		/// Returns the message space upper bound
 		virtual const BigInteger &GetMessageSpaceUpperBound () const;
 
 		/// Returns the message space bit size
 		virtual size_t GetMessageSpaceSize () const;
 
+		/// Returns a string which identifies the public key
+		virtual std::string GetPublicKeyFingerprint () const;
+
 		/* /Base class methods */
 
 		/// Determines if ciphertext contains an encryption of 0 or not
 		bool IsEncryptedZero (const Ciphertext &ciphertext) const;
 
-	private:
-		/// std::map template specialization
-		typedef std::map<const BigInteger, BigInteger> DecryptionMap;
+		/// Decrypt a number which is known to lie in @f$ [lowerBound, upperBound] @f$
+		BigInteger DecryptInteger (const Ciphertext &ciphertext, const long lowerBound, const long upperBound) const;
 
+	private:
 		/// @f$ m \in \mathbb{Z}_q \ (2^t, \lfloor q / 2 \rfloor + 2^t) @f$
 		BigInteger messageSpaceThreshold;
 
 		/// A generator of @f$ Z_{p}^* @f$
 		BigInteger g;
 
+		/// @f$ -s @f$ (precomputed for decryption)
+		BigInteger minusS;
+
+		/// Fixed-base table for @f$ g_q \pmod p @f$
+		FixedBaseTable gqTable;
+
+		/// Fixed-base table for @f$ h \pmod p @f$
+		FixedBaseTable hTable;
+
 		/// If true, full decryptions are enabled and the decryption map is (pre)computed
 		bool precomputeDecryptionMap;
 
-		/// Contains all possible values of @f$ g_q^m \pmod p @f$, where @f$ m \in \mathbb{Z}_q @f$, and it is required for decryption.
-		DecryptionMap decryptionMap;
+		/// Finds @f$ m \in (-2^t, 2^t) @f$ from @f$ g_q^m \pmod p @f$ (a table of all the values, or of Core.ElGamal.babyStepCount of them), and it is required for decryption.
+		BabyStepGiantStep decryptionTable;
 
 		/* Base class methods */
 
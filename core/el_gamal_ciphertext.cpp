@@ -44,6 +44,13 @@ namespace Core {
 	ElGamalCiphertext::Data::Data (const BigInteger &x, const BigInteger &y) : x(x), y(y) {
 	}
 
+	/**
+	@param x @f$ x @f$ value, moved into the current instance
+	@param y @f$ y @f$ value, moved into the current instance
+	*/
+	ElGamalCiphertext::Data::Data (BigInteger &&x, BigInteger &&y) : x(std::move(x)), y(std::move(y)) {
+	}
+
 	/**
 	Does not initialize the encryptionModulus.
 	*/
@@ -63,7 +70,16 @@ namespace Core {
 	@param y @f$ y @f$ value
 	@param encryptionModulus The encryption modulus
 	*/
-	ElGamalCiphertext::ElGamalCiphertext (const BigInteger &x, const BigInteger &y, const std::shared_ptr<BigInteger> &encryptionModulus) : data(Data(x, y)), encryptionModulus(encryptionModulus) {
+	ElGamalCiphertext::ElGamalCiphertext (const BigInteger &x, const BigInteger &y, const std::shared_ptr<BigInteger> &encryptionModulus) : data(x, y), encryptionModulus(encryptionModulus) {
+	}
+
+	/**
+	Takes over the data (usually temporaries resulting from a homomorphic operation) and initializes the encryptionModulus
+	@param x @f$ x @f$ value
+	@param y @f$ y @f$ value
+	@param encryptionModulus The encryption modulus
+	*/
+	ElGamalCiphertext::ElGamalCiphertext (BigInteger &&x, BigInteger &&y, const std::shared_ptr<BigInteger> &encryptionModulus) : data(std::move(x), std::move(y)), encryptionModulus(encryptionModulus) {
 	}
 
 	/**
@@ -90,7 +106,9 @@ namespace Core {
 			throw std::runtime_error("This operation requires the encryption modulus.");
 		}
 
-		ElGamalCiphertext output((this->data.x * input.data.x) % (*this->encryptionModulus), (this->data.y * input.data.y) % (*this->encryptionModulus), this->encryptionModulus);
+		ElGamalCiphertext output(this->encryptionModulus);
+		BigInteger::MulModN(output.data.x, this->data.x, input.data.x, *this->encryptionModulus);
+		BigInteger::MulModN(output.data.y, this->data.y, input.data.y, *this->encryptionModulus);
 
 		return output;
 	}
@@ -105,7 +123,9 @@ namespace Core {
 			throw std::runtime_error("This operation requires the encryption modulus.");
 		}
 
-		ElGamalCiphertext output((this->data.x * input.data.x.GetInverseModN(*this->encryptionModulus)) % (*this->encryptionModulus), (this->data.y * input.data.y.GetInverseModN(*this->encryptionModulus)) % (*this->encryptionModulus), this->encryptionModulus);
+		ElGamalCiphertext output(input.data.x.GetInverseModN(*this->encryptionModulus), input.data.y.GetInverseModN(*this->encryptionModulus), this->encryptionModulus);
+		BigInteger::MulModN(output.data.x, output.data.x, this->data.x, *this->encryptionModulus);
+		BigInteger::MulModN(output.data.y, output.data.y, this->data.y, *this->encryptionModulus);
 
 		return output;
 	}
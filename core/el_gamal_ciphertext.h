@@ -58,6 +58,9 @@ namespace Core {
 
 			/// Constructor with member initialization
 			Data (const BigInteger &x, const BigInteger &y);
+
+			/// Constructor with member initialization (takes over the inputs)
+			Data (BigInteger &&x, BigInteger &&y);
 		};
 
 		/// Cipertext container
@@ -72,6 +75,9 @@ namespace Core {
 		/// Constructor with data and encryption modulus initialization
 		ElGamalCiphertext (const BigInteger &x, const BigInteger &y, const std::shared_ptr<BigInteger> &encryptionModulus);
 
+		/// Constructor with data (taken over) and encryption modulus initialization
+		ElGamalCiphertext (BigInteger &&x, BigInteger &&y, const std::shared_ptr<BigInteger> &encryptionModulus);
+
 		/// Homomorphic negation unary operator
 		ElGamalCiphertext operator- () const;
 
@@ -0,0 +1,583 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/elliptic_curve.cpp
+@brief Implementation of classes EllipticCurve and EllipticCurvePointTable.
+@details The point doubling and the mixed point addition formulas in Jacobian coordinates are described in "Guide to Elliptic Curve Cryptography" by Darrel Hankerson, Alfred Menezes, Scott Vanstone, 2004
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "elliptic_curve.h"
+
+namespace SeComLib {
+namespace Core {
+	/**
+	Initializes the point at infinity
+	*/
+	EllipticCurve::Point::Point () : x(0), y(0), infinity(true) {
+	}
+
+	/**
+	@param x @f$ x @f$
+	@param y @f$ y @f$
+	*/
+	EllipticCurve::Point::Point (const BigInteger &x, const BigInteger &y) : x(x), y(y), infinity(false) {
+	}
+
+	/**
+	Takes over the inputs
+	@param x @f$ x @f$
+	@param y @f$ y @f$
+	*/
+	EllipticCurve::Point::Point (BigInteger &&x, BigInteger &&y) : x(std::move(x)), y(std::move(y)), infinity(false) {
+	}
+
+	/**
+	@param input the point to compare against
+	@return true if both points are the point at infinity or if they have the same coordinates
+	*/
+	bool EllipticCurve::Point::operator== (const Point &input) const {
+		if (this->infinity || input.infinity) {
+			return this->infinity == input.infinity;
+		}
+
+		return this->x == input.x && this->y == input.y;
+	}
+
+	/**
+	@param input the point to compare against
+	@return false if both points are the point at infinity or if they have the same coordinates
+	*/
+	bool EllipticCurve::Point::operator!= (const Point &input) const {
+		return !(*this == input);
+	}
+
+	/**
+	The domain parameters are listed in FIPS 186-4, appendix D.1.2.3. The instance is created on first use and shared by the whole process.
+
+	@return The P-256 curve
+	*/
+	const std::shared_ptr<const EllipticCurve> &EllipticCurve::GetP256 () {
+		static const std::shared_ptr<const EllipticCurve> curve = std::make_shared<const EllipticCurve>(
+			"P-256",
+			BigInteger("FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF", 16),
+			BigInteger("FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFC", 16),
+			BigInteger("5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B", 16),
+			Point(BigInteger("6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296", 16), BigInteger("4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5", 16)),
+			BigInteger("FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551", 16));
+
+		return curve;
+	}
+
+	/**
+	@param name the name of the curve (used in the public key fingerprints)
+	@param p the prime modulus of the field
+	@param a the coefficient @f$ a @f$
+	@param b the coefficient @f$ b @f$
+	@param generator the generator
+	@param order the (prime) order of the generator
+	@throws std::runtime_error the generator is not a point of the curve.
+	*/
+	EllipticCurve::EllipticCurve (const std::string &name, const BigInteger &p, const BigInteger &a, const BigInteger &b, const Point &generator, const BigInteger &order) :
+		name(name), p(p), a(a % p), b(b % p), aIsMinusThree(a % p == p - 3), generator(generator), order(order) {
+		if (!this->IsOnCurve(this->generator) || this->generator.infinity) {
+			throw std::runtime_error("The generator is not a point of the curve.");
+		}
+	}
+
+	/**
+	@return The name of the curve
+	*/
+	const std::string &EllipticCurve::GetName () const {
+		return this->name;
+	}
+
+	/**
+	@return @f$ p @f$
+	*/
+	const BigInteger &EllipticCurve::GetFieldModulus () const {
+		return this->p;
+	}
+
+	/**
+	@return @f$ n @f$
+	*/
+	const BigInteger &EllipticCurve::GetOrder () const {
+		return this->order;
+	}
+
+	/**
+	@return @f$ G @f$
+	*/
+	const EllipticCurve::Point &EllipticCurve::GetGenerator () const {
+		return this->generator;
+	}
+
+	/**
+	@param point the point to check
+	@return true if the point is the point at infinity or if its coordinates are in @f$ \mathbb{Z}_p @f$ and satisfy @f$ y^2 = x^3 + a x + b \pmod p @f$
+	*/
+	bool EllipticCurve::IsOnCurve (const Point &point) const {
+		if (point.infinity) {
+			return true;
+		}
+
+		if (point.x < 0 || point.x >= this->p || point.y < 0 || point.y >= this->p) {
+			return false;
+		}
+
+		BigInteger lhs;
+		BigInteger::SquareModN(lhs, point.y, this->p);
+
+		//x^3 + a x + b = (x^2 + a) x + b
+		BigInteger rhs;
+		BigInteger::SquareModN(rhs, point.x, this->p);
+		rhs += this->a;
+		BigInteger::MulAddModN(rhs, rhs, point.x, this->b, this->p);
+
+		return lhs == rhs;
+	}
+
+	/**
+	Affine addition (one modular inversion): @f$ \lambda = (y_2 - y_1) / (x_2 - x_1) @f$ (or @f$ (3 x_1^2 + a) / (2 y_1) @f$ when doubling),
+	@f$ x_3 = \lambda^2 - x_1 - x_2 @f$, @f$ y_3 = \lambda (x_1 - x_3) - y_1 @f$.
+
+	@param lhs left hand side operand
+	@param rhs right hand side operand
+	@return @f$ lhs + rhs @f$
+	*/
+	EllipticCurve::Point EllipticCurve::Add (const Point &lhs, const Point &rhs) const {
+		if (lhs.infinity) {
+			return rhs;
+		}
+		if (rhs.infinity) {
+			return lhs;
+		}
+
+		BigInteger numerator;
+		BigInteger denominator;
+		if (lhs.x == rhs.x) {
+			//P + (-P) = O (this includes the points of order 2, where y = 0)
+			if (lhs.y != rhs.y || lhs.y == 0) {
+				return Point();
+			}
+
+			BigInteger::SquareModN(numerator, lhs.x, this->p);
+			denominator = numerator;
+			this->addModP(numerator, denominator);
+			this->addModP(numerator, denominator);
+			this->addModP(numerator, this->a);
+
+			denominator = lhs.y;
+			this->addModP(denominator, lhs.y);
+		}
+		else {
+			numerator = rhs.y;
+			this->subtractModP(numerator, lhs.y);
+
+			denominator = rhs.x;
+			this->subtractModP(denominator, lhs.x);
+		}
+
+		BigInteger lambda;
+		BigInteger::MulModN(lambda, numerator, denominator.GetInverseModN(this->p), this->p);
+
+		BigInteger x;
+		BigInteger::SquareModN(x, lambda, this->p);
+		this->subtractModP(x, lhs.x);
+		this->subtractModP(x, rhs.x);
+
+		BigInteger y(lhs.x);
+		this->subtractModP(y, x);
+		BigInteger::MulModN(y, y, lambda, this->p);
+		this->subtractModP(y, lhs.y);
+
+		return Point(std::move(x), std::move(y));
+	}
+
+	/**
+	@param input the point to negate
+	@return @f$ (x, p - y) @f$
+	*/
+	EllipticCurve::Point EllipticCurve::Negate (const Point &input) const {
+		if (input.infinity || input.y == 0) {
+			return input;
+		}
+
+		return Point(input.x, this->p - input.y);
+	}
+
+	/**
+	Left-to-right scalar multiplication with a 4 bit fixed window: precomputes @f$ j \cdot point @f$ for @f$ j = 1 \dots 15 @f$ (normalized with a single modular inversion)
+	and then does 4 point doublings and (at most) one mixed point addition per window.
+
+	Negative scalars are reduced modulo the order of the curve.
+
+	@param point the point to multiply
+	@param scalar the scalar
+	@return @f$ scalar \cdot point @f$
+	*/
+	EllipticCurve::Point EllipticCurve::Multiply (const Point &point, const BigInteger &scalar) const {
+		BigInteger exponent = scalar % this->order;
+		if (point.infinity || exponent == 0) {
+			return Point();
+		}
+
+		//multiples[j - 1] = j * point
+		std::vector<JacobianPoint> jacobianMultiples;
+		jacobianMultiples.reserve(15);
+		jacobianMultiples.push_back(this->toJacobian(point));
+		for (size_t j = 1; j < 15; ++j) {
+			jacobianMultiples.push_back(jacobianMultiples.back());
+			this->addMixed(jacobianMultiples.back(), point);
+		}
+		std::vector<Point> multiples = this->toAffine(jacobianMultiples);
+
+		JacobianPoint output = this->toJacobian(Point());
+		for (size_t window = (exponent.GetSize() + 3) / 4; window > 0; --window) {
+			for (size_t i = 0; i < 4; ++i) {
+				this->doubleJacobian(output);
+			}
+
+			unsigned int digit = 0;
+			for (size_t bit = 4; bit > 0; --bit) {
+				digit = (digit << 1) | static_cast<unsigned int>(exponent.GetBit(4 * (window - 1) + bit - 1));
+			}
+
+			if (digit != 0) {
+				this->addMixed(output, multiples[digit - 1]);
+			}
+		}
+
+		return this->toAffine(output);
+	}
+
+	/**
+	@param input an affine point
+	@return @f$ (x, y, 1) @f$, or @f$ (1, 1, 0) @f$ for the point at infinity
+	*/
+	EllipticCurve::JacobianPoint EllipticCurve::toJacobian (const Point &input) const {
+		JacobianPoint output;
+		if (input.infinity) {
+			output.x = 1;
+			output.y = 1;
+			output.z = 0;
+		}
+		else {
+			output.x = input.x;
+			output.y = input.y;
+			output.z = 1;
+		}
+
+		return output;
+	}
+
+	/**
+	@param input a point in Jacobian coordinates
+	@return @f$ (X / Z^2, Y / Z^3) @f$
+	*/
+	EllipticCurve::Point EllipticCurve::toAffine (const JacobianPoint &input) const {
+		if (input.z == 0) {
+			return Point();
+		}
+
+		BigInteger zInverse = input.z.GetInverseModN(this->p);
+		BigInteger zInverseSquared;
+		BigInteger::SquareModN(zInverseSquared, zInverse, this->p);
+
+		BigInteger x;
+		BigInteger::MulModN(x, input.x, zInverseSquared, this->p);
+		BigInteger y;
+		BigInteger::MulModN(y, input.y, zInverseSquared, this->p);
+		BigInteger::MulModN(y, y, zInverse, this->p);
+
+		return Point(std::move(x), std::move(y));
+	}
+
+	/**
+	Inverts all the @f$ Z @f$ coordinates with a single modular inversion.
+
+	@param inputs points in Jacobian coordinates
+	@return The affine points
+	*/
+	std::vector<EllipticCurve::Point> EllipticCurve::toAffine (const std::vector<JacobianPoint> &inputs) const {
+		std::vector<const BigInteger *> zCoordinates;
+		zCoordinates.reserve(inputs.size());
+		for (std::vector<JacobianPoint>::const_iterator input = inputs.begin(); input != inputs.end(); ++input) {
+			if (input->z != 0) {
+				zCoordinates.push_back(&input->z);
+			}
+		}
+		std::vector<BigInteger> zInverses = BigInteger::BatchInverseModN(zCoordinates, this->p);
+
+		std::vector<Point> output;
+		output.reserve(inputs.size());
+		std::vector<BigInteger>::const_iterator zInverse = zInverses.begin();
+		for (std::vector<JacobianPoint>::const_iterator input = inputs.begin(); input != inputs.end(); ++input) {
+			if (input->z == 0) {
+				output.push_back(Point());
+				continue;
+			}
+
+			BigInteger zInverseSquared;
+			BigInteger::SquareModN(zInverseSquared, *zInverse, this->p);
+
+			BigInteger x;
+			BigInteger::MulModN(x, input->x, zInverseSquared, this->p);
+			BigInteger y;
+			BigInteger::MulModN(y, input->y, zInverseSquared, this->p);
+			BigInteger::MulModN(y, y, *zInverse, this->p);
+
+			output.push_back(Point(std::move(x), std::move(y)));
+			++zInverse;
+		}
+
+		return output;
+	}
+
+	/**
+	@f$ S = 4 X Y^2 @f$, @f$ M = 3 X^2 + a Z^4 @f$, @f$ X' = M^2 - 2 S @f$, @f$ Y' = M (S - X') - 8 Y^4 @f$, @f$ Z' = 2 Y Z @f$
+
+	For @f$ a = -3 @f$ (the NIST curves), @f$ M = 3 (X - Z^2) (X + Z^2) @f$ saves two squarings.
+
+	@param point the point to double (receives the result)
+	*/
+	void EllipticCurve::doubleJacobian (JacobianPoint &point) const {
+		if (point.z == 0) {
+			return;
+		}
+		if (point.y == 0) {
+			point = this->toJacobian(Point());
+			return;
+		}
+
+		//the temporaries keep their storage between the calls (the scalar multiplications do hundreds of point operations)
+		static thread_local BigInteger zSquared;
+		static thread_local BigInteger m;
+		static thread_local BigInteger product;
+		static thread_local BigInteger difference;
+		static thread_local BigInteger ySquared;
+		static thread_local BigInteger s;
+
+		BigInteger::SquareModN(zSquared, point.z, this->p);
+
+		//M = 3 (X - Z^2) (X + Z^2) or 3 X^2 + a Z^4
+		if (this->aIsMinusThree) {
+			difference = point.x;
+			this->subtractModP(difference, zSquared);
+			product = point.x;
+			this->addModP(product, zSquared);
+			BigInteger::MulModN(product, product, difference, this->p);
+			m = product;
+			this->addModP(m, product);
+			this->addModP(m, product);
+		}
+		else {
+			BigInteger::SquareModN(product, point.x, this->p);
+			m = product;
+			this->addModP(m, product);
+			this->addModP(m, product);
+			BigInteger::SquareModN(product, zSquared, this->p);
+			BigInteger::MulModN(product, product, this->a, this->p);
+			this->addModP(m, product);
+		}
+
+		BigInteger::SquareModN(ySquared, point.y, this->p);
+
+		BigInteger::MulModN(s, point.x, ySquared, this->p);
+		this->addModP(s, s);
+		this->addModP(s, s);
+
+		//Z' = 2 Y Z (computed before Y is overwritten)
+		BigInteger::MulModN(point.z, point.y, point.z, this->p);
+		this->addModP(point.z, point.z);
+
+		BigInteger::SquareModN(point.x, m, this->p);
+		this->subtractModP(point.x, s);
+		this->subtractModP(point.x, s);
+
+		//8 Y^4
+		BigInteger::SquareModN(ySquared, ySquared, this->p);
+		this->addModP(ySquared, ySquared);
+		this->addModP(ySquared, ySquared);
+		this->addModP(ySquared, ySquared);
+
+		this->subtractModP(s, point.x);
+		BigInteger::MulModN(point.y, m, s, this->p);
+		this->subtractModP(point.y, ySquared);
+	}
+
+	/**
+	@f$ H = x_2 Z_1^2 - X_1 @f$, @f$ r = y_2 Z_1^3 - Y_1 @f$, @f$ X_3 = r^2 - H^3 - 2 X_1 H^2 @f$, @f$ Y_3 = r (X_1 H^2 - X_3) - Y_1 H^3 @f$, @f$ Z_3 = Z_1 H @f$
+
+	Falls back to doubling when the operands are equal.
+
+	@param lhs the point in Jacobian coordinates (receives the result)
+	@param rhs the affine point
+	*/
+	void EllipticCurve::addMixed (JacobianPoint &lhs, const Point &rhs) const {
+		if (rhs.infinity) {
+			return;
+		}
+		if (lhs.z == 0) {
+			lhs = this->toJacobian(rhs);
+			return;
+		}
+
+		//the temporaries keep their storage between the calls (see doubleJacobian)
+		static thread_local BigInteger zSquared;
+		static thread_local BigInteger h;
+		static thread_local BigInteger r;
+		static thread_local BigInteger hSquared;
+		static thread_local BigInteger hCubed;
+		static thread_local BigInteger v;
+
+		BigInteger::SquareModN(zSquared, lhs.z, this->p);
+		BigInteger::MulModN(h, rhs.x, zSquared, this->p);
+		this->subtractModP(h, lhs.x);
+
+		BigInteger::MulModN(r, rhs.y, zSquared, this->p);
+		BigInteger::MulModN(r, r, lhs.z, this->p);
+		this->subtractModP(r, lhs.y);
+
+		if (h == 0) {
+			if (r == 0) {
+				this->doubleJacobian(lhs);
+			}
+			else {
+				lhs = this->toJacobian(Point());
+			}
+			return;
+		}
+
+		BigInteger::SquareModN(hSquared, h, this->p);
+		BigInteger::MulModN(hCubed, hSquared, h, this->p);
+		BigInteger::MulModN(v, lhs.x, hSquared, this->p);
+
+		BigInteger::MulModN(lhs.z, lhs.z, h, this->p);
+
+		BigInteger::SquareModN(lhs.x, r, this->p);
+		this->subtractModP(lhs.x, hCubed);
+		this->subtractModP(lhs.x, v);
+		this->subtractModP(lhs.x, v);
+
+		BigInteger::MulModN(hCubed, hCubed, lhs.y, this->p);
+		this->subtractModP(v, lhs.x);
+		BigInteger::MulModN(lhs.y, r, v, this->p);
+		this->subtractModP(lhs.y, hCubed);
+	}
+
+	/**
+	@param output the left hand side operand (in @f$ [0, p) @f$), receives @f$ output + input \pmod p @f$
+	@param input the right hand side operand (in @f$ [0, p) @f$)
+	*/
+	void EllipticCurve::addModP (BigInteger &output, const BigInteger &input) const {
+		output += input;
+		if (output >= this->p) {
+			output -= this->p;
+		}
+	}
+
+	/**
+	@param output the left hand side operand (in @f$ [0, p) @f$), receives @f$ output - input \pmod p @f$
+	@param input the right hand side operand (in @f$ [0, p) @f$)
+	*/
+	void EllipticCurve::subtractModP (BigInteger &output, const BigInteger &input) const {
+		output -= input;
+		if (output < 0) {
+			output += this->p;
+		}
+	}
+
+	/**
+	Creates an empty table
+	*/
+	EllipticCurvePointTable::EllipticCurvePointTable () : windowSize(0), windowCount(0) {
+	}
+
+	/**
+	Covers the scalars smaller than the order of the curve. The points of each window are normalized with a single modular inversion.
+
+	@param curve the curve
+	@param base the point @f$ P @f$
+	@param windowSize the window size @f$ w @f$, in bits (defaults to 8: 32 windows of 255 points for a 256 bit curve)
+	@throws std::runtime_error the window size is not in [1, 16]
+	*/
+	EllipticCurvePointTable::EllipticCurvePointTable (const std::shared_ptr<const EllipticCurve> &curve, const EllipticCurve::Point &base, const unsigned int windowSize) :
+		curve(curve), windowSize(windowSize), windowCount(windowSize == 0 ? 0 : (curve->GetOrder().GetSize() + windowSize - 1) / windowSize) {
+		if (windowSize < 1 || windowSize > 16) {
+			throw std::runtime_error("The window size must be between 1 and 16 bits.");
+		}
+
+		const size_t pointsPerWindow = (static_cast<size_t>(1) << windowSize) - 1;
+		this->table.reserve(pointsPerWindow * this->windowCount);
+
+		//windowBase = 2^(w i) P
+		EllipticCurve::Point windowBase = base;
+		for (size_t i = 0; i < this->windowCount; ++i) {
+			std::vector<EllipticCurve::JacobianPoint> multiples;
+			multiples.reserve(pointsPerWindow + 1);
+			multiples.push_back(curve->toJacobian(windowBase));
+			for (size_t j = 1; j <= pointsPerWindow; ++j) {
+				multiples.push_back(multiples.back());
+				curve->addMixed(multiples.back(), windowBase);
+			}
+
+			std::vector<EllipticCurve::Point> affineMultiples = curve->toAffine(multiples);
+			windowBase = affineMultiples.back();
+			affineMultiples.pop_back();
+			std::move(affineMultiples.begin(), affineMultiples.end(), std::back_inserter(this->table));
+		}
+	}
+
+	/**
+	Negative scalars are reduced modulo the order of the curve.
+
+	@param scalar the scalar
+	@return @f$ scalar \cdot P @f$
+	@throws std::runtime_error the table is empty.
+	*/
+	EllipticCurve::Point EllipticCurvePointTable::Multiply (const BigInteger &scalar) const {
+		if (!this->curve) {
+			throw std::runtime_error("The point table is empty.");
+		}
+
+		BigInteger exponent = scalar % this->curve->GetOrder();
+		const size_t pointsPerWindow = (static_cast<size_t>(1) << this->windowSize) - 1;
+
+		EllipticCurve::JacobianPoint output = this->curve->toJacobian(EllipticCurve::Point());
+		for (size_t window = 0; window < this->windowCount; ++window) {
+			size_t digit = 0;
+			for (size_t bit = this->windowSize; bit > 0; --bit) {
+				digit = (digit << 1) | static_cast<size_t>(exponent.GetBit(this->windowSize * window + bit - 1));
+			}
+
+			if (digit != 0) {
+				this->curve->addMixed(output, this->table[pointsPerWindow * window + digit - 1]);
+			}
+		}
+
+		return this->curve->toAffine(output);
+	}
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
@@ -0,0 +1,215 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/elliptic_curve.h
+@brief Definition of classes EllipticCurve and EllipticCurvePointTable.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef ELLIPTIC_CURVE_HEADER_GUARD
+#define ELLIPTIC_CURVE_HEADER_GUARD
+
+#include "big_integer.h"
+
+//include C++ headers
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief Prime order elliptic curve in short Weierstrass form, @f$ y^2 = x^3 + a x + b \pmod p @f$
+
+	The points are exchanged in affine coordinates. The scalar multiplications work in Jacobian coordinates internally,
+	so they need a single modular inversion (when the result is converted back to affine coordinates).
+	*/
+	class EllipticCurve {
+	public:
+		/**
+		@brief A point of the curve, in affine coordinates
+		*/
+		struct Point {
+		public:
+			/// @f$ x @f$
+			BigInteger x;
+
+			/// @f$ y @f$
+			BigInteger y;
+
+			/// True for the point at infinity (the neutral element), in which case x and y are 0
+			bool infinity;
+
+			/// Default constructor - the point at infinity
+			Point ();
+
+			/// Constructor with member initialization
+			Point (const BigInteger &x, const BigInteger &y);
+
+			/// Constructor with member initialization (takes over the inputs)
+			Point (BigInteger &&x, BigInteger &&y);
+
+			/// Equality operator
+			bool operator== (const Point &input) const;
+
+			/// Inequality operator
+			bool operator!= (const Point &input) const;
+		};
+
+		/// Returns the NIST P-256 curve (secp256r1)
+		static const std::shared_ptr<const EllipticCurve> &GetP256 ();
+
+		/// Constructor
+		EllipticCurve (const std::string &name, const BigInteger &p, const BigInteger &a, const BigInteger &b, const Point &generator, const BigInteger &order);
+
+		/// Destructor - void implementation
+		~EllipticCurve () {}
+
+		/// Returns the name of the curve
+		const std::string &GetName () const;
+
+		/// Returns the prime modulus of the field, @f$ p @f$
+		const BigInteger &GetFieldModulus () const;
+
+		/// Returns the (prime) order of the generator, @f$ n @f$
+		const BigInteger &GetOrder () const;
+
+		/// Returns the generator, @f$ G @f$
+		const Point &GetGenerator () const;
+
+		/// Checks if the point satisfies the curve equation
+		bool IsOnCurve (const Point &point) const;
+
+		/// Computes @f$ lhs + rhs @f$
+		Point Add (const Point &lhs, const Point &rhs) const;
+
+		/// Computes @f$ -input @f$
+		Point Negate (const Point &input) const;
+
+		/// Computes @f$ scalar \cdot point @f$
+		Point Multiply (const Point &point, const BigInteger &scalar) const;
+
+	private:
+		/// @brief A point in Jacobian coordinates, @f$ (X, Y, Z) \mapsto (X / Z^2, Y / Z^3) @f$
+		struct JacobianPoint {
+			/// @f$ X @f$
+			BigInteger x;
+
+			/// @f$ Y @f$
+			BigInteger y;
+
+			/// @f$ Z @f$ (0 for the point at infinity)
+			BigInteger z;
+		};
+
+		/// The name of the curve
+		std::string name;
+
+		/// @f$ p @f$
+		BigInteger p;
+
+		/// @f$ a @f$
+		BigInteger a;
+
+		/// @f$ b @f$
+		BigInteger b;
+
+		/// True if @f$ a = -3 \pmod p @f$ (faster point doubling)
+		bool aIsMinusThree;
+
+		/// @f$ G @f$
+		Point generator;
+
+		/// @f$ n @f$
+		BigInteger order;
+
+		/// Converts an affine point to Jacobian coordinates
+		JacobianPoint toJacobian (const Point &input) const;
+
+		/// Converts a Jacobian point to affine coordinates (one modular inversion)
+		Point toAffine (const JacobianPoint &input) const;
+
+		/// Converts several Jacobian points to affine coordinates (one modular inversion for all of them)
+		std::vector<Point> toAffine (const std::vector<JacobianPoint> &inputs) const;
+
+		/// Computes @f$ 2 \cdot point @f$, in place
+		void doubleJacobian (JacobianPoint &point) const;
+
+		/// Computes @f$ lhs + rhs @f$, in place, where rhs is in affine coordinates
+		void addMixed (JacobianPoint &lhs, const Point &rhs) const;
+
+		/// Computes @f$ output + input \pmod p @f$, in place
+		void addModP (BigInteger &output, const BigInteger &input) const;
+
+		/// Computes @f$ output - input \pmod p @f$, in place
+		void subtractModP (BigInteger &output, const BigInteger &input) const;
+
+		friend class EllipticCurvePointTable;
+
+		/// Copy constructor - not implemented
+		EllipticCurve (const EllipticCurve &);
+
+		/// Copy assignment operator - not implemented
+		EllipticCurve operator= (const EllipticCurve &);
+	};
+
+	/**
+	@brief Fixed-base scalar multiplication table for a point of an elliptic curve
+
+	Stores @f$ j \cdot 2^{w i} \cdot P @f$ for @f$ j = 1 \dots 2^w - 1 @f$ and every @f$ w @f$ bit window @f$ i @f$ of the scalars (smaller than the order of the curve),
+	so a scalar multiplication costs at most one mixed point addition per window and no point doublings.
+	*/
+	class EllipticCurvePointTable {
+	public:
+		/// Default constructor - an empty table
+		EllipticCurvePointTable ();
+
+		/// Builds the table for base
+		EllipticCurvePointTable (const std::shared_ptr<const EllipticCurve> &curve, const EllipticCurve::Point &base, const unsigned int windowSize = 8);
+
+		/// Destructor - void implementation
+		~EllipticCurvePointTable () {}
+
+		/// Computes @f$ scalar \cdot P @f$
+		EllipticCurve::Point Multiply (const BigInteger &scalar) const;
+
+	private:
+		/// The curve
+		std::shared_ptr<const EllipticCurve> curve;
+
+		/// @f$ j \cdot 2^{w i} \cdot P @f$, at index @f$ (2^w - 1) i + j - 1 @f$
+		std::vector<EllipticCurve::Point> table;
+
+		/// The window size, @f$ w @f$
+		unsigned int windowSize;
+
+		/// The number of windows
+		size_t windowCount;
+	};
+}//namespace Core
+}//namespace SeComLib
+
+#endif//ELLIPTIC_CURVE_HEADER_GUARD
\ No newline at end of file
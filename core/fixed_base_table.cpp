@@ -0,0 +1,169 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/fixed_base_table.cpp
+@brief Implementation of class FixedBaseTable.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "fixed_base_table.h"
+
+namespace SeComLib {
+namespace Core {
+	/**
+	The table is empty and all exponentiations fall back to BigInteger::GetPowModN.
+	*/
+	FixedBaseTable::FixedBaseTable () : maxPowerSize(0), windowSize(0) {
+	}
+
+	/**
+	Selects the window size with the fewest digits (and thus the fewest multiplications per exponentiation) for which the table fits into memoryBudget.
+	When several window sizes give the same number of digits, the smallest of them is chosen, since the larger ones only cost memory.
+	Building the table requires one modular multiplication per entry.
+
+	@param base the fixed base
+	@param n the modulus
+	@param maxPowerSize the size (in bits) of the largest exponent handled by the table
+	@param memoryBudget the maximum table size, in bytes (0 disables the table)
+	*/
+	FixedBaseTable::FixedBaseTable (const BigInteger &base, const BigInteger &n, const size_t maxPowerSize, const size_t memoryBudget) :
+		base(base),
+		n(n),
+		maxPowerSize(maxPowerSize),
+		windowSize(0) {
+		if (0 == maxPowerSize || n <= 1) {
+			return;
+		}
+
+		size_t bestDigitCount = maxPowerSize + 1;
+		for (size_t windowSize = 1; windowSize <= FIXED_BASE_TABLE_MAX_WINDOW_SIZE; ++windowSize) {
+			size_t digitCount = (maxPowerSize + windowSize - 1) / windowSize;
+			if (digitCount < bestDigitCount && FixedBaseTable::GetTableSize(n, maxPowerSize, windowSize) <= memoryBudget) {
+				bestDigitCount = digitCount;
+				this->windowSize = windowSize;
+			}
+		}
+
+		if (0 == this->windowSize) {
+			return;
+		}
+
+		size_t rowLength = (static_cast<size_t>(1) << this->windowSize) - 1;
+		this->table.reserve(bestDigitCount * rowLength);
+
+		/// Row @f$ i @f$ contains the powers of @f$ b_i = base^{2^{w i}} \pmod n @f$, and @f$ b_{i + 1} = b_i^{2^w - 1} b_i \pmod n @f$
+		BigInteger rowBase = base % n;
+		for (size_t i = 0; i < bestDigitCount; ++i) {
+			this->table.push_back(rowBase);
+			for (size_t j = 1; j < rowLength; ++j) {
+				BigInteger entry;
+				BigInteger::MulModN(entry, this->table.back(), rowBase, n);
+				this->table.push_back(std::move(entry));
+			}
+
+			if (i + 1 < bestDigitCount) {
+				BigInteger::MulModN(rowBase, this->table.back(), rowBase, n);
+			}
+		}
+	}
+
+	/**
+	Multiplies the table entries selected by the digits of power (most significant digit first, so the first non-zero digit is copied instead of multiplied).
+
+	@param power the exponent
+	@return @f$ base^{power} \pmod n @f$
+	*/
+	BigInteger FixedBaseTable::GetPowModN (const BigInteger &power) const {
+		if (!this->Covers(power)) {
+			return this->base.GetPowModN(power, this->n);
+		}
+
+		size_t rowLength = (static_cast<size_t>(1) << this->windowSize) - 1;
+		size_t digitCount = (power.GetSize() + this->windowSize - 1) / this->windowSize;
+
+		BigInteger output;
+		bool first = true;
+
+		for (size_t i = digitCount; i > 0; --i) {
+			size_t digit = 0;
+			for (size_t bit = i * this->windowSize; bit > (i - 1) * this->windowSize; --bit) {
+				digit = (digit << 1) | static_cast<size_t>(power.GetBit(bit - 1));
+			}
+
+			if (0 == digit) {
+				continue;
+			}
+
+			const BigInteger &entry = this->table[(i - 1) * rowLength + digit - 1];
+			if (first) {
+				output = entry;
+				first = false;
+			}
+			else {
+				BigInteger::MulModN(output, output, entry, this->n);
+			}
+		}
+
+		if (first) {
+			output = 1;
+		}
+
+		return output;
+	}
+
+	/**
+	@return true if the table was not built (all exponentiations fall back to BigInteger::GetPowModN), false otherwise
+	*/
+	bool FixedBaseTable::IsEmpty () const {
+		return this->table.empty();
+	}
+
+	/**
+	@param power the exponent
+	@return false if the table is empty, power is negative or it is larger than the table (GetPowModN falls back to BigInteger::GetPowModN), true otherwise
+	*/
+	bool FixedBaseTable::Covers (const BigInteger &power) const {
+		return !this->table.empty() && power >= 0 && power.GetSize() <= this->maxPowerSize;
+	}
+
+	/**
+	@return The window size, in bits
+	*/
+	size_t FixedBaseTable::GetWindowSize () const {
+		return this->windowSize;
+	}
+
+	/**
+	@param n the modulus
+	@param maxPowerSize the size (in bits) of the largest exponent handled by the table
+	@param windowSize the window size, in bits
+	@return The number of entries multiplied by the size of an entry (BigInteger instance and data)
+	*/
+	size_t FixedBaseTable::GetTableSize (const BigInteger &n, const size_t maxPowerSize, const size_t windowSize) {
+		size_t digitCount = (maxPowerSize + windowSize - 1) / windowSize;
+		size_t entrySize = sizeof(BigInteger) + (n.GetSize() + 7) / 8;
+
+		return digitCount * ((static_cast<size_t>(1) << windowSize) - 1) * entrySize;
+	}
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
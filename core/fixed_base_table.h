@@ -0,0 +1,102 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/fixed_base_table.h
+@brief Definition of class FixedBaseTable.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef FIXED_BASE_TABLE_HEADER_GUARD
+#define FIXED_BASE_TABLE_HEADER_GUARD
+
+//include our headers
+#include "big_integer.h"
+
+//include C++ headers
+#include <vector>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief The largest window size (in bits) used by FixedBaseTable.
+
+	Each extra bit halves the number of multiplications, but doubles the table size and the time required to build it.
+	*/
+	#define FIXED_BASE_TABLE_MAX_WINDOW_SIZE 8
+
+	/**
+	@brief Fixed-base windowed exponentiation table.
+
+	Splits the exponent into @f$ d = \lceil bits / w \rceil @f$ digits of @f$ w @f$ bits and stores @f$ base^{j 2^{w i}} \pmod n @f$ for every digit position @f$ i < d @f$ and digit value @f$ 0 < j < 2^w @f$.
+	An exponentiation then requires at most @f$ d - 1 @f$ modular multiplications and no squarings.
+
+	The window size (up to FIXED_BASE_TABLE_MAX_WINDOW_SIZE) is the one with the fewest digits for which the table fits into the specified memory budget.
+	When several window sizes give the same number of digits, the smallest of them is used.
+	Exponents that are negative or larger than the table fall back to BigInteger::GetPowModN, as does an empty table (when the budget is too small).
+	*/
+	class FixedBaseTable {
+	public:
+		/// Default constructor (empty table)
+		FixedBaseTable ();
+
+		/// Builds the table for the specified base and modulus
+		FixedBaseTable (const BigInteger &base, const BigInteger &n, const size_t maxPowerSize, const size_t memoryBudget);
+
+		/// Destructor - void implementation
+		~FixedBaseTable () {}
+
+		/// Computes @f$ base^{power} \pmod n @f$
+		BigInteger GetPowModN (const BigInteger &power) const;
+
+		/// Returns true if the table was not built
+		bool IsEmpty () const;
+
+		/// Returns true if GetPowModN computes @f$ base^{power} \pmod n @f$ from the table
+		bool Covers (const BigInteger &power) const;
+
+		/// Returns the window size (0 for an empty table)
+		size_t GetWindowSize () const;
+
+		/// Returns the estimated table size, in bytes
+		static size_t GetTableSize (const BigInteger &n, const size_t maxPowerSize, const size_t windowSize);
+
+	private:
+		/// The base
+		BigInteger base;
+
+		/// The modulus
+		BigInteger n;
+
+		/// The maximum exponent size (in bits) handled by the table
+		size_t maxPowerSize;
+
+		/// The window size, @f$ w @f$
+		size_t windowSize;
+
+		/// Entry @f$ i (2^w - 1) + j - 1 @f$ contains @f$ base^{j 2^{w i}} \pmod n @f$
+		std::vector<BigInteger> table;
+	};
+}//namespace Core
+}//namespace SeComLib
+
+#endif//FIXED_BASE_TABLE_HEADER_GUARD
\ No newline at end of file
@@ -0,0 +1,334 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/gmp_memory_pool.cpp
+@brief Implementation of class GmpMemoryPool.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "gmp_memory_pool.h"
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief Free lists of the blocks released on one thread, indexed by block size.
+
+	The link to the next block of a list is stored in the first bytes of each free block.
+	*/
+	class GmpMemoryPool::ThreadCache {
+	public:
+		/// The number of free lists
+		static const size_t listCount = GMP_MEMORY_POOL_MAX_BLOCK_SIZE / GMP_MEMORY_POOL_GRANULARITY + 1;
+
+		/// Set when the cache of the calling thread has been destroyed (during the thread exit)
+		static thread_local bool destroyed;
+
+		/// Checks if blocks of the specified size can be cached
+		static bool IsCacheable (const size_t size) {
+			return size >= sizeof(void *) && size <= GMP_MEMORY_POOL_MAX_BLOCK_SIZE && 0 == size % GMP_MEMORY_POOL_GRANULARITY;
+		}
+
+		/// Constructor
+		ThreadCache () : cachedBytes(0) {
+			for (size_t i = 0; i < ThreadCache::listCount; ++i) {
+				this->freeLists[i] = NULL;
+			}
+		}
+
+		/// Destructor - returns the cached blocks to the system allocator
+		~ThreadCache () {
+			this->Clear();
+			ThreadCache::destroyed = true;
+		}
+
+		/**
+		@param size the block size
+		@return A cached block of the specified size or NULL if there isn't any
+		*/
+		void *Pop (const size_t size) {
+			if (!ThreadCache::IsCacheable(size)) {
+				return NULL;
+			}
+
+			void *&head = this->freeLists[size / GMP_MEMORY_POOL_GRANULARITY];
+			void *block = head;
+			if (NULL != block) {
+				head = *static_cast<void **>(block);
+				this->cachedBytes -= size;
+			}
+
+			return block;
+		}
+
+		/**
+		@param block the released block
+		@param size the block size
+		@return true if the block was cached, false if it doesn't fit into the memory budget (the caller must free it)
+		*/
+		bool Push (void *block, const size_t size) {
+			if (!ThreadCache::IsCacheable(size) || this->cachedBytes + size > GmpMemoryPool::memoryBudget.load(std::memory_order_relaxed)) {
+				return false;
+			}
+
+			void *&head = this->freeLists[size / GMP_MEMORY_POOL_GRANULARITY];
+			*static_cast<void **>(block) = head;
+			head = block;
+			this->cachedBytes += size;
+
+			return true;
+		}
+
+		/// Returns all the cached blocks to the system allocator
+		void Clear () {
+			for (size_t i = 0; i < ThreadCache::listCount; ++i) {
+				while (NULL != this->freeLists[i]) {
+					void *block = this->freeLists[i];
+					this->freeLists[i] = *static_cast<void **>(block);
+					std::free(block);
+				}
+			}
+			this->cachedBytes = 0;
+		}
+
+	private:
+		/// The heads of the free lists (freeLists[i] contains blocks of i * GMP_MEMORY_POOL_GRANULARITY bytes)
+		void *freeLists[listCount];
+
+		/// The total size of the cached blocks
+		size_t cachedBytes;
+
+		/// Copy constructor - not implemented
+		ThreadCache (ThreadCache const &);
+
+		/// Copy assignment operator - not implemented
+		ThreadCache operator= (ThreadCache const &);
+	};
+
+	thread_local bool GmpMemoryPool::ThreadCache::destroyed = false;
+
+	std::atomic<size_t> GmpMemoryPool::memoryBudget(0);
+
+	std::atomic<bool> GmpMemoryPool::installed(false);
+
+	void *(*GmpMemoryPool::previousAllocate) (size_t) = NULL;
+
+	void *(*GmpMemoryPool::previousReallocate) (void *, size_t, size_t) = NULL;
+
+	void (*GmpMemoryPool::previousDeallocate) (void *, size_t) = NULL;
+
+	/**
+	Reads the memory budget (in KB) of each thread cache from Core.GmpMemoryPool.memoryBudget. The pool is not installed when it is 0 (the default).
+	*/
+	void GmpMemoryPool::Initialize () {
+		size_t memoryBudget = Utils::Config::GetInstance().GetParameter<size_t>("Core.GmpMemoryPool.memoryBudget", 0) * 1024;
+
+		if (0 != memoryBudget && !GmpMemoryPool::IsInstalled()) {
+			GmpMemoryPool::Install(memoryBudget);
+		}
+	}
+
+	/**
+	Must not be called while other threads use GMP.
+
+	@param memoryBudget the maximum size (in bytes) of the blocks cached by each thread
+	@throws std::runtime_error the pool is already installed
+	*/
+	void GmpMemoryPool::Install (const size_t memoryBudget) {
+		if (GmpMemoryPool::installed.exchange(true)) {
+			throw std::runtime_error("The GMP memory pool is already installed.");
+		}
+
+		GmpMemoryPool::memoryBudget = memoryBudget;
+
+		mp_get_memory_functions(&GmpMemoryPool::previousAllocate, &GmpMemoryPool::previousReallocate, &GmpMemoryPool::previousDeallocate);
+		mp_set_memory_functions(&GmpMemoryPool::allocate, &GmpMemoryPool::reallocate, &GmpMemoryPool::deallocate);
+	}
+
+	/**
+	The blocks cached by the calling thread are released immediately, the ones cached by other threads when those threads exit.
+	The blocks handed out by the pool are regular malloc blocks, so they can still be released by the default GMP memory functions.
+
+	Must not be called while other threads use GMP.
+	*/
+	void GmpMemoryPool::Uninstall () {
+		if (!GmpMemoryPool::installed.exchange(false)) {
+			return;
+		}
+
+		mp_set_memory_functions(GmpMemoryPool::previousAllocate, GmpMemoryPool::previousReallocate, GmpMemoryPool::previousDeallocate);
+
+		ThreadCache *threadCache = GmpMemoryPool::getThreadCache();
+		if (NULL != threadCache) {
+			threadCache->Clear();
+		}
+	}
+
+	/**
+	@return true if the pool is installed, false otherwise
+	*/
+	bool GmpMemoryPool::IsInstalled () {
+		return GmpMemoryPool::installed;
+	}
+
+	/**
+	The counters are updated only while the pool is installed.
+
+	@return The allocation counters of the calling thread
+	*/
+	const GmpMemoryPool::Counters &GmpMemoryPool::GetCounters () {
+		return GmpMemoryPool::getCounters();
+	}
+
+	/**
+	Call at the start of a protocol round to measure the allocations performed during the round.
+	*/
+	void GmpMemoryPool::ResetCounters () {
+		Counters &counters = GmpMemoryPool::getCounters();
+		counters.allocations = 0;
+		counters.reallocations = 0;
+		counters.deallocations = 0;
+		counters.allocatedBytes = 0;
+		counters.poolHits = 0;
+	}
+
+	/**
+	Blocks released while the thread exits (e.g. by the destructors of thread-local objects), after the cache has been destroyed, go straight to the system allocator.
+
+	@return The cache of the calling thread or NULL if it has already been destroyed
+	*/
+	GmpMemoryPool::ThreadCache *GmpMemoryPool::getThreadCache () {
+		if (ThreadCache::destroyed) {
+			return NULL;
+		}
+
+		static thread_local ThreadCache threadCache;
+
+		return &threadCache;
+	}
+
+	/**
+	The counters are trivially destructible, so they remain accessible during the thread exit.
+
+	@return The allocation counters of the calling thread
+	*/
+	GmpMemoryPool::Counters &GmpMemoryPool::getCounters () {
+		static thread_local Counters counters = {0, 0, 0, 0, 0};
+
+		return counters;
+	}
+
+	/**
+	Like the default GMP allocation function, it aborts the program when there is not enough memory (see outOfMemory).
+
+	@param size the requested size
+	@return A block of the requested size
+	*/
+	void *GmpMemoryPool::allocate (size_t size) {
+		Counters &counters = GmpMemoryPool::getCounters();
+		++counters.allocations;
+		counters.allocatedBytes += size;
+
+		ThreadCache *threadCache = GmpMemoryPool::getThreadCache();
+		void *block = NULL != threadCache ? threadCache->Pop(size) : NULL;
+
+		if (NULL != block) {
+			++counters.poolHits;
+			return block;
+		}
+
+		block = std::malloc(size);
+		if (NULL == block) {
+			GmpMemoryPool::outOfMemory(size);
+		}
+
+		return block;
+	}
+
+	/**
+	If the old block is not cacheable, the system allocator resizes it in place when possible.
+
+	@param pointer the block to resize
+	@param oldSize the current size of the block
+	@param newSize the requested size
+	@return A block of the requested size, with the same contents (up to the smallest of the two sizes)
+	*/
+	void *GmpMemoryPool::reallocate (void *pointer, size_t oldSize, size_t newSize) {
+		Counters &counters = GmpMemoryPool::getCounters();
+		++counters.reallocations;
+		counters.allocatedBytes += newSize;
+
+		ThreadCache *threadCache = GmpMemoryPool::getThreadCache();
+		void *block = NULL != threadCache ? threadCache->Pop(newSize) : NULL;
+
+		if (NULL != block) {
+			++counters.poolHits;
+		}
+		else if (NULL == threadCache || !ThreadCache::IsCacheable(oldSize)) {
+			block = std::realloc(pointer, newSize);
+			if (NULL == block) {
+				GmpMemoryPool::outOfMemory(newSize);
+			}
+
+			return block;
+		}
+		else {
+			block = std::malloc(newSize);
+			if (NULL == block) {
+				GmpMemoryPool::outOfMemory(newSize);
+			}
+		}
+
+		std::memcpy(block, pointer, oldSize < newSize ? oldSize : newSize);
+
+		if (!threadCache->Push(pointer, oldSize)) {
+			std::free(pointer);
+		}
+
+		return block;
+	}
+
+	/**
+	@param pointer the released block
+	@param size the size of the block
+	*/
+	void GmpMemoryPool::deallocate (void *pointer, size_t size) {
+		++GmpMemoryPool::getCounters().deallocations;
+
+		ThreadCache *threadCache = GmpMemoryPool::getThreadCache();
+		if (NULL == threadCache || !threadCache->Push(pointer, size)) {
+			std::free(pointer);
+		}
+	}
+
+	/**
+	The memory functions are called from the C code of GMP, which can't unwind an exception and doesn't expect them to fail,
+	so the program is aborted with the same message as the default GMP allocation function.
+
+	@param size the requested size
+	*/
+	void GmpMemoryPool::outOfMemory (const size_t size) {
+		std::fprintf(stderr, "GNU MP: Cannot allocate memory (size=%lu)\n", static_cast<unsigned long>(size));
+		std::abort();
+	}
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
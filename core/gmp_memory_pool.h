@@ -0,0 +1,154 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/gmp_memory_pool.h
+@brief Definition of class GmpMemoryPool.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef GMP_MEMORY_POOL_HEADER_GUARD
+#define GMP_MEMORY_POOL_HEADER_GUARD
+
+//include our headers
+#include "utils/config.h"
+#include "big_integer.h"
+
+//include C++ headers
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief The size granularity (in bytes) of the blocks cached by GmpMemoryPool.
+
+	GMP allocates integer storage in whole limbs, so blocks of any other size are not cached.
+	*/
+	#define GMP_MEMORY_POOL_GRANULARITY sizeof(mp_limb_t)
+
+	/**
+	@brief The size (in bytes) of the largest block cached by GmpMemoryPool.
+
+	Covers the products of 8192 bit operands. Larger blocks go straight to malloc / free.
+	*/
+	#define GMP_MEMORY_POOL_MAX_BLOCK_SIZE 16384
+
+	/**
+	@brief Thread-local memory pool for the GMP (MPIR) integer storage.
+
+	Once installed (via mp_set_memory_functions), every block released by GMP is kept in a free list of the calling thread (one list for each block size)
+	and handed back to the next allocation of the same size on that thread, so the short-lived temporaries created by the protocol rounds
+	no longer go through the (shared) system allocator. Blocks may be released by a different thread than the one which allocated them.
+
+	A block is reused only for requests of exactly the size it was released with, so blocks allocated before the pool was installed are handled safely.
+	The cache of each thread is limited to a memory budget; the blocks which do not fit are returned to the system allocator.
+
+	Each thread also keeps counters of the GMP allocations it performs, which can be reset at the start of a protocol round and read at the end of it.
+
+	The pool is opt-in: call GmpMemoryPool::Initialize at the start of the application (before any threads which use GMP are started)
+	and set Core.GmpMemoryPool.memoryBudget in the configuration file.
+	*/
+	class GmpMemoryPool {
+	public:
+		/// GMP allocation counters of a thread
+		struct Counters {
+			/// The number of allocations
+			size_t allocations;
+
+			/// The number of reallocations
+			size_t reallocations;
+
+			/// The number of deallocations
+			size_t deallocations;
+
+			/// The total size (in bytes) of the allocated and reallocated blocks
+			size_t allocatedBytes;
+
+			/// The number of (re)allocations served from the thread cache
+			size_t poolHits;
+		};
+
+		/// Installs the pool if Core.GmpMemoryPool.memoryBudget is not 0
+		static void Initialize ();
+
+		/// Installs the pool
+		static void Install (const size_t memoryBudget);
+
+		/// Restores the previous GMP memory functions
+		static void Uninstall ();
+
+		/// Checks if the pool is installed
+		static bool IsInstalled ();
+
+		/// Returns the allocation counters of the calling thread
+		static const Counters &GetCounters ();
+
+		/// Resets the allocation counters of the calling thread
+		static void ResetCounters ();
+
+	private:
+		/// The free lists of a thread
+		class ThreadCache;
+
+		/// The memory budget (in bytes) of each thread cache
+		static std::atomic<size_t> memoryBudget;
+
+		/// Flag indicating whether the pool is installed
+		static std::atomic<bool> installed;
+
+		/// The GMP allocation function used before the pool was installed
+		static void *(*previousAllocate) (size_t);
+
+		/// The GMP reallocation function used before the pool was installed
+		static void *(*previousReallocate) (void *, size_t, size_t);
+
+		/// The GMP deallocation function used before the pool was installed
+		static void (*previousDeallocate) (void *, size_t);
+
+		/// Returns the cache of the calling thread (NULL if the thread is exiting)
+		static ThreadCache *getThreadCache ();
+
+		/// Returns the (mutable) allocation counters of the calling thread
+		static Counters &getCounters ();
+
+		/// GMP allocation function
+		static void *allocate (size_t size);
+
+		/// GMP reallocation function
+		static void *reallocate (void *pointer, size_t oldSize, size_t newSize);
+
+		/// GMP deallocation function
+		static void deallocate (void *pointer, size_t size);
+
+		/// Reports a failed allocation and aborts the program
+		static void outOfMemory (const size_t size);
+
+		/// Default constructor - not implemented
+		GmpMemoryPool ();
+	};
+}//namespace Core
+}//namespace SeComLib
+
+#endif//GMP_MEMORY_POOL_HEADER_GUARD
\ No newline at end of file
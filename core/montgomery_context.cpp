@@ -0,0 +1,293 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/montgomery_context.cpp
+@brief Implementation of class MontgomeryContext.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+//only compiled for LIB_GMP_MONTGOMERY (requires the GMP 6 mpz_limbs_* functions, which are not available in MPIR)
+#if defined(LIB_GMP_MONTGOMERY)
+
+#include "montgomery_context.h"
+
+namespace SeComLib {
+namespace Core {
+	/**
+	Each thread keeps its own cache, so no locking is required. When the cache is full, the oldest context is replaced.
+
+	@param n the modulus (must satisfy MontgomeryContext::IsSupported)
+	@return A reference to the cached context.
+	*/
+	const MontgomeryContext &MontgomeryContext::GetInstance (mpz_srcptr n) {
+		static thread_local std::unique_ptr<MontgomeryContext> cache[MONTGOMERY_CONTEXT_CACHE_SIZE];
+		static thread_local size_t nextEntry = 0;
+
+		for (size_t i = 0; i < MONTGOMERY_CONTEXT_CACHE_SIZE; ++i) {
+			if (cache[i] && cache[i]->Matches(n)) {
+				return *cache[i];
+			}
+		}
+
+		std::unique_ptr<MontgomeryContext> &entry = cache[nextEntry];
+		nextEntry = (nextEntry + 1) % MONTGOMERY_CONTEXT_CACHE_SIZE;
+		entry.reset(new MontgomeryContext(n));
+
+		return *entry;
+	}
+
+	/**
+	@param n the modulus
+	@return true if n is odd and its size is between MONTGOMERY_MIN_MODULUS_LIMB_COUNT limbs and MONTGOMERY_MAX_MODULUS_SIZE bits, false otherwise
+	*/
+	bool MontgomeryContext::IsSupported (mpz_srcptr n) {
+		return mpz_sgn(n) > 0 && mpz_odd_p(n) && mpz_size(n) >= MONTGOMERY_MIN_MODULUS_LIMB_COUNT && mpz_size(n) <= MontgomeryContext::maxLimbCount;
+	}
+
+	/**
+	Computes @f$ -n^{-1} \bmod 2^{w} @f$ using Newton's iteration, @f$ R \bmod n @f$ and @f$ R^2 \bmod n @f$.
+
+	@param n the modulus
+	@throws std::runtime_error the modulus is not supported
+	*/
+	MontgomeryContext::MontgomeryContext (mpz_srcptr n) {
+		if (!MontgomeryContext::IsSupported(n)) {
+			throw std::runtime_error("The modulus is not supported by the Montgomery context.");
+		}
+
+		this->limbCount = static_cast<mp_size_t>(mpz_size(n));
+		mpn_copyi(this->modulus, mpz_limbs_read(n), this->limbCount);
+
+		//an odd number is its own inverse modulo 8 and each iteration doubles the number of correct bits
+		mp_limb_t inverse = this->modulus[0];
+		for (int i = 0; i < 5; ++i) {
+			inverse *= 2 - this->modulus[0] * inverse;
+		}
+		this->modulusInverse = static_cast<mp_limb_t>(0) - inverse;
+
+		mpz_t temp;
+		mpz_init(temp);
+
+		mpz_setbit(temp, static_cast<mp_bitcnt_t>(this->limbCount) * GMP_NUMB_BITS);
+		this->load(this->one, temp);
+
+		mpz_set_ui(temp, 0);
+		mpz_setbit(temp, 2 * static_cast<mp_bitcnt_t>(this->limbCount) * GMP_NUMB_BITS);
+		this->load(this->rSquared, temp);
+
+		mpz_clear(temp);
+	}
+
+	/**
+	@param n a modulus
+	@return true if the current context was created for n, false otherwise
+	*/
+	bool MontgomeryContext::Matches (mpz_srcptr n) const {
+		return mpz_sgn(n) > 0 && static_cast<mp_size_t>(mpz_size(n)) == this->limbCount && mpn_cmp(mpz_limbs_read(n), this->modulus, this->limbCount) == 0;
+	}
+
+	/**
+	Negative powers are not supported (BigIntegerGmp falls back to mpz_powm for those). Output may be the same instance as any of the inputs.
+
+	@param output the result
+	@param base the base
+	@param power the exponent (@f$ \geq 0 @f$)
+	*/
+	void MontgomeryContext::PowModN (mpz_ptr output, mpz_srcptr base, mpz_srcptr power) const {
+		mp_limb_t result[MontgomeryContext::maxLimbCount];
+		this->exponentiate(result, base, power);
+
+		//convert back from the Montgomery form
+		mp_limb_t temp[2 * MontgomeryContext::maxLimbCount];
+		mpn_copyi(temp, result, this->limbCount);
+		mpn_zero(temp + this->limbCount, this->limbCount);
+		this->reduce(result, temp);
+
+		this->store(output, result);
+	}
+
+	/**
+	The Montgomery product of @f$ base^{power} @f$ (in Montgomery form) and multiplier (in normal form) is already in normal form, so the final conversion comes for free.
+	Output may be the same instance as any of the inputs.
+
+	@param output the result
+	@param multiplier the multiplier
+	@param base the base
+	@param power the exponent (@f$ \geq 0 @f$)
+	*/
+	void MontgomeryContext::PowMulModN (mpz_ptr output, mpz_srcptr multiplier, mpz_srcptr base, mpz_srcptr power) const {
+		mp_limb_t result[MontgomeryContext::maxLimbCount];
+		this->exponentiate(result, base, power);
+
+		mp_limb_t factor[MontgomeryContext::maxLimbCount];
+		this->load(factor, multiplier);
+		this->multiply(result, result, factor);
+
+		this->store(output, result);
+	}
+
+	/**
+	Computes @f$ input R^{-1} \bmod n @f$ (same algorithm as the GMP internal mpn_redc_1 function). The carries of each step are stored in the low limbs of input, which are zeroed by the reduction.
+
+	@param output receives limbCount limbs
+	@param input 2 * limbCount limbs, @f$ < n R @f$ (destroyed)
+	*/
+	void MontgomeryContext::reduce (mp_limb_t *output, mp_limb_t *input) const {
+		for (mp_size_t i = 0; i < this->limbCount; ++i) {
+			mp_limb_t quotient = input[i] * this->modulusInverse;
+			input[i] = mpn_addmul_1(input + i, this->modulus, this->limbCount, quotient);
+		}
+
+		mp_limb_t carry = mpn_add_n(output, input + this->limbCount, input, this->limbCount);
+
+		if (carry != 0 || mpn_cmp(output, this->modulus, this->limbCount) >= 0) {
+			mpn_sub_n(output, output, this->modulus, this->limbCount);
+		}
+	}
+
+	/**
+	@param output receives @f$ lhs \cdot rhs \cdot R^{-1} \bmod n @f$ (may be the same array as lhs or rhs)
+	@param lhs left hand side operand
+	@param rhs right hand side operand
+	*/
+	void MontgomeryContext::multiply (mp_limb_t *output, const mp_limb_t *lhs, const mp_limb_t *rhs) const {
+		mp_limb_t product[2 * MontgomeryContext::maxLimbCount];
+		mpn_mul_n(product, lhs, rhs, this->limbCount);
+		this->reduce(output, product);
+	}
+
+	/**
+	@param output receives @f$ input^2 \cdot R^{-1} \bmod n @f$ (may be the same array as input)
+	@param input the operand
+	*/
+	void MontgomeryContext::square (mp_limb_t *output, const mp_limb_t *input) const {
+		mp_limb_t product[2 * MontgomeryContext::maxLimbCount];
+		mpn_sqr(product, input, this->limbCount);
+		this->reduce(output, product);
+	}
+
+	/**
+	@param output receives limbCount limbs
+	@param input any integer (negative values and values @f$ \geq n @f$ are reduced modulo n)
+	*/
+	void MontgomeryContext::load (mp_limb_t *output, mpz_srcptr input) const {
+		mp_size_t size = static_cast<mp_size_t>(mpz_size(input));
+
+		if (mpz_sgn(input) >= 0 && (size < this->limbCount || (size == this->limbCount && mpn_cmp(mpz_limbs_read(input), this->modulus, this->limbCount) < 0))) {
+			mpn_copyi(output, mpz_limbs_read(input), size);
+			mpn_zero(output + size, this->limbCount - size);
+			return;
+		}
+
+		mpz_t n;
+		mpz_roinit_n(n, this->modulus, this->limbCount);
+
+		mpz_t reduced;
+		mpz_init(reduced);
+		mpz_mod(reduced, input, n);
+
+		size = static_cast<mp_size_t>(mpz_size(reduced));
+		mpn_copyi(output, mpz_limbs_read(reduced), size);
+		mpn_zero(output + size, this->limbCount - size);
+
+		mpz_clear(reduced);
+	}
+
+	/**
+	@param output the destination
+	@param input limbCount limbs
+	*/
+	void MontgomeryContext::store (mpz_ptr output, const mp_limb_t *input) const {
+		mp_limb_t *limbs = mpz_limbs_write(output, this->limbCount);
+		mpn_copyi(limbs, input, this->limbCount);
+		//mpz_limbs_finish strips the high zero limbs
+		mpz_limbs_finish(output, this->limbCount);
+	}
+
+	/**
+	Left-to-right sliding window exponentiation, using a table of odd powers. The window size grows with the size of the exponent (same thresholds as mpz_powm, up to 6 bits, which keeps the table below 24 KB of stack).
+
+	@param output receives @f$ base^{power} R \bmod n @f$
+	@param base the base
+	@param power the exponent (@f$ \geq 0 @f$)
+	*/
+	void MontgomeryContext::exponentiate (mp_limb_t *output, mpz_srcptr base, mpz_srcptr power) const {
+		if (mpz_sgn(power) == 0) {
+			mpn_copyi(output, this->one, this->limbCount);
+			return;
+		}
+
+		size_t bitCount = mpz_sizeinbase(power, 2);
+		size_t windowSize = bitCount > 672 ? 6 : (bitCount > 240 ? 5 : (bitCount > 80 ? 4 : (bitCount > 24 ? 3 : (bitCount > 7 ? 2 : 1))));
+
+		//table[i] = base^(2i + 1) in Montgomery form
+		mp_limb_t table[1 << 5][MontgomeryContext::maxLimbCount];
+		mp_limb_t baseSquared[MontgomeryContext::maxLimbCount];
+		this->load(baseSquared, base);
+		this->multiply(table[0], baseSquared, this->rSquared);
+		this->square(baseSquared, table[0]);
+		for (size_t i = 1; i < (static_cast<size_t>(1) << (windowSize - 1)); ++i) {
+			this->multiply(table[i], table[i - 1], baseSquared);
+		}
+
+		//the number of exponent bits which have not been processed yet
+		size_t bitIndex = bitCount;
+		bool first = true;
+
+		while (bitIndex > 0) {
+			if (mpz_tstbit(power, bitIndex - 1) == 0) {
+				this->square(output, output);
+				--bitIndex;
+				continue;
+			}
+
+			//the window spans bits [windowEnd, bitIndex) and ends with a set bit
+			size_t windowEnd = bitIndex > windowSize ? bitIndex - windowSize : 0;
+			while (mpz_tstbit(power, windowEnd) == 0) {
+				++windowEnd;
+			}
+
+			size_t window = 0;
+			for (size_t i = bitIndex; i > windowEnd; --i) {
+				window = (window << 1) | static_cast<size_t>(mpz_tstbit(power, i - 1));
+				//the first window contains the most significant bit, so no squarings are required before it
+				if (!first) {
+					this->square(output, output);
+				}
+			}
+
+			if (first) {
+				mpn_copyi(output, table[window >> 1], this->limbCount);
+				first = false;
+			}
+			else {
+				this->multiply(output, output, table[window >> 1]);
+			}
+
+			bitIndex = windowEnd;
+		}
+	}
+}//namespace Core
+}//namespace SeComLib
+
+#endif//LIB_GMP_MONTGOMERY
\ No newline at end of file
@@ -0,0 +1,138 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/montgomery_context.h
+@brief Definition of class MontgomeryContext.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef MONTGOMERY_CONTEXT_HEADER_GUARD
+#define MONTGOMERY_CONTEXT_HEADER_GUARD
+
+//include our headers
+#include "big_integer_gmp.h"
+
+//include C++ headers
+#include <memory>
+#include <stdexcept>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief The largest modulus (in bits) handled by MontgomeryContext.
+
+	Covers @f$ n^2 @f$ for 3072 bit Paillier moduli. Larger moduli fall back to the regular GMP functions.
+	*/
+	#define MONTGOMERY_MAX_MODULUS_SIZE 6144
+
+	/**
+	@brief The smallest modulus (in limbs) handled by MontgomeryContext.
+
+	For tiny moduli, the context lookup costs more than the regular GMP functions.
+	*/
+	#define MONTGOMERY_MIN_MODULUS_LIMB_COUNT 4
+
+	/**
+	@brief The number of Montgomery contexts cached (per thread) by MontgomeryContext::GetInstance
+	*/
+	#define MONTGOMERY_CONTEXT_CACHE_SIZE 16
+
+	/**
+	@brief Montgomery arithmetic for a fixed, odd modulus.
+
+	Stores the precomputed values required for Montgomery multiplication (@f$ -n^{-1} \bmod 2^{w} @f$, @f$ R \bmod n @f$ and @f$ R^2 \bmod n @f$, where @f$ R = 2^{w \cdot size(n)} @f$ and @f$ w @f$ is the limb size)
+	and performs all intermediate computations on fixed-width, stack-resident limb arrays, using the GMP low-level (mpn) functions.
+	Values are kept in Montgomery form for the whole duration of an exponentiation and converted back only once.
+
+	Used by BigIntegerGmp when the library is built with LIB_GMP_MONTGOMERY.
+	*/
+	class MontgomeryContext {
+	public:
+		/// The maximum number of limbs of the modulus
+		static const size_t maxLimbCount = MONTGOMERY_MAX_MODULUS_SIZE / GMP_NUMB_BITS;
+
+		/// Returns the cached context of the current thread for the specified modulus (the context is created if required)
+		static const MontgomeryContext &GetInstance (mpz_srcptr n);
+
+		/// Checks if n can be handled by this class
+		static bool IsSupported (mpz_srcptr n);
+
+		/// Constructor
+		MontgomeryContext (mpz_srcptr n);
+
+		/// Destructor - void implementation
+		~MontgomeryContext () {}
+
+		/// Checks if the context was created for modulus n
+		bool Matches (mpz_srcptr n) const;
+
+		/// Computes @f$ base^{power} \pmod n @f$
+		void PowModN (mpz_ptr output, mpz_srcptr base, mpz_srcptr power) const;
+
+		/// Computes @f$ multiplier \cdot base^{power} \pmod n @f$
+		void PowMulModN (mpz_ptr output, mpz_srcptr multiplier, mpz_srcptr base, mpz_srcptr power) const;
+
+	private:
+		/// The number of limbs of the modulus
+		mp_size_t limbCount;
+
+		/// The modulus
+		mp_limb_t modulus[maxLimbCount];
+
+		/// @f$ -n^{-1} \bmod 2^{w} @f$
+		mp_limb_t modulusInverse;
+
+		/// @f$ R \bmod n @f$ (1 in Montgomery form)
+		mp_limb_t one[maxLimbCount];
+
+		/// @f$ R^2 \bmod n @f$
+		mp_limb_t rSquared[maxLimbCount];
+
+		/// Montgomery reduction of a double-width input
+		void reduce (mp_limb_t *output, mp_limb_t *input) const;
+
+		/// Montgomery multiplication
+		void multiply (mp_limb_t *output, const mp_limb_t *lhs, const mp_limb_t *rhs) const;
+
+		/// Montgomery squaring
+		void square (mp_limb_t *output, const mp_limb_t *input) const;
+
+		/// Loads input into a fixed-width limb array, reducing it modulo n if required
+		void load (mp_limb_t *output, mpz_srcptr input) const;
+
+		/// Stores a fixed-width limb array into output
+		void store (mpz_ptr output, const mp_limb_t *input) const;
+
+		/// Computes @f$ base^{power} @f$ in Montgomery form
+		void exponentiate (mp_limb_t *output, mpz_srcptr base, mpz_srcptr power) const;
+
+		/// Copy constructor - not implemented
+		MontgomeryContext (MontgomeryContext const &);
+
+		/// Copy assignment operator - not implemented
+		MontgomeryContext operator= (MontgomeryContext const &);
+	};
+}//namespace Core
+}//namespace SeComLib
+
+#endif//MONTGOMERY_CONTEXT_HEADER_GUARD
\ No newline at end of file
@@ -55,6 +55,14 @@ namespace Core {
 		CiphertextBase<OkamotoUchiyamaCiphertext> (data, encryptionModulus) {
 	}
 
+	/**
+	@param data the ciphertext data, moved into the current instance
+	@param encryptionModulus The encryption modulus
+	*/
+	OkamotoUchiyamaCiphertext::OkamotoUchiyamaCiphertext (BigInteger &&data, const std::shared_ptr<BigInteger> &encryptionModulus) :
+		CiphertextBase<OkamotoUchiyamaCiphertext> (std::move(data), encryptionModulus) {
+	}
+
 	/**
 	*/
 	OkamotoUchiyamaRandomizer::OkamotoUchiyamaRandomizer () : RandomizerBase() {
@@ -67,6 +75,13 @@ namespace Core {
 	OkamotoUchiyamaRandomizer::OkamotoUchiyamaRandomizer (const BigInteger &data) : RandomizerBase(data) {
 	}
 
+	/**
+	Takes over the data
+	@param data the randomizer data
+	*/
+	OkamotoUchiyamaRandomizer::OkamotoUchiyamaRandomizer (BigInteger &&data) : RandomizerBase(std::move(data)) {
+	}
+
 	/**
 	Fetch the key lengh from the configuration file (defaults to 1024).
 	*/
@@ -100,6 +115,13 @@ namespace Core {
 		this->doPrecomputations();
 	}
 
+	/**
+	Stops the producer threads of the randomizer cache before the members they use are destroyed.
+	*/
+	OkamotoUchiyama::~OkamotoUchiyama () {
+		this->randomizerCache.reset();
+	}
+
 	/**
 	Generates the Okamoto-Uchiyama cryptosystem keys.
 
@@ -107,6 +129,9 @@ namespace Core {
 	@throws std::runtime_error parameter errors
 	*/
 	bool OkamotoUchiyama::GenerateKeys() {
+		//stop the producer threads of the randomizer cache before the keys change
+		this->randomizerCache.reset();
+
 		/// Fetch the size of the parameter @f$ t @f$ from the configuration file (defaults to 160)
 		unsigned int sizeT = Utils::Config::GetInstance().GetParameter("Core.OkamotoUchiyama.sizeT", 160);
 
@@ -120,29 +145,21 @@ namespace Core {
 		/// Generate primes @f$ p @f$ and @f$ q @f$ of roughly size keyLength / 3, ensuring that @f$ p - 1 @f$ has a large prime factor of size specified by the t parameter
 
 		//pick a random prime t of size specified by sizeT
-		this->privateKey.t = RandomProvider::GetInstance().GetMaxLengthRandomPrime(sizeT);
+		this->privateKey.t = PrimeSearch::GetMaxLengthRandomPrime(sizeT);
 
 		/// @f$ p - 1 = t u @f$, where @f$ u @f$ is a random number in @f$ \mathbb{Z}_n @f$
 		/// u - local variable required for cumputing p, H and G
 		BigInteger u;
 		unsigned int sizeU = primeLength - sizeT;
-		do {
-			//generate a random number in the interval [0, 2^(sizeU - 1))
-			u = RandomProvider::GetInstance().GetRandomInteger(sizeU - 1);
-
-			//shift number to the interval [2^(sizeU - 1), 2^sizeU)
-			u.SetBit(sizeU - 1);
 
-			//u and t must divide p - 1
-			this->privateKey.p = this->privateKey.t * u + 1;
-		}
-		while (!this->privateKey.p.IsPrime());
+		//u, in the interval [2^(sizeU - 1), 2^sizeU), and t must divide p - 1
+		this->privateKey.p = PrimeSearch::GetLinearFormPrime(u, this->privateKey.t, sizeU, false);
 
 		//precompute p^2 and store it for the decryption operation
 		this->pSquared = this->privateKey.p.GetPow(2);
 
 		/// Generate prime q of size keyLength
-		this->privateKey.q = RandomProvider::GetInstance().GetMaxLengthRandomPrime(primeLength);
+		this->privateKey.q = PrimeSearch::GetMaxLengthRandomPrime(primeLength);
 
 		/// Compute @f$ n = p^2 q @f$
 		this->publicKey.n = this->pSquared * this->privateKey.q;
@@ -204,7 +221,8 @@ namespace Core {
 		}
 
 		/// Compute @f$ m = L(c^t \pmod {p^2}) L(g_p)^{-1} \pmod p @f$
-		BigInteger output = (this->L(ciphertext.data.GetPowModN(this->privateKey.t, this->pSquared)) * this->lgpInv) % this->privateKey.p;
+		BigInteger output = this->L(ciphertext.data.GetPowModN(this->privateKey.t, this->pSquared));
+		output.MultiplyModN(this->lgpInv, this->privateKey.p);
 
 		/// If @f$ plaintext \leq \lfloor messagespace / 2 \rfloor \Rightarrow plaintext \geq 0 @f$ otherwise @f$ plaintext < 0 \Rightarrow plaintext = plaintext - messagespace  @f$
 		if (output > this->positiveNegativeBoundary) {
@@ -232,35 +250,43 @@ namespace Core {
 
 		/// Compute @f$ c = G^m \pmod n @f$
 
-		/// If @f$ plaintext < 0 @f$, we remap it to the second half of the message space
-		if (plaintext < 0) {
-			if (this->hasPrivateKey) {
-				output.data = this->publicKey.G.GetPowModN(this->GetMessageSpaceUpperBound() + plaintext, this->GetEncryptionModulus());
-			}
+		if (!this->hasPrivateKey) {
 			/**
-			If the private key is not available, we remap the message by computing the inverse of the ciphertext modulo @f$ n @f$ (which is equivalent to a homomorphic multiplication with @f$ -1 @f$).
+			If @f$ plaintext < 0 @f$, we remap the message by computing the inverse of the ciphertext modulo @f$ n @f$ (which is equivalent to a homomorphic multiplication with @f$ -1 @f$),
+			since the private key is not available.
 			Note that this operation is slower than remapping the value in plain text.
 			*/
+			if (plaintext < 0) {
+				output.data = this->GTable.GetPowModN(plaintext.GetAbs()).GetInverseModN(this->GetEncryptionModulus());
+			}
 			else {
-				output.data = this->publicKey.G.GetPowModN(plaintext.GetAbs(), this->GetEncryptionModulus()).GetInverseModN(this->GetEncryptionModulus());
+				output.data = this->GTable.GetPowModN(plaintext);
 			}
 		}
 		else {
-			output.data = this->publicKey.G.GetPowModN(plaintext, this->GetEncryptionModulus());
+			/// Fast version: @f$ c = G^m \pmod n = CRT(G^m \bmod p^2, G^{m \bmod (q - 1)} \bmod q) @f$ (if @f$ plaintext < 0 @f$, we remap it to the second half of the message space)
+			BigInteger exponent = plaintext < 0 ? this->GetMessageSpaceUpperBound() + plaintext : plaintext;
+			output.data = this->combineResidues(this->GModPSquaredTable.GetPowModN(exponent), this->GModQTable.GetPowModN(exponent % this->qMinusOne));
 		}
 
 		return output;
 	}
 
 	/**
-	Generates a random number @f$ r \in \mathbb{Z}_n^* @f$ and computes @f$ r^n \pmod {n^2} @f$.
+	Generates a random number @f$ r \in \mathbb{Z}_n^* @f$ and computes @f$ H^r \pmod n @f$.
 
-	Computes @f$ H^r \pmod n @f$.
+	If the private key is available, computes @f$ H^r \pmod n = CRT(H^{r \bmod p (p - 1)} \bmod p^2, H^{r \bmod (q - 1)} \bmod q) @f$, with much shorter exponents and moduli.
 
 	@return the random factor
 	*/
 	OkamotoUchiyama::Randomizer OkamotoUchiyama::GetRandomizer () const {
-		return Randomizer(this->publicKey.H.GetPowModN((RandomProvider::GetInstance().GetRandomInteger(this->publicKey.n - 1) + 1), this->publicKey.n));
+		BigInteger random = RandomProvider::GetInstance().GetRandomInteger(this->publicKey.n - 1) + 1;
+
+		if (!this->hasPrivateKey) {
+			return Randomizer(this->HTable.GetPowModN(random));
+		}
+
+		return Randomizer(this->combineResidues(this->HModPSquaredTable.GetPowModN(random % this->pTimesPMinusOne), this->HModQTable.GetPowModN(random % this->qMinusOne)));
 	}
 
 	/**
@@ -270,7 +296,10 @@ namespace Core {
 	@return The randomized ciphertext
 	*/
 	OkamotoUchiyama::Ciphertext OkamotoUchiyama::RandomizeCiphertext (const OkamotoUchiyama::Ciphertext &ciphertext) const {
-		return Ciphertext((ciphertext.data * this->randomizerCache->Pop().randomizer.data) % this->GetEncryptionModulus(), this->encryptionModulus);
+		Ciphertext output(this->encryptionModulus);
+		BigInteger::MulModN(output.data, ciphertext.data, this->randomizerCache->Pop().randomizer.data, this->GetEncryptionModulus());
+
+		return output;
 	}
 
 	/**
@@ -287,6 +316,13 @@ namespace Core {
 		return this->messageSpaceSize;
 	}
 
+	/**
+	@return The provider name and the hexadecimal public key components.
+	*/
+	std::string OkamotoUchiyama::GetPublicKeyFingerprint () const {
+		return "OkamotoUchiyama:n=" + this->publicKey.n.ToString(16) + ",G=" + this->publicKey.G.ToString(16) + ",H=" + this->publicKey.H.ToString(16);
+	}
+
 	/**
 	Computes @f$ L(u) = \frac{u - 1}{n} @f$
 	@param input the function variable
@@ -300,9 +336,25 @@ namespace Core {
 		return output;
 	}
 
+	/**
+	Computes @f$ x = a q (q^{-1} \pmod {p^2}) + b p^2 (p^{-2} \pmod q) \pmod n @f$, where @f$ x \equiv a \pmod {p^2} @f$ and @f$ x \equiv b \pmod q @f$.
+
+	@param residueModPSquared @f$ a @f$
+	@param residueModQ @f$ b @f$
+	@return @f$ x @f$
+	*/
+	BigInteger OkamotoUchiyama::combineResidues (const BigInteger &residueModPSquared, const BigInteger &residueModQ) const {
+		BigInteger output = residueModQ * this->pSquaredTimesPSquaredInvModQ;
+		BigInteger::MulAddModN(output, residueModPSquared, this->qTimesQInvModPSquared, output, this->publicKey.n);
+
+		return output;
+	}
+
 	/**
 	Precomputes the message space delimiter between positive and negative values.
 
+	Builds the fixed-base tables for @f$ G @f$ and @f$ H @f$ (modulo @f$ p^2 @f$ and @f$ q @f$ if the private key is available, otherwise modulo @f$ n @f$), each within the Core.FixedBaseTable.memoryBudget limit.
+
 	Precomputes [0] and [1].
 	*/
 	void OkamotoUchiyama::doPrecomputations () {
@@ -317,6 +369,19 @@ namespace Core {
 
 			/// Decryption spedup: Precompute @f$ L(g_p)^{-1} \pmod p @f$
 			this->lgpInv = this->L(this->privateKey.gp).GetInverseModN(this->privateKey.p);
+
+			/// Encryption speedup: precompute the orders of @f$ \mathbb{Z}_{p^2}^* @f$ and @f$ \mathbb{Z}_q^* @f$, @f$ q (q^{-1} \pmod {p^2}) @f$ and @f$ p^2 (p^{-2} \pmod q) @f$
+			this->pTimesPMinusOne = this->privateKey.p * (this->privateKey.p - 1);
+			this->qMinusOne = this->privateKey.q - 1;
+			try {
+				this->qTimesQInvModPSquared = this->privateKey.q * this->privateKey.q.GetInverseModN(this->pSquared);
+				this->pSquaredTimesPSquaredInvModQ = this->pSquared * this->pSquared.GetInverseModN(this->privateKey.q);
+			}
+			/// @todo Catch a custom exception here
+			catch (const std::runtime_error &) {
+				//if gcd(p, q) != 1, throw an error
+				throw std::runtime_error("p and q are not coprime.");
+			}
 		}
 		/**
 		If the private key is not available, then we threshold the message space with a number smaller than @f$ p @f$.
@@ -330,6 +395,19 @@ namespace Core {
 		//set the encryption modulus, @f$ n @f$
 		this->encryptionModulus = std::make_shared<BigInteger>(this->publicKey.n);
 
+		/// Encryption exponents are smaller than the message space and randomizer exponents are smaller than @f$ n @f$
+		size_t memoryBudget = Utils::Config::GetInstance().GetParameter<size_t>("Core.FixedBaseTable.memoryBudget", 1024) * 1024;
+		if (this->hasPrivateKey) {
+			this->GModPSquaredTable = FixedBaseTable(this->publicKey.G, this->pSquared, this->GetMessageSpaceUpperBound().GetSize(), memoryBudget);
+			this->GModQTable = FixedBaseTable(this->publicKey.G, this->privateKey.q, this->qMinusOne.GetSize(), memoryBudget);
+			this->HModPSquaredTable = FixedBaseTable(this->publicKey.H, this->pSquared, this->pTimesPMinusOne.GetSize(), memoryBudget);
+			this->HModQTable = FixedBaseTable(this->publicKey.H, this->privateKey.q, this->qMinusOne.GetSize(), memoryBudget);
+		}
+		else {
+			this->GTable = FixedBaseTable(this->publicKey.G, this->publicKey.n, this->GetMessageSpaceUpperBound().GetSize(), memoryBudget);
+			this->HTable = FixedBaseTable(this->publicKey.H, this->publicKey.n, this->publicKey.n.GetSize(), memoryBudget);
+		}
+
 		//precompute the limit between positive and negative values in the message space
 		this->positiveNegativeBoundary = this->GetMessageSpaceUpperBound() / 2;
 		
@@ -31,9 +31,11 @@ limitations under the License.
 
 #include "big_integer.h"
 #include "random_provider.h"
+#include "prime_search.h"
 #include "ciphertext_base.h"
 #include "crypto_provider.h"
 #include "utils/config.h"
+#include "fixed_base_table.h"
 
 //include C++ headers
 #include <stdexcept>
@@ -81,6 +83,9 @@ namespace Core {
 
 		/// Constructor with data and encryption modulus initialization
 		OkamotoUchiyamaCiphertext (const BigInteger &data, const std::shared_ptr<BigInteger> &encryptionModulus);
+
+		/// Constructor with data (taken over) and encryption modulus initialization
+		OkamotoUchiyamaCiphertext (BigInteger &&data, const std::shared_ptr<BigInteger> &encryptionModulus);
 	};
 
 	/**
@@ -92,6 +97,9 @@ namespace Core {
 
 		/// Constructor with initialization
 		OkamotoUchiyamaRandomizer (const BigInteger &data);
+
+		/// Constructor with initialization (takes over the input)
+		OkamotoUchiyamaRandomizer (BigInteger &&data);
 	};
 
 	/**
@@ -111,7 +119,7 @@ namespace Core {
 		OkamotoUchiyama (const OkamotoUchiyamaPublicKey &publicKey, const OkamotoUchiyamaPrivateKey &privateKey);
 
 		/// Destructor
-		~OkamotoUchiyama () {}
+		~OkamotoUchiyama ();
 
 		/* Base class methods */
 
@@ -136,6 +144,9 @@ namespace Core {
 		/// Returns the message space bit size
 		virtual size_t GetMessageSpaceSize () const;
 
+		/// Returns a string which identifies the public key
+		virtual std::string GetPublicKeyFingerprint () const;
+
 		/* /Base class methods */
 
 	private:
@@ -154,6 +165,39 @@ namespace Core {
 		/// Stores precomputed value @f$ L(g_p)^{-1} \pmod p @f$ used to speedup decyption
 		BigInteger lgpInv;
 
+		/// @f$ p (p - 1) @f$, the order of @f$ \mathbb{Z}_{p^2}^* @f$
+		BigInteger pTimesPMinusOne;
+
+		/// @f$ q - 1 @f$
+		BigInteger qMinusOne;
+
+		/// @f$ p^2 (p^{-2} \pmod q) @f$
+		BigInteger pSquaredTimesPSquaredInvModQ;
+
+		/// @f$ q (q^{-1} \pmod {p^2}) @f$
+		BigInteger qTimesQInvModPSquared;
+
+		/// Fixed-base table for @f$ G \pmod n @f$ (public key only)
+		FixedBaseTable GTable;
+
+		/// Fixed-base table for @f$ H \pmod n @f$ (public key only)
+		FixedBaseTable HTable;
+
+		/// Fixed-base table for @f$ G \pmod {p^2} @f$ (private key)
+		FixedBaseTable GModPSquaredTable;
+
+		/// Fixed-base table for @f$ G \pmod q @f$ (private key)
+		FixedBaseTable GModQTable;
+
+		/// Fixed-base table for @f$ H \pmod {p^2} @f$ (private key)
+		FixedBaseTable HModPSquaredTable;
+
+		/// Fixed-base table for @f$ H \pmod q @f$ (private key)
+		FixedBaseTable HModQTable;
+
+		/// Combines the residues modulo @f$ p^2 @f$ and @f$ q @f$ into a value modulo @f$ n @f$
+		BigInteger combineResidues (const BigInteger &residueModPSquared, const BigInteger &residueModQ) const;
+
 		/// L function evaluator
 		BigInteger L (const BigInteger &input) const;
 
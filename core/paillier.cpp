@@ -55,6 +55,14 @@ namespace Core {
 		CiphertextBase<PaillierCiphertext> (data, encryptionModulus) {
 	}
 
+	/**
+	@param data the ciphertext data, moved into the current instance
+	@param encryptionModulus The encryption modulus
+	*/
+	PaillierCiphertext::PaillierCiphertext (BigInteger &&data, const std::shared_ptr<BigInteger> &encryptionModulus) :
+		CiphertextBase<PaillierCiphertext> (std::move(data), encryptionModulus) {
+	}
+
 	/**
 	*/
 	PaillierRandomizer::PaillierRandomizer () : RandomizerBase() {
@@ -67,10 +75,20 @@ namespace Core {
 	PaillierRandomizer::PaillierRandomizer (const BigInteger &data) : RandomizerBase(data) {
 	}
 
+	/**
+	Takes over the data
+	@param data the randomizer data
+	*/
+	PaillierRandomizer::PaillierRandomizer (BigInteger &&data) : RandomizerBase(std::move(data)) {
+	}
+
 	/**
 	Sets the specified key size from the configuration file (defaults to 1024)
 	*/
-	Paillier::Paillier () : CryptoProvider<PaillierPublicKey, PaillierPrivateKey, PaillierCiphertext, PaillierRandomizer>(Utils::Config::GetInstance().GetParameter("Core.Paillier.keySize", 1024)) {
+	Paillier::Paillier () : CryptoProvider<PaillierPublicKey, PaillierPrivateKey, PaillierCiphertext, PaillierRandomizer>(Utils::Config::GetInstance().GetParameter("Core.Paillier.keySize", 1024)),
+		shortRandomizers(false),
+		shortRandomizerExponentSize(0),
+		parallelDecryption(false) {
 	}
 
 	/**
@@ -78,7 +96,10 @@ namespace Core {
 
 	@param publicKey a PaillierPublicKey structure
 	*/
-	Paillier::Paillier (const PaillierPublicKey &publicKey) : CryptoProvider<PaillierPublicKey, PaillierPrivateKey, PaillierCiphertext, PaillierRandomizer>(publicKey, Utils::Config::GetInstance().GetParameter("Core.Paillier.keySize", 1024)) {
+	Paillier::Paillier (const PaillierPublicKey &publicKey) : CryptoProvider<PaillierPublicKey, PaillierPrivateKey, PaillierCiphertext, PaillierRandomizer>(publicKey, Utils::Config::GetInstance().GetParameter("Core.Paillier.keySize", 1024)),
+		shortRandomizers(false),
+		shortRandomizerExponentSize(0),
+		parallelDecryption(false) {
 		//C++ doesn't allow us to call a virtual method in the constructor of the base class
 		this->doPrecomputations();
 	}
@@ -90,11 +111,21 @@ namespace Core {
 	@param privateKey a PaillierPrivateKey structure
 	*/
 	Paillier::Paillier (const PaillierPublicKey &publicKey, const PaillierPrivateKey &privateKey) :
-		CryptoProvider<PaillierPublicKey, PaillierPrivateKey, PaillierCiphertext, PaillierRandomizer>(publicKey, privateKey, Utils::Config::GetInstance().GetParameter("Core.Paillier.keySize", 1024)) {
+		CryptoProvider<PaillierPublicKey, PaillierPrivateKey, PaillierCiphertext, PaillierRandomizer>(publicKey, privateKey, Utils::Config::GetInstance().GetParameter("Core.Paillier.keySize", 1024)),
+		shortRandomizers(false),
+		shortRandomizerExponentSize(0),
+		parallelDecryption(false) {
 		//C++ doesn't allow us to call a virtual method in the constructor of the base class
 		this->doPrecomputations();
 	}
 
+	/**
+	Stops the producer threads of the randomizer cache before the members they use are destroyed.
+	*/
+	Paillier::~Paillier () {
+		this->randomizerCache.reset();
+	}
+
 	/**
 	Generates the Paillier cryptosystem keys.
 
@@ -103,19 +134,22 @@ namespace Core {
 	@return Always true, for now
 	*/
 	bool Paillier::GenerateKeys () {
+		//stop the producer threads of the randomizer cache before the keys change
+		this->randomizerCache.reset();
+
 		/// Set the length of primes p and q
 		unsigned int primeLength = (unsigned int)(this->keyLength / 2);
 
 		do {
-			this->privateKey.p = RandomProvider::GetInstance().GetMaxLengthRandomPrime(primeLength);
-			this->privateKey.q = RandomProvider::GetInstance().GetMaxLengthRandomPrime(primeLength);
+			this->privateKey.p = PrimeSearch::GetMaxLengthRandomPrime(primeLength);
+			this->privateKey.q = PrimeSearch::GetMaxLengthRandomPrime(primeLength);
 
 			//std::cout << this->privateKey.p.GetSize() << std::endl;
 			//std::cout << this->privateKey.q.GetSize() << std::endl;
 	
 			/// If both are equal (highly unlikely) seek another prime
 			while (this->privateKey.p == this->privateKey.q) {
-				this->privateKey.p = RandomProvider::GetInstance().GetMaxLengthRandomPrime(primeLength);
+				this->privateKey.p = PrimeSearch::GetMaxLengthRandomPrime(primeLength);
 			}
 
 			/// Compute @f$ n = p q @f$
@@ -192,9 +226,27 @@ namespace Core {
 		@f$ m_q = L_q(c^{q - 1} (\pmod q^2)) h_q \pmod q @f$
 		@f$ m = (m_p q (q^{-1} \pmod p) + m_q p (p^{-1} \pmod q)) (\pmod n) @f$
 		*/
-		BigInteger mp = (this->L(ciphertext.data.GetPowModN(this->pMinusOne, this->pSquared), this->privateKey.p) * this->hp) % this->privateKey.p;
-		BigInteger mq = (this->L(ciphertext.data.GetPowModN(this->qMinusOne, this->qSquared), this->privateKey.q) * this->hq) % this->privateKey.q;
-		BigInteger output = (mp * this->qTimesQInvModP + mq * this->pTimesPInvModQ) % this->publicKey.n;
+		BigInteger mp;
+		BigInteger mq;
+
+		/// For large keys, @f$ m_p @f$ and @f$ m_q @f$ are computed in parallel (the calling thread hands one of them off to the WorkerPool)
+		if (this->parallelDecryption) {
+			WorkerPool::GetInstance().ParallelFor(2, [this, &ciphertext, &mp, &mq] (const size_t index) {
+				if (0 == index) {
+					mp = this->decryptModPrime(ciphertext.data, this->privateKey.p, this->pMinusOne, this->pSquared, this->hp);
+				}
+				else {
+					mq = this->decryptModPrime(ciphertext.data, this->privateKey.q, this->qMinusOne, this->qSquared, this->hq);
+				}
+			});
+		}
+		else {
+			mp = this->decryptModPrime(ciphertext.data, this->privateKey.p, this->pMinusOne, this->pSquared, this->hp);
+			mq = this->decryptModPrime(ciphertext.data, this->privateKey.q, this->qMinusOne, this->qSquared, this->hq);
+		}
+
+		BigInteger output = mq * this->pTimesPInvModQ;
+		BigInteger::MulAddModN(output, mp, this->qTimesQInvModP, output, this->publicKey.n);
 	#endif
 
 		/// If @f$ plaintext \leq \lfloor messagespace / 2 \rfloor \Rightarrow plaintext \geq 0 @f$ otherwise @f$ plaintext < 0 \Rightarrow plaintext = plaintext - messagespace  @f$
@@ -208,6 +260,8 @@ namespace Core {
 	/**
 	Contains the "standard" and "shortcut" versions of the Paillier encryption algorithm without randomization.
 
+	The "shortcut" version does not need any exponentiation, so it is used with or without the private key (the key holder only speeds up the randomizers, see GetRandomizer).
+
 	@param plaintext the plaintext integer
 	@return Encrypted ciphertext
 	*/
@@ -252,12 +306,37 @@ namespace Core {
 	/**
 	Generates a random number @f$ r \in \mathbb{Z}_n^* @f$ and computes @f$ r^n \pmod {n^2} @f$.
 
-	Computes @f$ r^n \pmod {n^2} @f$.
+	If Core.Paillier.shortRandomizers is set, generates a random exponent @f$ \alpha @f$ of @f$ 2 t @f$ bits (Core.Paillier.t) and computes @f$ h_s^{\alpha} \pmod {n^2} @f$ using a fixed-base table.
+	Since @f$ h_s = x^n \pmod {n^2} @f$, the result is still an n-th residue (an encryption of 0), but the exponentiation is much shorter.
+	As for the DGK randomizers, this relies on the assumption that raising @f$ h_s @f$ to a @f$ 2 t @f$ bit exponent produces an element that is computationally indistinguishable from a uniform n-th residue.
+
+	If the private key is available, both versions are computed modulo @f$ p^2 @f$ and @f$ q^2 @f$ and combined via CRT.
+	Since @f$ (y + k p)^p \equiv y^p \pmod {p^2} @f$, the n-th residues modulo @f$ p^2 @f$ are exactly the values @f$ y_p^p \pmod {p^2} @f$, with @f$ y_p \in \mathbb{Z}_p^* @f$,
+	so the "standard" version computes @f$ y_p^p \pmod {p^2} @f$ and @f$ y_q^q \pmod {q^2} @f$ for random @f$ y_p @f$ and @f$ y_q @f$ (the same distribution as @f$ r^n \pmod {n^2} @f$, with exponents and moduli half as long).
 
 	@return the randomizer
 	*/
 	Paillier::Randomizer Paillier::GetRandomizer () const {
-		return Randomizer((RandomProvider::GetInstance().GetRandomInteger(this->nMinusOne) + 1).GetPowModN(this->publicKey.n, this->nSquared));
+		if (this->shortRandomizers) {
+			BigInteger alpha = RandomProvider::GetInstance().GetRandomInteger(this->shortRandomizerExponentSize);
+
+			if (!this->hasPrivateKey) {
+				return Randomizer(this->hsTable.GetPowModN(alpha));
+			}
+
+			/// Fast version: @f$ h_s^{\alpha} \pmod {n^2} = CRT(h_s^{\alpha} \bmod p^2, h_s^{\alpha} \bmod q^2) @f$
+			return Randomizer(this->combineResidues(this->hsModPSquaredTable.GetPowModN(alpha), this->hsModQSquaredTable.GetPowModN(alpha)));
+		}
+
+		if (!this->hasPrivateKey) {
+			return Randomizer((RandomProvider::GetInstance().GetRandomInteger(this->nMinusOne) + 1).GetPowModN(this->publicKey.n, this->nSquared));
+		}
+
+		/// Fast version: @f$ CRT(y_p^p \bmod p^2, y_q^q \bmod q^2) @f$
+		BigInteger yp = RandomProvider::GetInstance().GetRandomInteger(this->pMinusOne) + 1;
+		BigInteger yq = RandomProvider::GetInstance().GetRandomInteger(this->qMinusOne) + 1;
+
+		return Randomizer(this->combineResidues(yp.GetPowModN(this->privateKey.p, this->pSquared), yq.GetPowModN(this->privateKey.q, this->qSquared)));
 	}
 
 	/**
@@ -267,7 +346,10 @@ namespace Core {
 	@return The randomized ciphertext
 	*/
 	Paillier::Ciphertext Paillier::RandomizeCiphertext (const Paillier::Ciphertext &ciphertext) const {
-		return Ciphertext((ciphertext.data * this->randomizerCache->Pop().randomizer.data) % this->GetEncryptionModulus(), this->encryptionModulus);
+		Ciphertext output(this->encryptionModulus);
+		BigInteger::MulModN(output.data, ciphertext.data, this->randomizerCache->Pop().randomizer.data, this->GetEncryptionModulus());
+
+		return output;
 	}
 
 	/**
@@ -284,6 +366,13 @@ namespace Core {
 		return this->publicKey.n.GetSize();
 	}
 
+	/**
+	@return The provider name and the hexadecimal public key components.
+	*/
+	std::string Paillier::GetPublicKeyFingerprint () const {
+		return "Paillier:n=" + this->publicKey.n.ToString(16) + ",g=" + this->publicKey.g.ToString(16);
+	}
+
 	/**
 	Computes @f$ L(u) = \frac{u - 1}{d} @f$
 
@@ -300,6 +389,43 @@ namespace Core {
 	}
 
 	/**
+	Computes @f$ x = a q^2 (q^{-2} \pmod {p^2}) + b p^2 (p^{-2} \pmod {q^2}) \pmod {n^2} @f$, where @f$ x \equiv a \pmod {p^2} @f$ and @f$ x \equiv b \pmod {q^2} @f$.
+
+	@param residueModPSquared @f$ a @f$
+	@param residueModQSquared @f$ b @f$
+	@return @f$ x @f$
+	*/
+	BigInteger Paillier::combineResidues (const BigInteger &residueModPSquared, const BigInteger &residueModQSquared) const {
+		BigInteger output = residueModQSquared * this->pSquaredTimesPSquaredInvModQSquared;
+		BigInteger::MulAddModN(output, residueModPSquared, this->qSquaredTimesQSquaredInvModPSquared, output, this->nSquared);
+
+		return output;
+	}
+
+	/**
+	Computes @f$ m_p = L_p(c^{p - 1} (\pmod p^2)) h_p \pmod p @f$ (or @f$ m_q @f$, for the arguments of @f$ q @f$).
+
+	@param ciphertext the ciphertext data, @f$ c @f$
+	@param prime @f$ p @f$
+	@param primeMinusOne @f$ p - 1 @f$
+	@param primeSquared @f$ p^2 @f$
+	@param h @f$ h_p @f$
+	@return @f$ m_p @f$
+	*/
+	BigInteger Paillier::decryptModPrime (const BigInteger &ciphertext, const BigInteger &prime, const BigInteger &primeMinusOne, const BigInteger &primeSquared, const BigInteger &h) const {
+		BigInteger output = this->L(ciphertext.GetPowModN(primeMinusOne, primeSquared), prime);
+		output.MultiplyModN(h, prime);
+
+		return output;
+	}
+
+	/**
+	If Core.Paillier.shortRandomizers is set, generates @f$ h_s @f$ and builds its fixed-base table (modulo @f$ p^2 @f$ and @f$ q^2 @f$ if the private key is available, otherwise modulo @f$ n^2 @f$),
+	within the Core.FixedBaseTable.memoryBudget limit.
+
+	Reads Core.Paillier.parallelDecryptionKeySize.
+
+	Precomputes [0] and [1].
 	*/
 	void Paillier::doPrecomputations () {
 		if (this->precomputeSpeedupValues) {
@@ -307,6 +433,29 @@ namespace Core {
 			this->nMinusOne = this->publicKey.n - 1;
 		}
 
+		this->shortRandomizers = Utils::Config::GetInstance().GetParameter("Core.Paillier.shortRandomizers", false);
+		if (this->shortRandomizers) {
+			this->shortRandomizerExponentSize = 2 * Utils::Config::GetInstance().GetParameter<size_t>("Core.Paillier.t", 128);
+
+			/// @f$ h_s = x^n \pmod {n^2} @f$ is not part of the public key: each instance picks its own @f$ x @f$
+			this->hs = (RandomProvider::GetInstance().GetRandomInteger(this->nMinusOne) + 1).GetPowModN(this->publicKey.n, this->nSquared);
+
+			size_t memoryBudget = Utils::Config::GetInstance().GetParameter<size_t>("Core.FixedBaseTable.memoryBudget", 1024) * 1024;
+			if (this->hasPrivateKey) {
+				this->hsTable = FixedBaseTable();
+				this->hsModPSquaredTable = FixedBaseTable(this->hs, this->privateKey.p * this->privateKey.p, this->shortRandomizerExponentSize, memoryBudget);
+				this->hsModQSquaredTable = FixedBaseTable(this->hs, this->privateKey.q * this->privateKey.q, this->shortRandomizerExponentSize, memoryBudget);
+			}
+			else {
+				this->hsTable = FixedBaseTable(this->hs, this->nSquared, this->shortRandomizerExponentSize, memoryBudget);
+			}
+		}
+		else {
+			this->hsTable = FixedBaseTable();
+			this->hsModPSquaredTable = FixedBaseTable();
+			this->hsModQSquaredTable = FixedBaseTable();
+		}
+
 		if (this->hasPrivateKey) {
 			/// Precompute @f$ h_p = L_p(g^{p - 1} (\pmod p^2))^{-1} \pmod p @f$ and @f$ h_q = L_q(g^{q - 1} (\pmod q^2))^{-1} \pmod q @f$ to speed up decryption via CRT
 			this->pMinusOne = this->privateKey.p - 1;
@@ -320,6 +469,10 @@ namespace Core {
 			try {
 				this->pTimesPInvModQ = this->privateKey.p * this->privateKey.p.GetInverseModN(this->privateKey.q);
 				this->qTimesQInvModP = this->privateKey.q * this->privateKey.q.GetInverseModN(this->privateKey.p);
+
+				/// Speed optimizations for the randomizers: precompute @f$ p^2 (p^{-2} \pmod {q^2}) @f$ and @f$ q^2 (q^{-2} \pmod {p^2}) @f$
+				this->pSquaredTimesPSquaredInvModQSquared = this->pSquared * this->pSquared.GetInverseModN(this->qSquared);
+				this->qSquaredTimesQSquaredInvModPSquared = this->qSquared * this->qSquared.GetInverseModN(this->pSquared);
 			}
 			/// @todo Catch a custom exception here
 			catch (std::runtime_error) {
@@ -328,6 +481,10 @@ namespace Core {
 			}
 		}
 
+		/// The two CRT halves of the decryption run in parallel for keys of at least Core.Paillier.parallelDecryptionKeySize bits (0, the default, disables it)
+		size_t parallelDecryptionKeySize = Utils::Config::GetInstance().GetParameter<size_t>("Core.Paillier.parallelDecryptionKeySize", 0);
+		this->parallelDecryption = this->hasPrivateKey && parallelDecryptionKeySize > 0 && this->publicKey.n.GetSize() >= parallelDecryptionKeySize;
+
 		//set the encryption modulus, @f$ n^2 @f$
 		this->encryptionModulus = std::make_shared<BigInteger>(this->nSquared);
 
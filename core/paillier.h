@@ -31,9 +31,12 @@ limitations under the License.
 
 #include "big_integer.h"
 #include "random_provider.h"
+#include "prime_search.h"
 #include "ciphertext_base.h"
 #include "crypto_provider.h"
 #include "utils/config.h"
+#include "fixed_base_table.h"
+#include "worker_pool.h"
 
 //include C++ headers
 #include <stdexcept>
@@ -84,6 +87,9 @@ namespace Core {
 
 		/// Constructor with data and encryption modulus initialization
 		PaillierCiphertext (const BigInteger &data, const std::shared_ptr<BigInteger> &encryptionModulus);
+
+		/// Constructor with data (taken over) and encryption modulus initialization
+		PaillierCiphertext (BigInteger &&data, const std::shared_ptr<BigInteger> &encryptionModulus);
 	};
 
 	/**
@@ -95,6 +101,9 @@ namespace Core {
 
 		/// Constructor with initialization
 		PaillierRandomizer (const BigInteger &data);
+
+		/// Constructor with initialization (takes over the input)
+		PaillierRandomizer (BigInteger &&data);
 	};
 
 	/**
@@ -112,7 +121,7 @@ namespace Core {
 		Paillier (const PaillierPublicKey &publicKey, const PaillierPrivateKey &privateKey);
 
 		/// Destructor
-		~Paillier () {}
+		~Paillier ();
 
 		/* Base class methods */
 
@@ -138,6 +147,9 @@ namespace Core {
 		/// Returns the message space bit size
 		virtual size_t GetMessageSpaceSize () const;
 
+		/// Returns a string which identifies the public key
+		virtual std::string GetPublicKeyFingerprint () const;
+
 		/* /Base class methods */
 
 	private:
@@ -165,12 +177,45 @@ namespace Core {
 		/// @f$ q (q^{-1} \pmod p) @f$
 		BigInteger qTimesQInvModP;
 
+		/// @f$ p^2 (p^{-2} \pmod {q^2}) @f$
+		BigInteger pSquaredTimesPSquaredInvModQSquared;
+
+		/// @f$ q^2 (q^{-2} \pmod {p^2}) @f$
+		BigInteger qSquaredTimesQSquaredInvModPSquared;
+
 		/// @f$ L_p(g^{p - 1} (\pmod p^2))^{-1} \pmod p @f$
 		BigInteger hp;
 
 		/// @f$ L_q(g^{q - 1} (\pmod q^2))^{-1} \pmod q @f$
 		BigInteger hq;
 
+		/// Flag which indicates if the randomizers are computed as @f$ h_s^{\alpha} \pmod {n^2} @f$ instead of @f$ r^n \pmod {n^2} @f$
+		bool shortRandomizers;
+
+		/// The bit size of the short randomizer exponents, @f$ \alpha @f$ (@f$ 2 t @f$)
+		size_t shortRandomizerExponentSize;
+
+		/// @f$ h_s = x^n \pmod {n^2} @f$, for a random @f$ x \in \mathbb{Z}_n^* @f$
+		BigInteger hs;
+
+		/// Fixed-base exponentiation table for @f$ h_s \pmod {n^2} @f$ (public key only)
+		FixedBaseTable hsTable;
+
+		/// Fixed-base exponentiation table for @f$ h_s \pmod {p^2} @f$ (private key)
+		FixedBaseTable hsModPSquaredTable;
+
+		/// Fixed-base exponentiation table for @f$ h_s \pmod {q^2} @f$ (private key)
+		FixedBaseTable hsModQSquaredTable;
+
+		/// Flag which indicates if the two CRT halves of the decryption run on two threads (key size of at least Core.Paillier.parallelDecryptionKeySize bits)
+		bool parallelDecryption;
+
+		/// Decrypts the ciphertext modulo one of the primes, @f$ m_p = L_p(c^{p - 1} (\pmod p^2)) h_p \pmod p @f$
+		BigInteger decryptModPrime (const BigInteger &ciphertext, const BigInteger &prime, const BigInteger &primeMinusOne, const BigInteger &primeSquared, const BigInteger &h) const;
+
+		/// Combines the residues modulo @f$ p^2 @f$ and @f$ q^2 @f$ into a value modulo @f$ n^2 @f$
+		BigInteger combineResidues (const BigInteger &residueModPSquared, const BigInteger &residueModQSquared) const;
+
 		/// L function evaluator
 		BigInteger L (const BigInteger &input, const BigInteger &d) const;
 
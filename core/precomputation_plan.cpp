@@ -0,0 +1,124 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/precomputation_plan.cpp
+@brief Implementation of class PrecomputationPlan.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "precomputation_plan.h"
+
+//include C++ libraries
+#include <chrono>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	Reads Core.PrecomputationPlan.threadCount.
+	*/
+	PrecomputationPlan::PrecomputationPlan () :
+		threadCount(Utils::Config::GetInstance().GetParameter<size_t>("Core.PrecomputationPlan.threadCount", 0)),
+		offlineTime(0) {
+	}
+
+	/**
+	The blinding factor caches are filled first, in the order in which they were added, followed by the randomizer caches.
+
+	@throws std::exception any exception thrown while generating the elements
+	*/
+	void PrecomputationPlan::Execute () {
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+		for (int randomizers = 0; randomizers < 2; ++randomizers) {
+			for (std::vector<Entry>::iterator entry = this->entries.begin(); entry != this->entries.end(); ++entry) {
+				if (entry->randomizers == (randomizers == 1)) {
+					entry->reserve(entry->count, this->threadCount);
+				}
+			}
+		}
+
+		this->offlineTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+		for (std::vector<Entry>::iterator entry = this->entries.begin(); entry != this->entries.end(); ++entry) {
+			entry->baseline = entry->getUsage();
+		}
+	}
+
+	/**
+	@return The duration of the offline phase, in nanoseconds (0 before Execute).
+	*/
+	long long PrecomputationPlan::GetOfflineTime () const {
+		return this->offlineTime;
+	}
+
+	/**
+	One line per cache: the planned elements, the consumed ones, the ones that had to be generated online (the plan underestimated the workload)
+	and the ones left unused (the plan overestimated it).
+
+	@param output the output stream
+	*/
+	void PrecomputationPlan::PrintReport (std::ostream &output) const {
+		for (std::vector<Entry>::const_iterator entry = this->entries.begin(); entry != this->entries.end(); ++entry) {
+			Usage usage = entry->getUsage();
+
+			output << entry->name << ": planned " << entry->count
+				<< ", consumed " << usage.consumed - entry->baseline.consumed
+				<< ", generated online " << usage.inlineGenerated - entry->baseline.inlineGenerated
+				<< ", unused " << usage.depth << std::endl;
+		}
+	}
+
+	/**
+	@param name description of the cache contents (the descriptions of the same cache are concatenated)
+	@param cache the address of the cache
+	@param count the number of elements
+	@param randomizers true for the randomizer cache of a crypto provider
+	@param reserve calls RandomizerCache::Reserve
+	@param getUsage reads the cache metrics
+	*/
+	void PrecomputationPlan::add (const std::string &name, const void *cache, const size_t count, const bool randomizers, const std::function<void (const size_t, const size_t)> &reserve, const std::function<Usage ()> &getUsage) {
+		for (std::vector<Entry>::iterator entry = this->entries.begin(); entry != this->entries.end(); ++entry) {
+			if (entry->cache == cache) {
+				entry->count += count;
+
+				if (entry->name.find(name) == std::string::npos) {
+					entry->name += " + " + name;
+				}
+
+				return;
+			}
+		}
+
+		Entry entry;
+		entry.name = name;
+		entry.cache = cache;
+		entry.count = count;
+		entry.randomizers = randomizers;
+		entry.reserve = reserve;
+		entry.getUsage = getUsage;
+		entry.baseline = getUsage();
+
+		this->entries.push_back(entry);
+	}
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
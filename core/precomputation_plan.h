@@ -0,0 +1,179 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/precomputation_plan.h
+@brief Definition of class PrecomputationPlan.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef PRECOMPUTATION_PLAN_HEADER_GUARD
+#define PRECOMPUTATION_PLAN_HEADER_GUARD
+
+//include our headers
+#include "utils/config.h"
+#include "randomizer_cache.h"
+
+//include C++ libraries
+#include <string>
+#include <vector>
+#include <functional>
+#include <ostream>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief Offline phase which precomputes exactly the randomizers and blinding factors consumed by a workload
+
+	The protocol objects add the caches they use and the number of elements that the workload will extract from each of them
+	(the counts of the same cache are summed). Execute then calls RandomizerCache::Reserve for every cache, so that the online phase
+	runs without generating any randomizers or blinding factors.
+
+	The blinding factor caches are filled before the randomizer caches of the crypto providers, since generating a blinding factor container
+	consumes randomizers (the ones precomputed for the online phase must not be used up by the offline phase).
+
+	The elements of each cache are generated by Core.PrecomputationPlan.threadCount threads (0, the default, selects one thread for each hardware thread).
+	*/
+	class PrecomputationPlan {
+	public:
+		/// Constructor
+		PrecomputationPlan ();
+
+		/// Destructor - void implementation
+		~PrecomputationPlan () {}
+
+		/// Adds count elements to the requirements of a blinding factor cache
+		template <typename T_Container>
+		void Add (const std::string &name, RandomizerCache<T_Container> &cache, const size_t count);
+
+		/// Adds count randomizers to the requirements of the randomizer cache of a crypto provider
+		template <typename T_CryptoProvider>
+		void AddRandomizers (const std::string &name, const T_CryptoProvider &cryptoProvider, const size_t count);
+
+		/// Generates all the planned elements (the offline phase)
+		void Execute ();
+
+		/// Returns the duration of Execute (wall clock time, in nanoseconds)
+		long long GetOfflineTime () const;
+
+		/// Prints the planned elements of each cache and how many of them were consumed since Execute
+		void PrintReport (std::ostream &output) const;
+
+	private:
+		/// Consumption counters of a cache
+		struct Usage {
+			/// The number of elements extracted from the buffer
+			unsigned long long consumed;
+
+			/// The number of elements generated inline (not planned)
+			unsigned long long inlineGenerated;
+
+			/// The number of elements left in the buffer
+			size_t depth;
+		};
+
+		/// The requirements of one cache
+		struct Entry {
+			/// Description of the cache contents
+			std::string name;
+
+			/// The address of the cache (identifies the entries of the same cache)
+			const void *cache;
+
+			/// The number of elements which the workload consumes
+			size_t count;
+
+			/// True for the randomizer caches of the crypto providers
+			bool randomizers;
+
+			/// Calls RandomizerCache::Reserve
+			std::function<void (const size_t count, const size_t threadCount)> reserve;
+
+			/// Reads the cache metrics
+			std::function<Usage ()> getUsage;
+
+			/// The usage when Execute finished
+			Usage baseline;
+		};
+
+		/// The planned caches
+		std::vector<Entry> entries;
+
+		/// The number of threads which generate the elements of each cache
+		size_t threadCount;
+
+		/// The duration of Execute
+		long long offlineTime;
+
+		/// Adds the requirements of a cache or updates the existing entry
+		void add (const std::string &name, const void *cache, const size_t count, const bool randomizers, const std::function<void (const size_t, const size_t)> &reserve, const std::function<Usage ()> &getUsage);
+
+		/// Copy constructor - not implemented
+		PrecomputationPlan (const PrecomputationPlan &);
+
+		/// Copy assignment operator - not implemented
+		PrecomputationPlan operator= (const PrecomputationPlan &);
+	};
+
+	/**
+	@param name description of the cache contents
+	@param cache the cache
+	@param count the number of elements which the workload extracts from the cache
+	*/
+	template <typename T_Container>
+	void PrecomputationPlan::Add (const std::string &name, RandomizerCache<T_Container> &cache, const size_t count) {
+		RandomizerCache<T_Container> *cachePointer = &cache;
+
+		this->add(name, cachePointer, count, false,
+			[cachePointer] (const size_t count, const size_t threadCount) { cachePointer->Reserve(count, threadCount); },
+			[cachePointer] () {
+				typename RandomizerCache<T_Container>::Metrics metrics = cachePointer->GetMetrics();
+				Usage usage = {metrics.consumed, metrics.inlineGenerated, metrics.depth};
+
+				return usage;
+			});
+	}
+
+	/**
+	@param name description of the cache contents
+	@param cryptoProvider the crypto provider (its keys must be set)
+	@param count the number of randomizers which the workload consumes (one for each encryption or re-randomization)
+	@throws std::runtime_error the randomizer cache of the crypto provider is not initialized
+	*/
+	template <typename T_CryptoProvider>
+	void PrecomputationPlan::AddRandomizers (const std::string &name, const T_CryptoProvider &cryptoProvider, const size_t count) {
+		typedef typename T_CryptoProvider::RandomizerCacheType RandomizerCacheType;
+		RandomizerCacheType *cachePointer = &cryptoProvider.GetRandomizerCache();
+
+		this->add(name, cachePointer, count, true,
+			[cachePointer] (const size_t count, const size_t threadCount) { cachePointer->Reserve(count, threadCount); },
+			[cachePointer] () {
+				typename RandomizerCacheType::Metrics metrics = cachePointer->GetMetrics();
+				Usage usage = {metrics.consumed, metrics.inlineGenerated, metrics.depth};
+
+				return usage;
+			});
+	}
+}//namespace Core
+}//namespace SeComLib
+
+#endif//PRECOMPUTATION_PLAN_HEADER_GUARD
\ No newline at end of file
@@ -0,0 +1,528 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/precomputation_store.cpp
+@brief Implementation of class PrecomputationStore.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "precomputation_store.h"
+
+//include C++ libraries
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+
+//include boost libraries
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+
+//include system headers
+#if defined(_WIN32)
+	#include <fcntl.h>
+	#include <io.h>
+	#include <sys/stat.h>
+#else
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+namespace SeComLib {
+namespace Core {
+	/**
+	Stores the byte size (32 bits) followed by the fixed-width export of the value.
+
+	@param value the value
+	@throws std::runtime_error the value is negative
+	*/
+	void PrecomputationStore::RecordWriter::Write (const BigInteger &value) {
+		size_t byteCount = value.GetByteSize();
+		size_t position = this->data.size();
+
+		this->data.resize(position + 4 + byteCount);
+		PrecomputationStore::writeInteger(&this->data[position], byteCount, 4);
+		value.Export(&this->data[position + 4], byteCount);
+	}
+
+	/**
+	Stores the value as a 64 bit two's complement integer.
+
+	@param value the value
+	*/
+	void PrecomputationStore::RecordWriter::Write (const long value) {
+		size_t position = this->data.size();
+
+		this->data.resize(position + 8);
+		PrecomputationStore::writeInteger(&this->data[position], static_cast<uint64_t>(static_cast<int64_t>(value)), 8);
+	}
+
+	/**
+	@return The record data.
+	*/
+	const std::vector<unsigned char> &PrecomputationStore::RecordWriter::GetData () const {
+		return this->data;
+	}
+
+	/**
+	Creates an empty record.
+	*/
+	PrecomputationStore::RecordReader::RecordReader () :
+		size(0),
+		position(0) {
+	}
+
+	/**
+	The data is copied, since the store erases the record once it is handed out.
+
+	@param data the record data
+	@param size the record size
+	*/
+	PrecomputationStore::RecordReader::RecordReader (const unsigned char *data, const size_t size) :
+		data(data, data + size),
+		size(size),
+		position(0) {
+	}
+
+	/**
+	@return The next big integer of the record.
+	@throws std::runtime_error the record is truncated
+	*/
+	BigInteger PrecomputationStore::RecordReader::ReadBigInteger () {
+		size_t byteCount = static_cast<size_t>(PrecomputationStore::readInteger(this->read(4), 4));
+
+		BigInteger output;
+		output.Import(this->read(byteCount), byteCount);
+
+		return output;
+	}
+
+	/**
+	@return The next signed integer of the record.
+	@throws std::runtime_error the record is truncated
+	*/
+	long PrecomputationStore::RecordReader::ReadLong () {
+		return static_cast<long>(static_cast<int64_t>(PrecomputationStore::readInteger(this->read(8), 8)));
+	}
+
+	/**
+	@param byteCount the number of bytes
+	@return A pointer to the bytes.
+	@throws std::runtime_error the record is truncated
+	*/
+	const unsigned char *PrecomputationStore::RecordReader::read (const size_t byteCount) {
+		if (byteCount > this->size - this->position) {
+			throw std::runtime_error("The precomputed record is truncated.");
+		}
+
+		const unsigned char *output = this->data.data() + this->position;
+		this->position += byteCount;
+
+		return output;
+	}
+
+	/**
+	Maps the store file and its journal (the journal is created if it doesn't exist). Records appended after the store is opened are only visible to the instances opened later.
+	The store is mapped read-write, since the records are erased once they are handed out.
+
+	@param path the store file
+	@param key the store key
+	@param reservationSize the number of records reserved at once
+	@throws std::runtime_error the store does not exist, it is corrupted or it was created for a different key
+	*/
+	PrecomputationStore::PrecomputationStore (const std::string &path, const std::string &key, const size_t reservationSize) :
+		reservationSize(reservationSize),
+		nextOffset(0),
+		reservationEnd(0),
+		exhausted(false) {
+		if (0 == reservationSize) {
+			throw std::runtime_error("The reservation size must be positive.");
+		}
+
+		if (!PrecomputationStore::Exists(path)) {
+			throw std::runtime_error("The precomputation store does not exist.");
+		}
+
+		this->storeMapping = boost::interprocess::file_mapping(path.c_str(), boost::interprocess::read_write);
+		this->storeRegion = boost::interprocess::mapped_region(this->storeMapping, boost::interprocess::read_write);
+		this->storeLock = boost::interprocess::file_lock(path.c_str());
+
+		const unsigned char *header = static_cast<const unsigned char *>(this->storeRegion.get_address());
+		if (this->storeRegion.get_size() < PrecomputationStore::headerSize || std::string(reinterpret_cast<const char *>(header), 8) != PRECOMPUTATION_STORE_MAGIC || PrecomputationStore::readInteger(header + 8, 4) != PRECOMPUTATION_STORE_VERSION) {
+			throw std::runtime_error("The precomputation store is corrupted.");
+		}
+		if (PrecomputationStore::readInteger(header + 16, 8) != PrecomputationStore::HashKey(key)) {
+			throw std::runtime_error("The precomputation store was created for a different key.");
+		}
+
+		std::string journalPath = path + ".journal";
+		PrecomputationStore::touch(journalPath);
+		this->journalLock = boost::interprocess::file_lock(journalPath.c_str());
+
+		{
+			boost::interprocess::scoped_lock<boost::interprocess::file_lock> lock(this->journalLock);
+
+			//a new journal is filled with zeros, which stand for "nothing consumed"
+			size_t journalFileSize = PrecomputationStore::touch(journalPath);
+			if (journalFileSize < PrecomputationStore::journalSize) {
+				std::ofstream journal(journalPath.c_str(), std::ios::binary | std::ios::app);
+				journal.write(std::string(PrecomputationStore::journalSize - journalFileSize, '\0').c_str(), static_cast<std::streamsize>(PrecomputationStore::journalSize - journalFileSize));
+				if (!journal) {
+					throw std::runtime_error("Can't create the precomputation store journal.");
+				}
+			}
+		}
+
+		this->journalMapping = boost::interprocess::file_mapping(journalPath.c_str(), boost::interprocess::read_write);
+		this->journalRegion = boost::interprocess::mapped_region(this->journalMapping, boost::interprocess::read_write, 0, PrecomputationStore::journalSize);
+	}
+
+	/**
+	The records which were reserved, but not handed out, are skipped by the other stores, so they are erased as well.
+	*/
+	PrecomputationStore::~PrecomputationStore () {
+		if (this->nextOffset == this->reservationEnd) {
+			return;
+		}
+
+		//the destructor must not throw
+		try {
+			this->erase(this->nextOffset, this->reservationEnd);
+		}
+		catch (const std::exception &) {
+		}
+	}
+
+	/**
+	Thread safe. The record is copied into the reader and erased from the store (see erase), so a used randomizer can't be recovered from the file.
+
+	@param record receives the record
+	@return false if all the records were consumed, true otherwise
+	@throws std::runtime_error the journal is corrupted
+	*/
+	bool PrecomputationStore::Pop (RecordReader &record) {
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		if (this->nextOffset == this->reservationEnd) {
+			//the mapped records can't change, so there is no point in checking the journal again
+			if (this->exhausted) {
+				return false;
+			}
+
+			this->reserve();
+
+			if (this->nextOffset == this->reservationEnd) {
+				this->exhausted = true;
+
+				return false;
+			}
+		}
+
+		//the reserved records were verified by reserve
+		unsigned char *recordData = static_cast<unsigned char *>(this->storeRegion.get_address()) + this->nextOffset;
+		size_t recordSize = static_cast<size_t>(PrecomputationStore::readInteger(recordData, 4));
+		record = RecordReader(recordData + PrecomputationStore::recordPrefixSize, recordSize);
+		this->erase(this->nextOffset, this->nextOffset + PrecomputationStore::recordPrefixSize + recordSize);
+		this->nextOffset += PrecomputationStore::recordPrefixSize + recordSize;
+
+		return true;
+	}
+
+	/**
+	Used by the offline precomputation: the records are appended at the end of the store file, which is locked meanwhile.
+	The existing records are verified first and the file is truncated after the last valid one, so an interrupted append doesn't leave a partial record
+	in front of the new ones.
+
+	@param path the store file
+	@param key the store key
+	@param records the records
+	@throws std::runtime_error the store is corrupted or it was created for a different key, a record is empty or the file can't be written
+	*/
+	void PrecomputationStore::Append (const std::string &path, const std::string &key, const std::vector<RecordWriter> &records) {
+		PrecomputationStore::touch(path);
+
+		boost::interprocess::file_lock fileLock(path.c_str());
+		boost::interprocess::scoped_lock<boost::interprocess::file_lock> lock(fileLock);
+
+		unsigned char header[PrecomputationStore::headerSize] = {0};
+		size_t fileSize = PrecomputationStore::touch(path);
+
+		if (fileSize > 0) {
+			std::ifstream input(path.c_str(), std::ios::binary);
+			input.read(reinterpret_cast<char *>(header), PrecomputationStore::headerSize);
+
+			if (!input || std::string(reinterpret_cast<const char *>(header), 8) != PRECOMPUTATION_STORE_MAGIC || PrecomputationStore::readInteger(header + 8, 4) != PRECOMPUTATION_STORE_VERSION) {
+				throw std::runtime_error("The precomputation store is corrupted.");
+			}
+			if (PrecomputationStore::readInteger(header + 16, 8) != PrecomputationStore::HashKey(key)) {
+				throw std::runtime_error("The precomputation store was created for a different key.");
+			}
+
+			size_t validSize = PrecomputationStore::headerSize;
+			std::vector<unsigned char> data;
+			unsigned char prefix[PrecomputationStore::recordPrefixSize];
+			while (input.read(reinterpret_cast<char *>(prefix), PrecomputationStore::recordPrefixSize)) {
+				size_t recordSize = static_cast<size_t>(PrecomputationStore::readInteger(prefix, 4));
+				if (0 == recordSize || recordSize > fileSize - validSize - PrecomputationStore::recordPrefixSize) {
+					break;
+				}
+
+				data.resize(recordSize);
+				if (!input.read(reinterpret_cast<char *>(&data[0]), static_cast<std::streamsize>(recordSize)) || PrecomputationStore::getChecksum(&data[0], recordSize) != PrecomputationStore::readInteger(prefix + 4, 4)) {
+					break;
+				}
+
+				validSize += PrecomputationStore::recordPrefixSize + recordSize;
+			}
+			input.close();
+
+			if (validSize < fileSize) {
+				boost::filesystem::resize_file(path, validSize);
+			}
+		}
+
+		std::ofstream output(path.c_str(), std::ios::binary | std::ios::app);
+
+		if (0 == fileSize) {
+			std::string(PRECOMPUTATION_STORE_MAGIC).copy(reinterpret_cast<char *>(header), 8);
+			PrecomputationStore::writeInteger(header + 8, PRECOMPUTATION_STORE_VERSION, 4);
+			PrecomputationStore::writeInteger(header + 16, PrecomputationStore::HashKey(key), 8);
+			output.write(reinterpret_cast<const char *>(header), PrecomputationStore::headerSize);
+		}
+
+		for (std::vector<RecordWriter>::const_iterator record = records.begin(); record != records.end(); ++record) {
+			const std::vector<unsigned char> &data = record->GetData();
+			if (data.empty() || data.size() > std::numeric_limits<uint32_t>::max()) {
+				throw std::runtime_error("Invalid precomputed record size.");
+			}
+
+			unsigned char prefix[PrecomputationStore::recordPrefixSize];
+			PrecomputationStore::writeInteger(prefix, data.size(), 4);
+			PrecomputationStore::writeInteger(prefix + 4, PrecomputationStore::getChecksum(&data[0], data.size()), 4);
+			output.write(reinterpret_cast<const char *>(prefix), PrecomputationStore::recordPrefixSize);
+			output.write(reinterpret_cast<const char *>(&data[0]), static_cast<std::streamsize>(data.size()));
+		}
+
+		output.flush();
+		if (!output) {
+			throw std::runtime_error("Can't write the precomputation store.");
+		}
+	}
+
+	/**
+	The file name is the hexadecimal key hash, so each key gets its own store.
+
+	@param directory the directory of the stores
+	@param key the store key
+	@return directory/<key hash>.store
+	*/
+	std::string PrecomputationStore::GetPath (const std::string &directory, const std::string &key) {
+		std::ostringstream path;
+		path << directory << "/" << std::hex << std::setw(16) << std::setfill('0') << PrecomputationStore::HashKey(key) << ".store";
+
+		return path.str();
+	}
+
+	/**
+	@param path the file path
+	@return true if the file exists and it can be read, false otherwise
+	*/
+	bool PrecomputationStore::Exists (const std::string &path) {
+		return std::ifstream(path.c_str(), std::ios::binary).good();
+	}
+
+	/**
+	Reads the consumed offset from the journal, walks over the next reservationSize records and writes back the new offset,
+	flushing it to disk before any of the reserved records is used.
+
+	@throws std::runtime_error the journal or one of the reserved records is corrupted
+	*/
+	void PrecomputationStore::reserve () {
+		boost::interprocess::scoped_lock<boost::interprocess::file_lock> lock(this->journalLock);
+
+		//the offset is stored together with its complement, which detects torn or foreign writes
+		unsigned char *journal = static_cast<unsigned char *>(this->journalRegion.get_address());
+		uint64_t offset = PrecomputationStore::readInteger(journal, 8);
+		uint64_t check = PrecomputationStore::readInteger(journal + 8, 8);
+
+		if (0 == offset && 0 == check) {
+			offset = PrecomputationStore::headerSize;
+		}
+		else if (check != ~offset || offset < PrecomputationStore::headerSize) {
+			throw std::runtime_error("The precomputation store journal is corrupted.");
+		}
+
+		//another process may have consumed records appended after this store was mapped
+		size_t begin = offset < this->storeRegion.get_size() ? static_cast<size_t>(offset) : this->storeRegion.get_size();
+		size_t end = begin;
+		for (size_t i = 0; i < this->reservationSize; ++i) {
+			size_t recordSize = this->getRecordSize(end);
+			if (0 == recordSize) {
+				break;
+			}
+			end += PrecomputationStore::recordPrefixSize + recordSize;
+		}
+
+		if (end != begin) {
+			PrecomputationStore::writeInteger(journal, end, 8);
+			PrecomputationStore::writeInteger(journal + 8, ~static_cast<uint64_t>(end), 8);
+			this->journalRegion.flush(0, PrecomputationStore::journalSize, false);
+		}
+
+		this->nextOffset = begin;
+		this->reservationEnd = end;
+	}
+
+	/**
+	The data of each record is overwritten with zeros and its checksum is updated, so Append keeps the erased records.
+	The store file is locked meanwhile, so that Append doesn't see a partially erased record.
+
+	@param begin the offset of the first record
+	@param end the offset after the last record
+	*/
+	void PrecomputationStore::erase (const size_t begin, const size_t end) {
+		boost::interprocess::scoped_lock<boost::interprocess::file_lock> lock(this->storeLock);
+
+		unsigned char *records = static_cast<unsigned char *>(this->storeRegion.get_address());
+		for (size_t offset = begin; offset < end; ) {
+			unsigned char *record = records + offset;
+			size_t recordSize = static_cast<size_t>(PrecomputationStore::readInteger(record, 4));
+
+			std::fill(record + PrecomputationStore::recordPrefixSize, record + PrecomputationStore::recordPrefixSize + recordSize, static_cast<unsigned char>(0));
+			PrecomputationStore::writeInteger(record + 4, PrecomputationStore::getChecksum(record + PrecomputationStore::recordPrefixSize, recordSize), 4);
+
+			offset += PrecomputationStore::recordPrefixSize + recordSize;
+		}
+
+		this->storeRegion.flush(begin, end - begin, true);
+	}
+
+	/**
+	A record which is still being appended (by another process) is incomplete, while a complete record with a wrong checksum is damaged.
+
+	@param offset the record offset
+	@return The record size, or 0 if there is no complete record at offset.
+	@throws std::runtime_error the checksum of the record doesn't match
+	*/
+	size_t PrecomputationStore::getRecordSize (const size_t offset) const {
+		size_t regionSize = this->storeRegion.get_size();
+		if (offset > regionSize || regionSize - offset < PrecomputationStore::recordPrefixSize) {
+			return 0;
+		}
+
+		const unsigned char *record = static_cast<const unsigned char *>(this->storeRegion.get_address()) + offset;
+		size_t recordSize = static_cast<size_t>(PrecomputationStore::readInteger(record, 4));
+		if (recordSize > regionSize - offset - PrecomputationStore::recordPrefixSize) {
+			return 0;
+		}
+
+		if (PrecomputationStore::getChecksum(record + PrecomputationStore::recordPrefixSize, recordSize) != PrecomputationStore::readInteger(record + 4, 4)) {
+			throw std::runtime_error("The precomputed record is corrupted.");
+		}
+
+		return recordSize;
+	}
+
+	/**
+	@param data the record data
+	@param size the record size
+	@return The CRC-32 checksum of the record.
+	*/
+	uint32_t PrecomputationStore::getChecksum (const unsigned char *data, const size_t size) {
+		boost::crc_32_type crc;
+		crc.process_bytes(data, size);
+
+		return crc.checksum();
+	}
+
+	/**
+	The hash only tells the stores (and other cache files) apart, it does not authenticate them.
+
+	@param key the key
+	@return The 64 bit FNV-1a hash of the key.
+	*/
+	uint64_t PrecomputationStore::HashKey (const std::string &key) {
+		uint64_t hash = 14695981039346656037ULL;
+
+		for (std::string::const_iterator character = key.begin(); character != key.end(); ++character) {
+			hash ^= static_cast<unsigned char>(*character);
+			hash *= 1099511628211ULL;
+		}
+
+		return hash;
+	}
+
+	/**
+	@param buffer the destination
+	@param value the value
+	@param byteCount the number of bytes
+	*/
+	void PrecomputationStore::writeInteger (unsigned char *buffer, uint64_t value, const size_t byteCount) {
+		for (size_t i = 0; i < byteCount; ++i) {
+			buffer[i] = static_cast<unsigned char>(value >> (8 * i));
+		}
+	}
+
+	/**
+	@param buffer the source
+	@param byteCount the number of bytes
+	@return The value.
+	*/
+	uint64_t PrecomputationStore::readInteger (const unsigned char *buffer, const size_t byteCount) {
+		uint64_t value = 0;
+
+		for (size_t i = 0; i < byteCount; ++i) {
+			value |= static_cast<uint64_t>(buffer[i]) << (8 * i);
+		}
+
+		return value;
+	}
+
+	/**
+	The store and its journal hold secret randomizers, so a new file is only accessible by its owner. The existing files keep their permissions.
+
+	@param path the file path
+	@return The file size.
+	@throws std::runtime_error the file can't be created
+	*/
+	size_t PrecomputationStore::touch (const std::string &path) {
+	#if defined(_WIN32)
+		int file = _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _S_IREAD | _S_IWRITE);
+	#else
+		int file = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0600);
+	#endif
+		if (-1 == file) {
+			throw std::runtime_error("Can't create " + path + ".");
+		}
+	#if defined(_WIN32)
+		_close(file);
+	#else
+		close(file);
+	#endif
+
+		std::ifstream input(path.c_str(), std::ios::binary | std::ios::ate);
+
+		return static_cast<size_t>(input.tellg());
+	}
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
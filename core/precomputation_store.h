@@ -0,0 +1,240 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/precomputation_store.h
+@brief Definition of class PrecomputationStore.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef PRECOMPUTATION_STORE_HEADER_GUARD
+#define PRECOMPUTATION_STORE_HEADER_GUARD
+
+//include our headers
+#include "big_integer.h"
+
+//include C++ libraries
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <fstream>
+#include <stdexcept>
+
+//include boost libraries
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/sync/file_lock.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief The number of records reserved in the journal at once by PrecomputationStore::Pop.
+
+	Each reservation synchronously flushes the journal to disk. The records reserved by a process which exits before using them are skipped.
+	*/
+	#define PRECOMPUTATION_STORE_RESERVATION_SIZE 16
+
+	/**
+	@brief The first 8 bytes of a store file.
+	*/
+	#define PRECOMPUTATION_STORE_MAGIC "SCLSTORE"
+
+	/**
+	@brief The version of the store file layout.
+	*/
+	#define PRECOMPUTATION_STORE_VERSION 2
+
+	/**
+	@brief File-backed store of precomputed randomizers and blinding factors
+
+	An offline tool appends records (the serialized randomizer cache elements) to a store file, which is identified by a key that describes
+	the public key and the parameters used to compute them. At runtime, the file is memory-mapped and each record is handed out exactly once (and then zeroed):
+	the byte offset of the first unused record is kept in a journal file (<store file>.journal), which is advanced and flushed to disk before the
+	records are used. The journal is locked while it is updated, so several processes (and threads) can consume the same store.
+
+	Store file layout: a header (magic, version, key hash) followed by records, each one prefixed by its (32 bit) size and its CRC-32 checksum.
+	All the integers are little-endian. Append drops the incomplete or damaged records left at the end of the file by an interrupted append.
+	*/
+	class PrecomputationStore {
+	public:
+		/// Serializes the members of a precomputed element into a record
+		class RecordWriter {
+		public:
+			/// Appends a non-negative big integer
+			void Write (const BigInteger &value);
+
+			/// Appends a signed integer
+			void Write (const long value);
+
+			/// Returns the record data
+			const std::vector<unsigned char> &GetData () const;
+
+		private:
+			/// The record data
+			std::vector<unsigned char> data;
+		};
+
+		/// Deserializes the members of a precomputed element from a record
+		class RecordReader {
+		public:
+			/// Default constructor
+			RecordReader ();
+
+			/// Constructor
+			RecordReader (const unsigned char *data, const size_t size);
+
+			/// Reads the next big integer
+			BigInteger ReadBigInteger ();
+
+			/// Reads the next signed integer
+			long ReadLong ();
+
+			/// Reads the next ciphertext
+			template <typename T_CryptoProvider>
+			typename T_CryptoProvider::Ciphertext ReadCiphertext (const T_CryptoProvider &cryptoProvider);
+
+		private:
+			/// The record data
+			std::vector<unsigned char> data;
+
+			/// The record size
+			size_t size;
+
+			/// The read position
+			size_t position;
+
+			/// Returns a pointer to the next byteCount bytes and advances the read position
+			const unsigned char *read (const size_t byteCount);
+		};
+
+		/// Opens a store for consumption
+		PrecomputationStore (const std::string &path, const std::string &key, const size_t reservationSize = PRECOMPUTATION_STORE_RESERVATION_SIZE);
+
+		/// Destructor - erases the unused reserved records
+		~PrecomputationStore ();
+
+		/// Extracts the next record and erases it from the store
+		bool Pop (RecordReader &record);
+
+		/// Appends records to a store, creating it if required
+		static void Append (const std::string &path, const std::string &key, const std::vector<RecordWriter> &records);
+
+		/// Returns the path of the store with the given key, inside directory
+		static std::string GetPath (const std::string &directory, const std::string &key);
+
+		/// Checks if a file exists
+		static bool Exists (const std::string &path);
+
+		/// Hashes a store key (64 bit FNV-1a)
+		static uint64_t HashKey (const std::string &key);
+
+	private:
+		/// The size of the store file header
+		static const size_t headerSize = 24;
+
+		/// The size of the record prefix (size and checksum)
+		static const size_t recordPrefixSize = 8;
+
+		/// The size of the journal file
+		static const size_t journalSize = 16;
+
+		/// The store file mapping
+		boost::interprocess::file_mapping storeMapping;
+
+		/// The mapped store file
+		boost::interprocess::mapped_region storeRegion;
+
+		/// The journal file mapping
+		boost::interprocess::file_mapping journalMapping;
+
+		/// The mapped journal file
+		boost::interprocess::mapped_region journalRegion;
+
+		/// Inter-process lock of the journal file
+		boost::interprocess::file_lock journalLock;
+
+		/// Inter-process lock of the store file, held by Append and while a record is erased
+		boost::interprocess::file_lock storeLock;
+
+		/// Serializes the calls to Pop
+		std::mutex mutex;
+
+		/// The number of records reserved at once
+		size_t reservationSize;
+
+		/// The offset of the next reserved record
+		size_t nextOffset;
+
+		/// The offset after the last reserved record
+		size_t reservationEnd;
+
+		/// Flag set once all the mapped records were consumed
+		bool exhausted;
+
+		/// Reserves the next records in the journal
+		void reserve ();
+
+		/// Erases the records between two offsets
+		void erase (const size_t begin, const size_t end);
+
+		/// Returns the size of the record at offset (0 if the record is missing or truncated) and verifies its checksum
+		size_t getRecordSize (const size_t offset) const;
+
+		/// Computes the CRC-32 checksum of a record
+		static uint32_t getChecksum (const unsigned char *data, const size_t size);
+
+		/// Writes a little-endian integer
+		static void writeInteger (unsigned char *buffer, uint64_t value, const size_t byteCount);
+
+		/// Reads a little-endian integer
+		static uint64_t readInteger (const unsigned char *buffer, const size_t byteCount);
+
+		/// Creates a file if it does not exist (without truncating it) and returns its size
+		static size_t touch (const std::string &path);
+
+		/// Copy constructor - not implemented
+		PrecomputationStore (const PrecomputationStore &);
+
+		/// Copy assignment operator - not implemented
+		PrecomputationStore operator= (const PrecomputationStore &);
+	};
+
+	/**
+	The ciphertext gets the encryption modulus of the crypto provider.
+
+	@param cryptoProvider the crypto provider
+	@return The next ciphertext of the record.
+	@throws std::runtime_error the record is truncated
+	*/
+	template <typename T_CryptoProvider>
+	typename T_CryptoProvider::Ciphertext PrecomputationStore::RecordReader::ReadCiphertext (const T_CryptoProvider &cryptoProvider) {
+		typename T_CryptoProvider::Ciphertext output = cryptoProvider.GetEncryptedZero(false);
+		output.data = this->ReadBigInteger();
+
+		return output;
+	}
+}//namespace Core
+}//namespace SeComLib
+
+#endif//PRECOMPUTATION_STORE_HEADER_GUARD
\ No newline at end of file
@@ -0,0 +1,106 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/precomputed_ciphertext.h
+@brief Definition of template class PrecomputedCiphertext.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef PRECOMPUTED_CIPHERTEXT_HEADER_GUARD
+#define PRECOMPUTED_CIPHERTEXT_HEADER_GUARD
+
+//include our headers
+#include "utils/config.h"
+#include "big_integer.h"
+#include "fixed_base_table.h"
+
+//include C++ headers
+#include <algorithm>
+#include <stdexcept>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief Ciphertext handle for repeated homomorphic multiplications with different scalars
+
+	Wraps an existing ciphertext and counts the homomorphic multiplications performed with it. Once the count exceeds the amortization threshold,
+	a FixedBaseTable is built for the ciphertext (sized for the largest scalar seen so far) and all subsequent multiplications use it.
+	Before that, and for scalars larger than the table, the regular exponentiation is used.
+
+	The table is built lazily from const methods, so an instance must not be shared between threads.
+
+	@tparam T_Ciphertext A ciphertext type derived from CiphertextBase
+	*/
+	template <typename T_Ciphertext>
+	class PrecomputedCiphertext {
+	public:
+		/// Constructor (reads the amortization threshold and the memory budget from the Core.PrecomputedCiphertext configuration section)
+		PrecomputedCiphertext (const T_Ciphertext &ciphertext);
+
+		/// Constructor with custom parameters
+		PrecomputedCiphertext (const T_Ciphertext &ciphertext, const size_t amortizationThreshold, const size_t memoryBudget);
+
+		/// Destructor - void implementation
+		~PrecomputedCiphertext () {}
+
+		/// Homomorphic multiplication binary operator
+		T_Ciphertext operator* (const BigInteger &input) const;
+
+		/// Counts a homomorphic multiplication and computes it only if the exponentiation table covers the input
+		bool MultiplyWithTable (T_Ciphertext &output, const BigInteger &input) const;
+
+		/// Returns the wrapped ciphertext
+		const T_Ciphertext &GetCiphertext () const;
+
+		/// Returns true if the exponentiation table has been built
+		bool IsPrecomputed () const;
+
+	private:
+		/// The wrapped ciphertext
+		T_Ciphertext ciphertext;
+
+		/// The number of multiplications performed before the table is built
+		size_t amortizationThreshold;
+
+		/// The maximum table size, in bytes
+		size_t memoryBudget;
+
+		/// The number of multiplications performed so far
+		mutable size_t useCount;
+
+		/// The size (in bits) of the largest scalar seen so far
+		mutable size_t maxScalarSize;
+
+		/// True once the table was built (or could not be built within the memory budget)
+		mutable bool tableInitialized;
+
+		/// The exponentiation table
+		mutable FixedBaseTable table;
+	};
+}//namespace Core
+}//namespace SeComLib
+
+//Separate the implementation from the declaration
+#include "precomputed_ciphertext.hpp"
+
+#endif//PRECOMPUTED_CIPHERTEXT_HEADER_GUARD
\ No newline at end of file
@@ -0,0 +1,142 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/precomputed_ciphertext.hpp
+@brief Implementation of template class PrecomputedCiphertext.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef PRECOMPUTED_CIPHERTEXT_IMPLEMENTATION_GUARD
+#define PRECOMPUTED_CIPHERTEXT_IMPLEMENTATION_GUARD
+
+namespace SeComLib {
+namespace Core {
+	/**
+	The amortization threshold defaults to 16 multiplications and the memory budget to 256 KB.
+
+	@param ciphertext the ciphertext
+	*/
+	template <typename T_Ciphertext>
+	PrecomputedCiphertext<T_Ciphertext>::PrecomputedCiphertext (const T_Ciphertext &ciphertext) :
+		ciphertext(ciphertext),
+		amortizationThreshold(Utils::Config::GetInstance().GetParameter<size_t>("Core.PrecomputedCiphertext.amortizationThreshold", 16)),
+		memoryBudget(Utils::Config::GetInstance().GetParameter<size_t>("Core.PrecomputedCiphertext.memoryBudget", 256) * 1024),
+		useCount(0),
+		maxScalarSize(0),
+		tableInitialized(false) {
+	}
+
+	/**
+	@param ciphertext the ciphertext
+	@param amortizationThreshold the number of multiplications performed before the table is built (0 builds it on the first multiplication)
+	@param memoryBudget the maximum table size, in bytes
+	*/
+	template <typename T_Ciphertext>
+	PrecomputedCiphertext<T_Ciphertext>::PrecomputedCiphertext (const T_Ciphertext &ciphertext, const size_t amortizationThreshold, const size_t memoryBudget) :
+		ciphertext(ciphertext),
+		amortizationThreshold(amortizationThreshold),
+		memoryBudget(memoryBudget),
+		useCount(0),
+		maxScalarSize(0),
+		tableInitialized(false) {
+	}
+
+	/**
+	Computes @f$ [ciphertext * input] = [ciphertext]^{input} \pmod n @f$, using the exponentiation table when it covers the input.
+
+	@param input plaintext input
+	@return A new instance containing @f$ [ciphertext * input] @f$
+	@throws std::runtime_error the ciphertext does not have an encryption modulus
+	@throws std::runtime_error the plaintext term is 0
+	*/
+	template <typename T_Ciphertext>
+	T_Ciphertext PrecomputedCiphertext<T_Ciphertext>::operator* (const BigInteger &input) const {
+		T_Ciphertext output;
+		if (this->MultiplyWithTable(output, input)) {
+			return output;
+		}
+
+		return this->ciphertext * input;
+	}
+
+	/**
+	The multiplication is counted towards the amortization threshold (and the table is built once the threshold is exceeded) even when it is not computed,
+	so that callers can compute the uncovered multiplications together (e.g. with a simultaneous multi-exponentiation). For @f$ input < 0 @f$, the table result is inverted.
+
+	@param output receives @f$ [ciphertext * input] @f$, if the table covers the input
+	@param input plaintext input
+	@return true if output was computed with the table, false otherwise
+	@throws std::runtime_error the ciphertext does not have an encryption modulus
+	@throws std::runtime_error the plaintext term is 0
+	*/
+	template <typename T_Ciphertext>
+	bool PrecomputedCiphertext<T_Ciphertext>::MultiplyWithTable (T_Ciphertext &output, const BigInteger &input) const {
+		if (!this->ciphertext.GetEncryptionModulus()) {
+			throw std::runtime_error("This operation requires the encryption modulus.");
+		}
+
+		if (input == 0) {
+			throw std::runtime_error("The plaintext term should not be 0.");
+		}
+
+		++this->useCount;
+		this->maxScalarSize = std::max(this->maxScalarSize, input.GetSize());
+
+		if (!this->tableInitialized && this->useCount > this->amortizationThreshold) {
+			this->table = FixedBaseTable(this->ciphertext.data, *this->ciphertext.GetEncryptionModulus(), this->maxScalarSize, this->memoryBudget);
+			this->tableInitialized = true;
+		}
+
+		BigInteger power = input < 0 ? -input : input;
+		if (!this->table.Covers(power)) {
+			return false;
+		}
+
+		BigInteger result = this->table.GetPowModN(power);
+		if (input < 0) {
+			result.InvertModN(*this->ciphertext.GetEncryptionModulus());
+		}
+		output = T_Ciphertext(std::move(result), this->ciphertext.GetEncryptionModulus());
+
+		return true;
+	}
+
+	/**
+	@return A read-only reference to the wrapped ciphertext
+	*/
+	template <typename T_Ciphertext>
+	const T_Ciphertext &PrecomputedCiphertext<T_Ciphertext>::GetCiphertext () const {
+		return this->ciphertext;
+	}
+
+	/**
+	@return true if the exponentiation table has been built, false otherwise
+	*/
+	template <typename T_Ciphertext>
+	bool PrecomputedCiphertext<T_Ciphertext>::IsPrecomputed () const {
+		return !this->table.IsEmpty();
+	}
+}//namespace Core
+}//namespace SeComLib
+
+#endif//PRECOMPUTED_CIPHERTEXT_IMPLEMENTATION_GUARD
\ No newline at end of file
@@ -0,0 +1,396 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/prime_search.cpp
+@brief Implementation of class PrimeSearch.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "prime_search.h"
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief The parameters, the result and the cancellation flag of a search.
+
+	The candidates are @f$ x = start + step \cdot k @f$, where start has the required parity (step is 2 when the parity of x is fixed, 1 otherwise).
+	*/
+	struct PrimeSearch::Search {
+		/// The size of x
+		size_t numberOfBits;
+
+		/// The multiplier of the linear form (NULL when searching for a plain prime)
+		const BigInteger *multiplier;
+
+		/// multiplier modulo each of the small primes
+		std::vector<unsigned long> multiplierResidues;
+
+		/// @f$ (multiplier \cdot step)^{-1} @f$ modulo each of the small primes (0 if the small prime divides multiplier)
+		std::vector<unsigned long> multiplierStepInverses;
+
+		/// Flag indicating whether x must be prime
+		bool primeX;
+
+		/// The parity of x (0 - even, 1 - odd, -1 - any)
+		int parity;
+
+		/// The distance between consecutive candidates
+		unsigned long step;
+
+		/// Set by the worker which finds the prime (or encounters an error), so that the others stop
+		std::atomic<bool> finished;
+
+		/// Guards x, p and exception
+		std::mutex mutex;
+
+		/// The x of the winning candidate
+		BigInteger x;
+
+		/// The prime
+		BigInteger p;
+
+		/// The first exception thrown by a worker
+		std::exception_ptr exception;
+
+		/// Constructor
+		Search (const size_t numberOfBits, const BigInteger *multiplier, const bool primeX, const int parity) :
+			numberOfBits(numberOfBits), multiplier(multiplier), primeX(primeX), parity(parity), step(parity < 0 ? 1 : 2), finished(false) {
+		}
+	};
+
+	/**
+	@param numberOfBits the bit length of the generated prime
+	@return A prime in the interval @f$ [2^{numberOfBits - 1}, 2^{numberOfBits}) @f$
+	@throws std::runtime_error numberOfBits is smaller than 2
+	*/
+	BigInteger PrimeSearch::GetMaxLengthRandomPrime (const size_t numberOfBits) {
+		if (numberOfBits < 2) {
+			throw std::runtime_error("Primes must have at least 2 bits.");
+		}
+
+		Search search(numberOfBits, NULL, true, 1);
+
+		return PrimeSearch::run(search);
+	}
+
+	/**
+	When x doesn't need to be prime, its parity is chosen so that p is odd.
+
+	@param x receives @f$ x \in [2^{numberOfBits - 1}, 2^{numberOfBits}) @f$
+	@param multiplier the multiplier (positive)
+	@param numberOfBits the bit length of x
+	@param primeX if true, x must be prime as well
+	@return The prime @f$ p = multiplier \cdot x + 1 @f$
+	@throws std::runtime_error invalid parameters (including an odd multiplier for a prime x, which makes p even)
+	*/
+	BigInteger PrimeSearch::GetLinearFormPrime (BigInteger &x, const BigInteger &multiplier, const size_t numberOfBits, const bool primeX) {
+		if (numberOfBits < 3 || multiplier <= 0 || (primeX && multiplier.GetBit(0) == 1)) {
+			throw std::runtime_error("Invalid linear form parameters.");
+		}
+
+		int parity;
+		if (primeX) {
+			parity = 1;
+		}
+		else if (multiplier.GetBit(0) == 1) {
+			parity = 0;
+		}
+		else {
+			parity = -1;
+		}
+
+		Search search(numberOfBits, &multiplier, primeX, parity);
+
+		const std::vector<unsigned long> &smallPrimes = PrimeSearch::getSmallPrimes();
+		search.multiplierResidues.reserve(smallPrimes.size());
+		search.multiplierStepInverses.reserve(smallPrimes.size());
+		for (std::vector<unsigned long>::const_iterator smallPrime = smallPrimes.begin(); smallPrime != smallPrimes.end(); ++smallPrime) {
+			unsigned long multiplierResidue = (multiplier % *smallPrime).ToUnsignedLong();
+			unsigned long multiplierStepResidue = multiplierResidue * search.step % *smallPrime;
+
+			search.multiplierResidues.push_back(multiplierResidue);
+			search.multiplierStepInverses.push_back(0 == multiplierStepResidue ? 0 : PrimeSearch::invertModSmallPrime(multiplierStepResidue, *smallPrime));
+		}
+
+		BigInteger p = PrimeSearch::run(search);
+		x = search.x;
+
+		return p;
+	}
+
+	/**
+	Sieve of Eratosthenes, computed on first use.
+
+	@return The odd primes below PRIME_SEARCH_SIEVE_BOUND
+	*/
+	const std::vector<unsigned long> &PrimeSearch::getSmallPrimes () {
+		static const std::vector<unsigned long> smallPrimes = [] () {
+			std::vector<bool> composite(PRIME_SEARCH_SIEVE_BOUND, false);
+			std::vector<unsigned long> primes;
+
+			for (unsigned long i = 3; i < PRIME_SEARCH_SIEVE_BOUND; i += 2) {
+				if (composite[i]) {
+					continue;
+				}
+
+				primes.push_back(i);
+				for (unsigned long j = i * i; j < PRIME_SEARCH_SIEVE_BOUND; j += 2 * i) {
+					composite[j] = true;
+				}
+			}
+
+			return primes;
+		}();
+
+		return smallPrimes;
+	}
+
+	/**
+	Reads Core.PrimeSearch.threadCount (0, the default, selects one thread for each hardware thread).
+
+	@return The number of worker threads (at least 1)
+	*/
+	size_t PrimeSearch::getThreadCount () {
+		size_t threadCount = Utils::Config::GetInstance().GetParameter<size_t>("Core.PrimeSearch.threadCount", 0);
+
+		if (0 == threadCount) {
+			threadCount = std::thread::hardware_concurrency();
+		}
+
+		return threadCount > 0 ? threadCount : 1;
+	}
+
+	/**
+	A single worker runs in the calling thread.
+
+	@param search the search
+	@return The prime
+	@throws std::exception any exception thrown by the workers
+	*/
+	BigInteger PrimeSearch::run (Search &search) {
+		size_t threadCount = PrimeSearch::getThreadCount();
+
+		if (threadCount > 1) {
+			std::vector<std::thread> threads;
+			for (size_t i = 0; i < threadCount; ++i) {
+				threads.emplace_back(&PrimeSearch::work, std::ref(search));
+			}
+			for (size_t i = 0; i < threadCount; ++i) {
+				threads[i].join();
+			}
+		}
+		else {
+			PrimeSearch::work(search);
+		}
+
+		if (search.exception) {
+			std::rethrow_exception(search.exception);
+		}
+
+		return search.p;
+	}
+
+	/**
+	Exceptions are stored in the search (they can't propagate out of a thread) and stop the other workers.
+
+	@param search the search
+	*/
+	void PrimeSearch::work (Search &search) {
+		try {
+			if (search.numberOfBits < PRIME_SEARCH_MIN_SIEVE_SIZE) {
+				PrimeSearch::searchCandidates(search);
+			}
+			else {
+				PrimeSearch::searchWindows(search);
+			}
+		}
+		catch (...) {
+			std::lock_guard<std::mutex> lock(search.mutex);
+			if (!search.exception) {
+				search.exception = std::current_exception();
+			}
+			search.finished = true;
+		}
+	}
+
+	/**
+	For each small prime s, the candidates divisible by s form an arithmetic progression with difference s, starting at the first k for which
+	@f$ start + step \cdot k \equiv 0 \pmod s @f$ (x) or @f$ multiplier (start + step \cdot k) + 1 \equiv 0 \pmod s @f$ (p).
+	When s divides the multiplier, @f$ p \equiv 1 \pmod s @f$ for all the candidates.
+
+	@param search the search
+	*/
+	void PrimeSearch::searchWindows (Search &search) {
+		const std::vector<unsigned long> &smallPrimes = PrimeSearch::getSmallPrimes();
+		std::vector<char> composite(PRIME_SEARCH_WINDOW_SIZE);
+		BigInteger x, p;
+
+		while (!search.finished.load(std::memory_order_relaxed)) {
+			BigInteger start = PrimeSearch::getStartingPoint(search);
+			std::fill(composite.begin(), composite.end(), 0);
+
+			for (size_t i = 0; i < smallPrimes.size(); ++i) {
+				unsigned long s = smallPrimes[i];
+				unsigned long startResidue = (start % s).ToUnsignedLong();
+
+				if (search.primeX) {
+					//step is 2 (x is odd) and the inverse of 2 is (s + 1) / 2
+					unsigned long first = (s - startResidue) % s * ((s + 1) / 2) % s;
+					for (unsigned long k = first; k < PRIME_SEARCH_WINDOW_SIZE; k += s) {
+						composite[k] = 1;
+					}
+				}
+
+				if (NULL != search.multiplier) {
+					if (0 != search.multiplierStepInverses[i]) {
+						unsigned long pResidue = (search.multiplierResidues[i] * startResidue + 1) % s;
+						unsigned long first = (s - pResidue) % s * search.multiplierStepInverses[i] % s;
+						for (unsigned long k = first; k < PRIME_SEARCH_WINDOW_SIZE; k += s) {
+							composite[k] = 1;
+						}
+					}
+				}
+			}
+
+			for (size_t k = 0; k < PRIME_SEARCH_WINDOW_SIZE; ++k) {
+				if (composite[k]) {
+					continue;
+				}
+
+				if (search.finished.load(std::memory_order_relaxed)) {
+					return;
+				}
+
+				x = start + static_cast<unsigned long>(search.step * k);
+				//the window may run past the largest numberOfBits bit integer
+				if (x.GetSize() != search.numberOfBits) {
+					break;
+				}
+
+				if (PrimeSearch::test(search, x, p)) {
+					std::lock_guard<std::mutex> lock(search.mutex);
+					if (!search.finished) {
+						search.x = x;
+						search.p = p;
+						search.finished = true;
+					}
+					return;
+				}
+			}
+		}
+	}
+
+	/**
+	@param search the search
+	*/
+	void PrimeSearch::searchCandidates (Search &search) {
+		BigInteger p;
+
+		while (!search.finished.load(std::memory_order_relaxed)) {
+			BigInteger x = PrimeSearch::getStartingPoint(search);
+
+			if (PrimeSearch::test(search, x, p)) {
+				std::lock_guard<std::mutex> lock(search.mutex);
+				if (!search.finished) {
+					search.x = x;
+					search.p = p;
+					search.finished = true;
+				}
+				return;
+			}
+		}
+	}
+
+	/**
+	A base 2 Fermat test of every number which must be prime rejects the composites with a single modular exponentiation each,
+	before the Miller-Rabin tests (BigInteger::IsPrime) are run.
+
+	@param search the search
+	@param x the candidate
+	@param p receives the prime candidate (x or @f$ multiplier \cdot x + 1 @f$)
+	@return true if the candidate satisfies all the conditions, false otherwise
+	*/
+	bool PrimeSearch::test (const Search &search, const BigInteger &x, BigInteger &p) {
+		if (NULL != search.multiplier) {
+			p = *search.multiplier * x + 1;
+		}
+		else {
+			p = x;
+		}
+
+		//the Fermat test requires an odd modulus larger than 2
+		if (p < 5 || (search.primeX && x < 5)) {
+			return (!search.primeX || x.IsPrime()) && p.IsPrime();
+		}
+
+		if (search.primeX && BigInteger(2).GetPowModN(x - 1, x) != 1) {
+			return false;
+		}
+		if (NULL != search.multiplier && BigInteger(2).GetPowModN(p - 1, p) != 1) {
+			return false;
+		}
+
+		return (!search.primeX || x.IsPrime()) && (NULL == search.multiplier || p.IsPrime());
+	}
+
+	/**
+	@param search the search
+	@return A random integer in the interval @f$ [2^{numberOfBits - 1}, 2^{numberOfBits}) @f$, having the required parity
+	*/
+	BigInteger PrimeSearch::getStartingPoint (const Search &search) {
+		BigInteger start = RandomProvider::GetInstance().GetRandomInteger(search.numberOfBits - 1);
+		start.SetBit(search.numberOfBits - 1);
+
+		if (1 == search.parity) {
+			start.SetBit(0);
+		}
+		else if (0 == search.parity && start.GetBit(0) == 1) {
+			//start is odd and larger than 2^(numberOfBits - 1), so it can't leave the interval
+			start = start - 1;
+		}
+
+		return start;
+	}
+
+	/**
+	Uses Fermat's little theorem: @f$ a^{-1} \equiv a^{s - 2} \pmod s @f$.
+
+	@param a an integer which is not divisible by s
+	@param s a prime smaller than @f$ 2^{32} @f$
+	@return @f$ a^{-1} \pmod s @f$
+	*/
+	unsigned long PrimeSearch::invertModSmallPrime (const unsigned long a, const unsigned long s) {
+		unsigned long long result = 1;
+		unsigned long long base = a % s;
+
+		for (unsigned long exponent = s - 2; exponent > 0; exponent >>= 1) {
+			if (exponent & 1) {
+				result = result * base % s;
+			}
+			base = base * base % s;
+		}
+
+		return static_cast<unsigned long>(result);
+	}
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
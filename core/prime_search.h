@@ -0,0 +1,122 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/prime_search.h
+@brief Definition of class PrimeSearch.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef PRIME_SEARCH_HEADER_GUARD
+#define PRIME_SEARCH_HEADER_GUARD
+
+//include our headers
+#include "utils/config.h"
+#include "big_integer.h"
+#include "random_provider.h"
+
+//include C++ headers
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief The number of candidates sieved at once by each PrimeSearch worker.
+	*/
+	#define PRIME_SEARCH_WINDOW_SIZE 4096
+
+	/**
+	@brief The small primes below this bound are sieved out of the candidate windows of PrimeSearch (trial division).
+	*/
+	#define PRIME_SEARCH_SIEVE_BOUND 65536
+
+	/**
+	@brief Candidates smaller than this size (in bits) are drawn at random and tested one by one (they could be sieved out by themselves).
+	*/
+	#define PRIME_SEARCH_MIN_SIEVE_SIZE 32
+
+	/**
+	@brief Sieved, parallel random prime generator, used by the key generation of the crypto providers.
+
+	Each worker picks a random starting point and sieves a window of PRIME_SEARCH_WINDOW_SIZE candidates, which removes the multiples of all the primes
+	below PRIME_SEARCH_SIEVE_BOUND without touching the big integers. Only the remaining candidates are passed to the Miller-Rabin test
+	(BigInteger::IsPrime), which rejects most composites in the first round. When the window is exhausted, the worker moves on to a new random starting point.
+
+	The search runs on Core.PrimeSearch.threadCount worker threads (by default, one for each hardware thread).
+	The first prime found is returned and the other workers stop at their next candidate.
+
+	Besides plain primes, it searches for primes of the form @f$ p = m x + 1 @f$, where @f$ x @f$ has a given size and may be required to be prime as well
+	(both conditions are sieved at once), which is what the DGK, Okamoto-Uchiyama and ElGamal key generation requires.
+
+	@note Incremental search selects the primes which follow large prime gaps slightly more often than the others, which does not affect the security of the keys.
+	*/
+	class PrimeSearch {
+	public:
+		/// Generates a random prime, guaranteed to have numberOfBits length
+		static BigInteger GetMaxLengthRandomPrime (const size_t numberOfBits);
+
+		/// Generates a random prime @f$ p = multiplier \cdot x + 1 @f$, where x has numberOfBits length (and is prime, if primeX is set)
+		static BigInteger GetLinearFormPrime (BigInteger &x, const BigInteger &multiplier, const size_t numberOfBits, const bool primeX);
+
+	private:
+		/// The parameters, the result and the cancellation flag of a search
+		struct Search;
+
+		/// Returns the odd primes below PRIME_SEARCH_SIEVE_BOUND
+		static const std::vector<unsigned long> &getSmallPrimes ();
+
+		/// Returns the number of worker threads
+		static size_t getThreadCount ();
+
+		/// Runs the search on the worker threads and returns the prime
+		static BigInteger run (Search &search);
+
+		/// Worker thread entry point
+		static void work (Search &search);
+
+		/// Searches random windows until any of the workers finds a prime
+		static void searchWindows (Search &search);
+
+		/// Tests random candidates one by one, until one of them satisfies the conditions
+		static void searchCandidates (Search &search);
+
+		/// Checks if the candidate satisfies the conditions of the search
+		static bool test (const Search &search, const BigInteger &x, BigInteger &p);
+
+		/// Draws a random starting point of the correct size and parity
+		static BigInteger getStartingPoint (const Search &search);
+
+		/// Computes @f$ a^{-1} \pmod s @f$, for a prime s
+		static unsigned long invertModSmallPrime (const unsigned long a, const unsigned long s);
+
+		/// Default constructor - not implemented
+		PrimeSearch ();
+	};
+}//namespace Core
+}//namespace SeComLib
+
+#endif//PRIME_SEARCH_HEADER_GUARD
\ No newline at end of file
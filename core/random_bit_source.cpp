@@ -0,0 +1,112 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/random_bit_source.cpp
+@brief Implementation of class RandomBitSource.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "random_bit_source.h"
+
+namespace SeComLib {
+namespace Core {
+	/**
+	Each thread gets its own instance, so no locking is required.
+
+	@return A reference to the instance owned by the calling thread
+	*/
+	RandomBitSource &RandomBitSource::GetInstance () {
+		static thread_local RandomBitSource instance;
+
+		return instance;
+	}
+
+	/**
+	The pool is filled on first use.
+	*/
+	RandomBitSource::RandomBitSource () : poolPosition(RANDOM_BIT_SOURCE_POOL_SIZE), word(0), wordBitCount(0) {
+	}
+
+	/**
+	@return true or false, with equal probability
+	*/
+	bool RandomBitSource::GetBit () {
+		if (0 == this->wordBitCount) {
+			this->word = this->nextWord();
+			this->wordBitCount = 64;
+		}
+
+		bool bit = (this->word & 1) != 0;
+		this->word >>= 1;
+		--this->wordBitCount;
+
+		return bit;
+	}
+
+	/**
+	When the current word doesn't hold enough bits, its remaining bits are discarded and the next word is used.
+
+	@param bitCount the number of random bits (1 - 64)
+	@return An integer in the interval @f$ [0, 2^{bitCount}) @f$
+	@throws std::runtime_error bitCount is not in the interval [1, 64]
+	*/
+	uint64_t RandomBitSource::GetBits (const size_t bitCount) {
+		if (0 == bitCount || bitCount > 64) {
+			throw std::runtime_error("The number of bits must be between 1 and 64.");
+		}
+
+		if (64 == bitCount) {
+			return this->nextWord();
+		}
+
+		if (this->wordBitCount < bitCount) {
+			this->word = this->nextWord();
+			this->wordBitCount = 64;
+		}
+
+		uint64_t bits = this->word & ((static_cast<uint64_t>(1) << bitCount) - 1);
+		this->word >>= bitCount;
+		this->wordBitCount -= bitCount;
+
+		return bits;
+	}
+
+	/**
+	Each word is erased from the pool once it has been handed out.
+
+	@return A random word
+	*/
+	uint64_t RandomBitSource::nextWord () {
+		if (RANDOM_BIT_SOURCE_POOL_SIZE == this->poolPosition) {
+			RandomProvider::GetInstance().GetRandomBytes(reinterpret_cast<unsigned char *>(this->pool), sizeof(this->pool));
+			this->poolPosition = 0;
+		}
+
+		uint64_t output = this->pool[this->poolPosition];
+		this->pool[this->poolPosition] = 0;
+		++this->poolPosition;
+
+		return output;
+	}
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
@@ -0,0 +1,94 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/random_bit_source.h
+@brief Definition of class RandomBitSource.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef RANDOM_BIT_SOURCE_HEADER_GUARD
+#define RANDOM_BIT_SOURCE_HEADER_GUARD
+
+//include our headers
+#include "random_provider.h"
+
+//include C++ headers
+#include <cstdint>
+#include <stdexcept>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief The number of 64 bit words drawn from RandomProvider every time the pool of RandomBitSource is empty.
+	*/
+	#define RANDOM_BIT_SOURCE_POOL_SIZE 64
+
+	/**
+	@brief Buffered source of random bits and small (1 - 64 bit) random words.
+
+	The protocols toss many fair coins (e.g. one for each bit of every DGK comparison). Drawing each of them as a BigInteger
+	(RandomProvider::GetRandomInteger(1)) pays for a full integer allocation and a generator call per bit, so this class draws
+	RANDOM_BIT_SOURCE_POOL_SIZE words at a time from RandomProvider and returns the bits as native integers.
+
+	Works as a per-thread singleton, like RandomProvider: RandomBitSource::GetInstance().GetBit()
+	*/
+	class RandomBitSource {
+	public:
+		/// Returns a reference to the instance owned by the calling thread
+		static RandomBitSource &GetInstance ();
+
+		/// Returns a random bit
+		bool GetBit ();
+
+		/// Returns a random integer having at most bitCount bits (1 - 64)
+		uint64_t GetBits (const size_t bitCount);
+
+	private:
+		/// The pool of random words
+		uint64_t pool[RANDOM_BIT_SOURCE_POOL_SIZE];
+
+		/// The index of the next unused word of pool
+		size_t poolPosition;
+
+		/// The unused bits of the current word (the least significant wordBitCount bits)
+		uint64_t word;
+
+		/// The number of unused bits in word
+		size_t wordBitCount;
+
+		/// Loads the next word from the pool (refilling the pool if it is empty)
+		uint64_t nextWord ();
+
+		/// Default constructor (private, Singleton Pattern)
+		RandomBitSource ();
+
+		/// Copy constructor - not implemented
+		RandomBitSource (RandomBitSource const &);
+
+		/// Copy assignment operator - not implemented
+		RandomBitSource operator= (RandomBitSource const &);
+	};
+}//namespace Core
+}//namespace SeComLib
+
+#endif//RANDOM_BIT_SOURCE_HEADER_GUARD
\ No newline at end of file
@@ -35,16 +35,23 @@ limitations under the License.
 #include "random_provider_base.h"
 
 //MPIR is compatible with GMPs functions
-#if defined(LIB_GMP) || defined(LIB_MPIR)
+#if defined(LIB_GMP) || defined(LIB_GMP_MONTGOMERY) || defined(LIB_MPIR)
 	#include "random_provider_gmp.h"
 #endif
 
+#include "random_provider_chacha20.h"
+
 namespace SeComLib {
 namespace Core {
 	//MPIR is compatible with GMPs functions
-	#if defined(LIB_GMP) || defined(LIB_MPIR)
-		/// Masks the big integer library random number generator wrapper classes under a common name
-		typedef RandomProviderBase<RandomProviderGmp> RandomProvider;
+	#if defined(LIB_GMP) || defined(LIB_GMP_MONTGOMERY) || defined(LIB_MPIR)
+		#if defined(RANDOM_PROVIDER_GMP)
+			/// Masks the big integer library random number generator wrapper classes under a common name
+			typedef RandomProviderBase<RandomProviderGmp> RandomProvider;
+		#else
+			/// The ChaCha20 generator is the default (define RANDOM_PROVIDER_GMP to use the GMP Mersenne Twister instead)
+			typedef RandomProviderBase<RandomProviderChaCha20> RandomProvider;
+		#endif
 	#endif
 }//namespace Core
 }//namespace SeComLib
@@ -41,7 +41,10 @@ namespace Core {
 	/**
 	@brief Template class which masks various RandomProvider implementations and provides a common interface that all of them must implement.
 
-	Works as a singleton: RandomProvider::GetInstance().DoStuff()
+	Works as a per-thread singleton: RandomProvider::GetInstance().DoStuff()
+
+	Each thread gets its own instance, seeded independently from the operating system entropy source, so the random generator states are never shared
+	and no locking is required. Do not pass the returned reference to other threads.
 
 	@tparam T_Impl The random provider library wrapper
 	*/
@@ -51,7 +54,7 @@ namespace Core {
 		/// The random provider implementation requires access to the underlying data
 		friend T_Impl;
 
-		/// Returns a reference to the singleton
+		/// Returns a reference to the instance owned by the calling thread
 		static RandomProviderBase<T_Impl> &GetInstance ();
 
 		/// Generates a random integer having at most numberOfBits bits
@@ -63,13 +66,13 @@ namespace Core {
 		/// Generates a random prime, guaranteed to have numberOfBits length
 		BigInteger GetMaxLengthRandomPrime (const size_t &numberOfBits);
 
+		/// Fills output with byteCount random bytes
+		void GetRandomBytes (unsigned char *output, const size_t byteCount);
+
 	private:
 		/// Implementation-defined random generator state
 		typename T_Impl::RandomGeneratorState randomGeneratorState;
 
-		/// Random seed required for the random generator state initialization
-		unsigned int randomSeed;
-
 		/// Default constructor (private, Singleton Pattern)
 		/// @todo Use the BOOST libray to produce the seed.
 		/// @todo Create a custom exception class.
@@ -33,14 +33,14 @@ limitations under the License.
 namespace SeComLib {
 namespace Core {
 	/**
-	Creates a static instance of this class and returns it.
-	The instance will be destroyed when the application terminates (singleton pattern).
+	Creates a thread local instance of this class (on the first call from each thread) and returns it.
+	The instance will be destroyed when the thread terminates (singleton pattern, one instance per thread).
 
-	@return The static instance of this class
+	@return The instance owned by the calling thread
 	*/
 	template <typename T_Impl>
 	inline RandomProviderBase<T_Impl> &RandomProviderBase<T_Impl>::GetInstance () {
-		static RandomProviderBase<T_Impl> instance;
+		static thread_local RandomProviderBase<T_Impl> instance;
 		return instance;
 	}
 
@@ -86,6 +86,16 @@ namespace Core {
 		return output;
 	}
 
+	/**
+	@note Can't use const correctness, since it changes the random generator state
+	@param output receives byteCount random bytes
+	@param byteCount the number of bytes
+	*/
+	template <typename T_Impl>
+	inline void RandomProviderBase<T_Impl>::GetRandomBytes (unsigned char *output, const size_t byteCount) {
+		T_Impl::GetRandomBytes(output, *this, byteCount);
+	}
+
 	/**
 	Initializes the current instance.
 	*/
@@ -0,0 +1,397 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/random_provider_chacha20.cpp
+@brief Implementation of class RandomProviderChaCha20.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "random_provider_chacha20.h"
+
+#if defined(RANDOM_PROVIDER_CHACHA20_AVX2)
+	#include <immintrin.h>
+#endif
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief The ChaCha20 quarter round
+	*/
+	#define CHACHA20_QUARTER_ROUND(a, b, c, d) \
+		a += b; d ^= a; d = (d << 16) | (d >> 16); \
+		c += d; b ^= c; b = (b << 12) | (b >> 20); \
+		a += b; d ^= a; d = (d << 8) | (d >> 24); \
+		c += d; b ^= c; b = (b << 7) | (b >> 25);
+
+	/**
+	Reads a RANDOM_PROVIDER_CHACHA20_KEY_SIZE byte key via platform dependent means and generates the first keystream buffer.
+
+	@param randomProvider uninitialized RandomProvider
+	@throws std::runtime_error error encountered while trying to read the key
+	*/
+	void RandomProviderChaCha20::Initialize (RandomProviderBase<RandomProviderChaCha20> &randomProvider) {
+		State &state = randomProvider.randomGeneratorState;
+		unsigned char keyBytes[RANDOM_PROVIDER_CHACHA20_KEY_SIZE];
+
+	#if _WIN32
+		for (size_t i = 0; i < RANDOM_PROVIDER_CHACHA20_KEY_SIZE; i += sizeof(unsigned int)) {
+			unsigned int value;
+			if (0 != rand_s(&value)) {
+				throw std::runtime_error("Error calling rand_s.");
+			}
+			std::memcpy(keyBytes + i, &value, sizeof(unsigned int));
+		}
+
+	#else
+		std::ifstream randomGeneratorFile("/dev/urandom", std::ios::binary);
+
+		if (!randomGeneratorFile.is_open()) {
+			throw std::runtime_error("Error opening /dev/urandom.");
+		}
+
+		randomGeneratorFile.read(reinterpret_cast<char *>(keyBytes), RANDOM_PROVIDER_CHACHA20_KEY_SIZE);
+		if (!randomGeneratorFile) {
+			throw std::runtime_error("Error reading from /dev/urandom.");
+		}
+	#endif
+
+		//the key words are little-endian
+		for (size_t i = 0; i < RANDOM_PROVIDER_CHACHA20_KEY_SIZE / 4; ++i) {
+			state.key[i] = static_cast<uint32_t>(keyBytes[4 * i]) | (static_cast<uint32_t>(keyBytes[4 * i + 1]) << 8) | (static_cast<uint32_t>(keyBytes[4 * i + 2]) << 16) | (static_cast<uint32_t>(keyBytes[4 * i + 3]) << 24);
+		}
+		std::fill(keyBytes, keyBytes + RANDOM_PROVIDER_CHACHA20_KEY_SIZE, 0);
+
+		state.counter = 0;
+		RandomProviderChaCha20::refill(state);
+	}
+
+	/**
+	Erases the key and the unused keystream.
+
+	@param randomProvider initialized RandomProvider
+	*/
+	void RandomProviderChaCha20::Destroy (RandomProviderBase<RandomProviderChaCha20> &randomProvider) {
+		State &state = randomProvider.randomGeneratorState;
+
+		std::fill(state.key, state.key + RANDOM_PROVIDER_CHACHA20_KEY_SIZE / 4, 0);
+		std::fill(state.buffer, state.buffer + RANDOM_PROVIDER_CHACHA20_BUFFER_SIZE, 0);
+		state.position = RANDOM_PROVIDER_CHACHA20_BUFFER_SIZE;
+	}
+
+	/**
+	Imports @f$ \lceil numberOfBits / 8 \rceil @f$ random bytes, after clearing the excess bits of the most significant one.
+	The buffer is zero padded to a multiple of 8 bytes, which BigInteger::Import handles a word at a time.
+
+	@param output BigInteger instance
+	@param randomProvider initialized RandomProvider
+	@param numberOfBits the maximum bit length of the generated random number
+	*/
+	void RandomProviderChaCha20::GetRandomInteger (BigInteger &output, RandomProviderBase<RandomProviderChaCha20> &randomProvider, const size_t numberOfBits) {
+		if (0 == numberOfBits) {
+			output = 0;
+			return;
+		}
+
+		size_t byteCount = (numberOfBits + 7) / 8;
+		size_t paddedByteCount = (byteCount + 7) / 8 * 8;
+
+		//the blinding factors and randomizers used by the protocols fit in the stack buffer
+		unsigned char stackBuffer[512];
+		std::vector<unsigned char> heapBuffer;
+		unsigned char *bytes = stackBuffer;
+		if (paddedByteCount > sizeof(stackBuffer)) {
+			heapBuffer.resize(paddedByteCount);
+			bytes = &heapBuffer[0];
+		}
+
+		RandomProviderChaCha20::GetRandomBytes(bytes, randomProvider, byteCount);
+		bytes[byteCount - 1] = static_cast<unsigned char>(bytes[byteCount - 1] & (0xFF >> (8 * byteCount - numberOfBits)));
+		std::memset(bytes + byteCount, 0, paddedByteCount - byteCount);
+
+		output.Import(bytes, paddedByteCount);
+	}
+
+	/**
+	Draws random integers having the size of maximumValue until one of them is smaller than maximumValue (less than 2 draws on average).
+
+	@param output BigInteger instance
+	@param randomProvider initialized RandomProvider
+	@param maximumValue the upper limit of the generated random number (non-inclusive)
+	@throws std::runtime_error maximumValue is not positive
+	*/
+	void RandomProviderChaCha20::GetRandomInteger (BigInteger &output, RandomProviderBase<RandomProviderChaCha20> &randomProvider, const BigInteger &maximumValue) {
+		if (maximumValue <= 0) {
+			throw std::runtime_error("The maximum value must be positive.");
+		}
+
+		size_t numberOfBits = maximumValue.GetSize();
+		do {
+			RandomProviderChaCha20::GetRandomInteger(output, randomProvider, numberOfBits);
+		}
+		while (output >= maximumValue);
+	}
+
+	/**
+	Generates random numbers in the interval @f$ [0, 2^{numberOfBits - 1}) @f$.
+	Shifts the integer to the interval @f$ [2^{numberOfBits - 1}, 2^{numberOfBits}) @f$ by setting the MSB.
+	Repeats the process until the obtained number is prime.
+
+	@param output BigInteger instance
+	@param randomProvider initialized RandomProvider
+	@param numberOfBits the bit length of the generated prime
+	*/
+	void RandomProviderChaCha20::GetMaxLengthRandomPrime (BigInteger &output, RandomProviderBase<RandomProviderChaCha20> &randomProvider, const size_t numberOfBits) {
+		do {
+			RandomProviderChaCha20::GetRandomInteger(output, randomProvider, numberOfBits - 1);
+			output.SetBit(numberOfBits - 1);
+		}
+		while (!output.IsPrime());
+	}
+
+	/**
+	Small requests are served from the keystream buffer. When the buffer is empty, requests of at least RANDOM_PROVIDER_CHACHA20_BUFFER_SIZE bytes
+	receive whole blocks generated directly into output, after which the buffer is refilled (which replaces the key).
+
+	@param output receives byteCount random bytes
+	@param randomProvider initialized RandomProvider
+	@param byteCount the number of bytes
+	*/
+	void RandomProviderChaCha20::GetRandomBytes (unsigned char *output, RandomProviderBase<RandomProviderChaCha20> &randomProvider, const size_t byteCount) {
+		State &state = randomProvider.randomGeneratorState;
+		size_t remaining = byteCount;
+
+		while (remaining > 0) {
+			if (RANDOM_PROVIDER_CHACHA20_BUFFER_SIZE == state.position) {
+				if (remaining >= RANDOM_PROVIDER_CHACHA20_BUFFER_SIZE) {
+					size_t blockCount = remaining / 64;
+					RandomProviderChaCha20::generateBlocks(output, state.key, state.counter, blockCount);
+					state.counter += blockCount;
+					output += blockCount * 64;
+					remaining -= blockCount * 64;
+				}
+
+				RandomProviderChaCha20::refill(state);
+				continue;
+			}
+
+			size_t count = std::min(remaining, RANDOM_PROVIDER_CHACHA20_BUFFER_SIZE - state.position);
+			std::memcpy(output, state.buffer + state.position, count);
+			std::memset(state.buffer + state.position, 0, count);
+
+			state.position += count;
+			output += count;
+			remaining -= count;
+		}
+	}
+
+	/**
+	@param state the generator state
+	*/
+	void RandomProviderChaCha20::refill (State &state) {
+		const size_t blockCount = RANDOM_PROVIDER_CHACHA20_BUFFER_SIZE / 64;
+		RandomProviderChaCha20::generateBlocks(state.buffer, state.key, state.counter, blockCount);
+		state.counter += blockCount;
+
+		//fast key erasure: the first bytes of the keystream become the next key
+		for (size_t i = 0; i < RANDOM_PROVIDER_CHACHA20_KEY_SIZE / 4; ++i) {
+			state.key[i] = static_cast<uint32_t>(state.buffer[4 * i]) | (static_cast<uint32_t>(state.buffer[4 * i + 1]) << 8) | (static_cast<uint32_t>(state.buffer[4 * i + 2]) << 16) | (static_cast<uint32_t>(state.buffer[4 * i + 3]) << 24);
+		}
+		std::memset(state.buffer, 0, RANDOM_PROVIDER_CHACHA20_KEY_SIZE);
+		state.position = RANDOM_PROVIDER_CHACHA20_KEY_SIZE;
+	}
+
+	/**
+	@return true if the library was built with the AVX2 keystream generator and the CPU supports AVX2, false otherwise
+	*/
+	bool RandomProviderChaCha20::IsAvx2Available () {
+	#if defined(RANDOM_PROVIDER_CHACHA20_AVX2)
+		static const bool available = __builtin_cpu_supports("avx2");
+
+		return available;
+	#else
+		return false;
+	#endif
+	}
+
+	/**
+	Uses the AVX2 implementation for the groups of 8 blocks, when the CPU supports it, and the portable implementation for the rest.
+
+	@param output receives 64 * blockCount bytes
+	@param key the key
+	@param counter the index of the first block
+	@param blockCount the number of blocks
+	*/
+	void RandomProviderChaCha20::generateBlocks (unsigned char *output, const uint32_t *key, const uint64_t counter, const size_t blockCount) {
+		size_t vectorBlockCount = 0;
+
+		if (RandomProviderChaCha20::IsAvx2Available()) {
+			vectorBlockCount = blockCount - blockCount % 8;
+			RandomProviderChaCha20::GenerateBlocksAvx2(output, key, counter, vectorBlockCount);
+		}
+
+		RandomProviderChaCha20::GenerateBlocksPortable(output + 64 * vectorBlockCount, key, counter + vectorBlockCount, blockCount - vectorBlockCount);
+	}
+
+	/**
+	The original ChaCha20 block function (64 bit block counter, 64 bit nonce, which is always 0, since every key is used for a single stream).
+
+	@param output receives 64 * blockCount bytes
+	@param key the key
+	@param counter the index of the first block
+	@param blockCount the number of blocks
+	*/
+	void RandomProviderChaCha20::GenerateBlocksPortable (unsigned char *output, const uint32_t *key, const uint64_t counter, const size_t blockCount) {
+		for (size_t block = 0; block < blockCount; ++block) {
+			uint32_t input[16] = {0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+				key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+				static_cast<uint32_t>(counter + block), static_cast<uint32_t>((counter + block) >> 32), 0, 0};
+
+			uint32_t x[16];
+			std::copy(input, input + 16, x);
+
+			for (size_t round = 0; round < 10; ++round) {
+				CHACHA20_QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+				CHACHA20_QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+				CHACHA20_QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+				CHACHA20_QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+				CHACHA20_QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+				CHACHA20_QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+				CHACHA20_QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+				CHACHA20_QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+			}
+
+			for (size_t i = 0; i < 16; ++i) {
+				uint32_t word = x[i] + input[i];
+				output[64 * block + 4 * i] = static_cast<unsigned char>(word);
+				output[64 * block + 4 * i + 1] = static_cast<unsigned char>(word >> 8);
+				output[64 * block + 4 * i + 2] = static_cast<unsigned char>(word >> 16);
+				output[64 * block + 4 * i + 3] = static_cast<unsigned char>(word >> 24);
+			}
+		}
+	}
+
+#if defined(RANDOM_PROVIDER_CHACHA20_AVX2)
+	/**
+	@brief Rotates the 32 bit lanes of an AVX2 register to the left
+	*/
+	#define CHACHA20_ROTATE_AVX2(v, n) _mm256_or_si256(_mm256_slli_epi32(v, n), _mm256_srli_epi32(v, 32 - (n)))
+
+	/**
+	@brief The ChaCha20 quarter round, applied to 8 blocks at once (the rotations by whole bytes are byte shuffles, using the rotate16 and rotate8 masks)
+	*/
+	#define CHACHA20_QUARTER_ROUND_AVX2(a, b, c, d) \
+		a = _mm256_add_epi32(a, b); d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rotate16); \
+		c = _mm256_add_epi32(c, d); b = CHACHA20_ROTATE_AVX2(_mm256_xor_si256(b, c), 12); \
+		a = _mm256_add_epi32(a, b); d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rotate8); \
+		c = _mm256_add_epi32(c, d); b = CHACHA20_ROTATE_AVX2(_mm256_xor_si256(b, c), 7);
+
+	/**
+	@brief Transposes the 8 x 8 word matrix formed by 8 AVX2 registers (register i holds word i of 8 blocks) and stores row j (8 words of block j) at output + 64 j
+	*/
+	#define CHACHA20_TRANSPOSE_STORE_AVX2(r0, r1, r2, r3, r4, r5, r6, r7, output) { \
+		__m256i t0 = _mm256_unpacklo_epi32(r0, r1), t1 = _mm256_unpackhi_epi32(r0, r1), t2 = _mm256_unpacklo_epi32(r2, r3), t3 = _mm256_unpackhi_epi32(r2, r3); \
+		__m256i t4 = _mm256_unpacklo_epi32(r4, r5), t5 = _mm256_unpackhi_epi32(r4, r5), t6 = _mm256_unpacklo_epi32(r6, r7), t7 = _mm256_unpackhi_epi32(r6, r7); \
+		__m256i u0 = _mm256_unpacklo_epi64(t0, t2), u1 = _mm256_unpackhi_epi64(t0, t2), u2 = _mm256_unpacklo_epi64(t1, t3), u3 = _mm256_unpackhi_epi64(t1, t3); \
+		__m256i u4 = _mm256_unpacklo_epi64(t4, t6), u5 = _mm256_unpackhi_epi64(t4, t6), u6 = _mm256_unpacklo_epi64(t5, t7), u7 = _mm256_unpackhi_epi64(t5, t7); \
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output), _mm256_permute2x128_si256(u0, u4, 0x20)); \
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + 64), _mm256_permute2x128_si256(u1, u5, 0x20)); \
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + 128), _mm256_permute2x128_si256(u2, u6, 0x20)); \
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + 192), _mm256_permute2x128_si256(u3, u7, 0x20)); \
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + 256), _mm256_permute2x128_si256(u0, u4, 0x31)); \
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + 320), _mm256_permute2x128_si256(u1, u5, 0x31)); \
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + 384), _mm256_permute2x128_si256(u2, u6, 0x31)); \
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + 448), _mm256_permute2x128_si256(u3, u7, 0x31)); \
+	}
+
+	/**
+	Register i holds word i of 8 consecutive blocks, so every instruction advances all of them. The state is kept in named variables (rather than an array), so that
+	the compiler can keep it in registers, and the words are transposed back into blocks before being stored (x86 is little-endian).
+
+	@param output receives 64 * blockCount bytes
+	@param key the key
+	@param counter the index of the first block
+	@param blockCount the number of blocks (a multiple of 8)
+	*/
+	__attribute__((target("avx2"))) void RandomProviderChaCha20::GenerateBlocksAvx2 (unsigned char *output, const uint32_t *key, const uint64_t counter, const size_t blockCount) {
+		const __m256i rotate16 = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13, 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+		const __m256i rotate8 = _mm256_setr_epi8(3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14, 3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14);
+
+		for (size_t group = 0; group < blockCount; group += 8) {
+			uint32_t counterLow[8];
+			uint32_t counterHigh[8];
+			for (size_t lane = 0; lane < 8; ++lane) {
+				counterLow[lane] = static_cast<uint32_t>(counter + group + lane);
+				counterHigh[lane] = static_cast<uint32_t>((counter + group + lane) >> 32);
+			}
+			const __m256i input12 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(counterLow));
+			const __m256i input13 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(counterHigh));
+
+			__m256i x0 = _mm256_set1_epi32(0x61707865), x1 = _mm256_set1_epi32(0x3320646e), x2 = _mm256_set1_epi32(0x79622d32), x3 = _mm256_set1_epi32(0x6b206574);
+			__m256i x4 = _mm256_set1_epi32(static_cast<int>(key[0])), x5 = _mm256_set1_epi32(static_cast<int>(key[1])), x6 = _mm256_set1_epi32(static_cast<int>(key[2])), x7 = _mm256_set1_epi32(static_cast<int>(key[3]));
+			__m256i x8 = _mm256_set1_epi32(static_cast<int>(key[4])), x9 = _mm256_set1_epi32(static_cast<int>(key[5])), x10 = _mm256_set1_epi32(static_cast<int>(key[6])), x11 = _mm256_set1_epi32(static_cast<int>(key[7]));
+			__m256i x12 = input12, x13 = input13, x14 = _mm256_setzero_si256(), x15 = _mm256_setzero_si256();
+
+			for (size_t round = 0; round < 10; ++round) {
+				CHACHA20_QUARTER_ROUND_AVX2(x0, x4, x8, x12);
+				CHACHA20_QUARTER_ROUND_AVX2(x1, x5, x9, x13);
+				CHACHA20_QUARTER_ROUND_AVX2(x2, x6, x10, x14);
+				CHACHA20_QUARTER_ROUND_AVX2(x3, x7, x11, x15);
+				CHACHA20_QUARTER_ROUND_AVX2(x0, x5, x10, x15);
+				CHACHA20_QUARTER_ROUND_AVX2(x1, x6, x11, x12);
+				CHACHA20_QUARTER_ROUND_AVX2(x2, x7, x8, x13);
+				CHACHA20_QUARTER_ROUND_AVX2(x3, x4, x9, x14);
+			}
+
+			//add the input state (words 14 and 15 of the input are 0)
+			x0 = _mm256_add_epi32(x0, _mm256_set1_epi32(0x61707865));
+			x1 = _mm256_add_epi32(x1, _mm256_set1_epi32(0x3320646e));
+			x2 = _mm256_add_epi32(x2, _mm256_set1_epi32(0x79622d32));
+			x3 = _mm256_add_epi32(x3, _mm256_set1_epi32(0x6b206574));
+			x4 = _mm256_add_epi32(x4, _mm256_set1_epi32(static_cast<int>(key[0])));
+			x5 = _mm256_add_epi32(x5, _mm256_set1_epi32(static_cast<int>(key[1])));
+			x6 = _mm256_add_epi32(x6, _mm256_set1_epi32(static_cast<int>(key[2])));
+			x7 = _mm256_add_epi32(x7, _mm256_set1_epi32(static_cast<int>(key[3])));
+			x8 = _mm256_add_epi32(x8, _mm256_set1_epi32(static_cast<int>(key[4])));
+			x9 = _mm256_add_epi32(x9, _mm256_set1_epi32(static_cast<int>(key[5])));
+			x10 = _mm256_add_epi32(x10, _mm256_set1_epi32(static_cast<int>(key[6])));
+			x11 = _mm256_add_epi32(x11, _mm256_set1_epi32(static_cast<int>(key[7])));
+			x12 = _mm256_add_epi32(x12, input12);
+			x13 = _mm256_add_epi32(x13, input13);
+
+			unsigned char *blocks = output + 64 * group;
+			CHACHA20_TRANSPOSE_STORE_AVX2(x0, x1, x2, x3, x4, x5, x6, x7, blocks);
+			CHACHA20_TRANSPOSE_STORE_AVX2(x8, x9, x10, x11, x12, x13, x14, x15, blocks + 32);
+		}
+	}
+#else
+	/**
+	Not available without the AVX2 implementation (see RandomProviderChaCha20::IsAvx2Available).
+
+	@throws std::runtime_error always
+	*/
+	void RandomProviderChaCha20::GenerateBlocksAvx2 (unsigned char *, const uint32_t *, const uint64_t, const size_t) {
+		throw std::runtime_error("The AVX2 ChaCha20 implementation is not available.");
+	}
+#endif
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
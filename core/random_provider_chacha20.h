@@ -0,0 +1,133 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/random_provider_chacha20.h
+@brief Definition of class RandomProviderChaCha20.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef RANDOM_PROVIDER_CHACHA20_HEADER_GUARD
+#define RANDOM_PROVIDER_CHACHA20_HEADER_GUARD
+
+//defined for WIN64 as well
+#ifdef _WIN32
+	//required by iostream to include the Windows function errno_t rand_s(unsigned int* randomValue)
+	#define _CRT_RAND_S
+#endif
+
+#include "random_provider_base.h"
+
+//include C++ headers
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+//the AVX2 keystream generator requires the GCC / Clang target attributes (other compilers use the portable implementation)
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+	#define RANDOM_PROVIDER_CHACHA20_AVX2
+#endif
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief The size (in bytes) of the keystream buffer of RandomProviderChaCha20 (a multiple of 8 ChaCha20 blocks).
+	*/
+	#define RANDOM_PROVIDER_CHACHA20_BUFFER_SIZE 4096
+
+	/**
+	@brief The size (in bytes) of the ChaCha20 key, read from the operating system entropy source.
+	*/
+	#define RANDOM_PROVIDER_CHACHA20_KEY_SIZE 32
+
+	/**
+	@brief ChaCha20 based cryptographically secure random number generator.
+
+	The keystream is generated into a buffer of RANDOM_PROVIDER_CHACHA20_BUFFER_SIZE bytes, which is sliced into random integers and byte strings.
+	After each refill, the first RANDOM_PROVIDER_CHACHA20_KEY_SIZE bytes of the buffer replace the key and every byte is erased once it has been handed out
+	(fast key erasure), so a compromised state does not reveal any of the previous outputs.
+
+	The key is a full-width, 256 bit seed read from the operating system entropy source. The keystream is generated 8 blocks at a time with AVX2 when the CPU supports it.
+	Requests larger than the buffer are written directly into the output.
+	*/
+	class RandomProviderChaCha20 {
+	public:
+		/// The generator state: key, block counter and keystream buffer
+		struct State {
+			/// The ChaCha20 key
+			uint32_t key[RANDOM_PROVIDER_CHACHA20_KEY_SIZE / 4];
+
+			/// The index of the next keystream block
+			uint64_t counter;
+
+			/// The position of the first unused byte in buffer
+			size_t position;
+
+			/// The keystream buffer
+			unsigned char buffer[RANDOM_PROVIDER_CHACHA20_BUFFER_SIZE];
+		};
+
+		/// Generic alias required by RandomGeneratorBase to define the underlying random state member
+		typedef State RandomGeneratorState;
+
+		/// Initializes the underlying random state from input
+		static void Initialize (RandomProviderBase<RandomProviderChaCha20> &input);
+
+		/// Destroys the underlying data from input
+		static void Destroy (RandomProviderBase<RandomProviderChaCha20> &input);
+
+		/// Generates a random integer having at most numberOfBits bits
+		static void GetRandomInteger (BigInteger &output, RandomProviderBase<RandomProviderChaCha20> &input, const size_t numberOfBits);
+
+		/// Generates a random integer in the interval @f$ [0, maximumValue) @f$
+		static void GetRandomInteger (BigInteger &output, RandomProviderBase<RandomProviderChaCha20> &input, const BigInteger &maximumValue);
+
+		/// Generates a random prime, guaranteed to have numberOfBits length
+		static void GetMaxLengthRandomPrime (BigInteger &output, RandomProviderBase<RandomProviderChaCha20> &input, const size_t numberOfBits);
+
+		/// Fills output with random bytes
+		static void GetRandomBytes (unsigned char *output, RandomProviderBase<RandomProviderChaCha20> &input, const size_t byteCount);
+
+		/// Checks if the AVX2 keystream generator can be used on the current CPU
+		static bool IsAvx2Available ();
+
+		/// Portable implementation of generateBlocks
+		static void GenerateBlocksPortable (unsigned char *output, const uint32_t *key, const uint64_t counter, const size_t blockCount);
+
+		/// AVX2 implementation of generateBlocks (blockCount must be a multiple of 8)
+		static void GenerateBlocksAvx2 (unsigned char *output, const uint32_t *key, const uint64_t counter, const size_t blockCount);
+
+	private:
+		/// Refills the keystream buffer and replaces the key
+		static void refill (State &state);
+
+		/// Generates blockCount keystream blocks, starting with block counter
+		static void generateBlocks (unsigned char *output, const uint32_t *key, const uint64_t counter, const size_t blockCount);
+	};
+}//namespace Core
+}//namespace SeComLib
+
+#endif//RANDOM_PROVIDER_CHACHA20_HEADER_GUARD
\ No newline at end of file
@@ -31,44 +31,54 @@ limitations under the License.
 namespace SeComLib {
 namespace Core {
 	/**
-	Obtains a truly random seed via platform dependent means.
+	Obtains a truly random seed of RANDOM_PROVIDER_SEED_SIZE bytes via platform dependent means.
 
 	DO NOT use a function such as time(NULL) to generate it, because it does not provide a secure random seed (among other issues).
+	Every instance (one per thread) reads its own seed, so the generator states of different threads are independent.
 
 	Initializes the internal GMP random generator state via gmp_randinit_default.
 
-	Seeds the random generator state with the random seed via gmp_randseed_ui.
+	Seeds the random generator state with the random seed via gmp_randseed.
 
 	@param input uninitialized RandomProvider
 	@throws std::runtime_error error encountered while trying to read the random seed
 	*/
 	void RandomProviderGmp::Initialize (RandomProviderBase<RandomProviderGmp> &input) {
-		input.randomSeed = 0;
+		unsigned char seedBytes[RANDOM_PROVIDER_SEED_SIZE];
 
 	#if _WIN32
-		if (0 != rand_s(&input.randomSeed)) {
-			throw std::runtime_error("Error calling rand_s.");
+		for (size_t i = 0; i < RANDOM_PROVIDER_SEED_SIZE; i += sizeof(unsigned int)) {
+			unsigned int value;
+			if (0 != rand_s(&value)) {
+				throw std::runtime_error("Error calling rand_s.");
+			}
+			std::memcpy(seedBytes + i, &value, std::min(sizeof(unsigned int), RANDOM_PROVIDER_SEED_SIZE - i));
 		}
 
 	#else
 		std::ifstream randomGeneratorFile("/dev/urandom", std::ios::binary);
 
 		if (randomGeneratorFile.is_open()) {
-			randomGeneratorFile.read((char *)&input.randomSeed, sizeof(input.randomSeed));
+			randomGeneratorFile.read(reinterpret_cast<char *>(seedBytes), RANDOM_PROVIDER_SEED_SIZE);
 			randomGeneratorFile.close();
-			//std::cout << this->randomSeed;
 		}
 		else {
 			throw std::runtime_error("Error opening /dev/urandom.");
 		}
+
+		if (!randomGeneratorFile) {
+			throw std::runtime_error("Error reading from /dev/urandom.");
+		}
 	#endif
 
 		gmp_randinit_default(input.randomGeneratorState);
 
-		//initialize the random generator state
-		//should seed be generated as unsigned long instead of unsigned int?
-		//should use gmp_randseed instead? (with mpz_t seed)
-		gmp_randseed_ui(input.randomGeneratorState, static_cast<unsigned long>(input.randomSeed));
+		//initialize the random generator state with the whole seed
+		mpz_t seed;
+		mpz_init(seed);
+		mpz_import(seed, RANDOM_PROVIDER_SEED_SIZE, 1, 1, 0, 0, seedBytes);
+		gmp_randseed(input.randomGeneratorState, seed);
+		mpz_clear(seed);
 	}
 
 	/**
@@ -162,5 +172,18 @@ namespace Core {
 	#endif//end disabled code block
 	}
 
+	/**
+	@param output receives byteCount random bytes
+	@param randomProvider initialized RandomProvider
+	@param byteCount the number of bytes
+	*/
+	void RandomProviderGmp::GetRandomBytes(unsigned char *output, RandomProviderBase<RandomProviderGmp> &randomProvider, const size_t byteCount) {
+		BigIntegerBase<BigIntegerGmp> value;
+		mpz_urandomb(value.data, randomProvider.randomGeneratorState, static_cast<mp_bitcnt_t>(8 * byteCount));
+
+		//Export pads the value with zeros up to byteCount bytes
+		value.Export(output, byteCount);
+	}
+
 }//namespace Core
 }//namespace SeComLib
\ No newline at end of file
@@ -38,12 +38,19 @@ limitations under the License.
 #include "random_provider_base.h"
 
 //include C++ headers
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include <stdexcept>
 
 namespace SeComLib {
 namespace Core {
+	/**
+	@brief The size (in bytes) of the seed read from the operating system entropy source for each random generator state.
+	*/
+	#define RANDOM_PROVIDER_SEED_SIZE 32
+
 	/**
 	@brief Wrapper for the required GMP library random number specific functions.
 	*/
@@ -66,6 +73,9 @@ namespace Core {
 
 		/// Generates a random prime, guaranteed to have numberOfBits length
 		static void GetMaxLengthRandomPrime(BigIntegerBase<BigIntegerGmp> &output, RandomProviderBase<RandomProviderGmp> &input, const size_t numberOfBits);
+
+		/// Fills output with random bytes
+		static void GetRandomBytes(unsigned char *output, RandomProviderBase<RandomProviderGmp> &input, const size_t byteCount);
 	};
 }//namespace Core
 }//namespace SeComLib
@@ -42,5 +42,26 @@ namespace Core {
 	*/
 	RandomizerBase::RandomizerBase (const BigInteger &data) : data(data) {
 	}
+
+	/**
+	Takes over the data
+	@param data the randomizer data
+	*/
+	RandomizerBase::RandomizerBase (BigInteger &&data) : data(std::move(data)) {
+	}
+
+	/**
+	@param record the record which receives the data
+	*/
+	void RandomizerBase::Serialize (PrecomputationStore::RecordWriter &record) const {
+		record.Write(this->data);
+	}
+
+	/**
+	@param record the precomputed record
+	*/
+	void RandomizerBase::Deserialize (PrecomputationStore::RecordReader &record) {
+		this->data = record.ReadBigInteger();
+	}
 }//namespace Core
 }//namespace SeComLib
\ No newline at end of file
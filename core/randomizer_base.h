@@ -30,6 +30,7 @@ limitations under the License.
 #define RANDOMIZER_BASE_HEADER_GUARD
 
 #include "big_integer.h"
+#include "precomputation_store.h"
 
 namespace SeComLib {
 namespace Core {
@@ -46,6 +47,15 @@ namespace Core {
 
 		/// Constructor with initialization
 		RandomizerBase (const BigInteger &data);
+
+		/// Constructor with initialization (takes over the input)
+		RandomizerBase (BigInteger &&data);
+
+		/// Serializes the data into a precomputed record
+		void Serialize (PrecomputationStore::RecordWriter &record) const;
+
+		/// Loads the data from a precomputed record
+		void Deserialize (PrecomputationStore::RecordReader &record);
 	};
 }//namespace Core
 }//namespace SeComLib
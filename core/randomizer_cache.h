@@ -32,38 +32,106 @@ limitations under the License.
 //include our headers
 #include "utils/config.h"
 #include "big_integer.h"
+#include "precomputation_store.h"
 
 //include C++ libraries
+#include <memory>
 #include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <exception>
 
 namespace SeComLib {
 namespace Core {
 	/**
 	@brief Randomizer cache
-		
-	This should be associated with a background thread that fills the cache once only a few unused items remain and a call to Pop should actually remove an element from the internal vector, but, for now,
-	we pre-generate a constant quantity of random numbers and reuse them once they are depleted.
+
+	The randomizers are kept in a bounded lock-free ring buffer (multi-producer, multi-consumer). Each call to Pop removes one element, so randomizers are never reused.
+
+	If RandomizerCacheParameters::producerThreadCount is not 0, background threads refill the buffer: they fill it up to its capacity and then sleep until
+	the number of remaining elements drops to the low-water mark. When the buffer is empty, Pop either waits for a producer or generates the element inline,
+	depending on RandomizerCacheParameters::blockWhenEmpty. Without producer threads, the buffer is filled by the constructor and the elements requested
+	after it is depleted are generated inline.
+
+	If RandomizerCacheParameters::storeDirectory is set and it contains the precomputation store of the crypto provider public key and the cache parameters
+	(see Precompute), the elements are loaded from the store until it is exhausted, and only then generated. T_Container must provide
+	the deserialization constructor, Serialize and GetStoreKey.
+
+	The producer threads use the crypto provider concurrently with its owner, so the cache must be destroyed before the crypto provider members it relies on
+	(the crypto providers reset their cache in the destructor and before generating new keys).
+
+	Reserve sizes the buffer for a known workload (see PrecomputationPlan): it generates the missing elements in parallel and stops the producer threads.
 
 	@tparam T_Container A struct container for the randomizers
 	*/
 	template <typename T_Container>
 	class RandomizerCache {
 	public:
+		/// Snapshot of the cache state and counters
+		struct Metrics {
+			/// The number of elements in the buffer
+			size_t depth;
+
+			/// The capacity of the buffer
+			size_t capacity;
+
+			/// The number of elements generated by the producer threads (or by the constructor)
+			unsigned long long produced;
+
+			/// The number of elements extracted from the buffer
+			unsigned long long consumed;
+
+			/// The number of calls to Pop which found the buffer empty
+			unsigned long long stalls;
+
+			/// The number of elements generated inline by Pop
+			unsigned long long inlineGenerated;
+
+			/// The number of elements loaded from the precomputation store (instead of being generated)
+			unsigned long long loaded;
+
+			/// The number of elements generated per second by the producer threads, while they were working
+			double refillRate;
+		};
+
 		/// Constructor
 		RandomizerCache (const typename T_Container::CryptoProvider &cryptoProvider, const std::string &configurationPath);
 
 		/// Constructor
 		RandomizerCache (const typename T_Container::CryptoProvider &cryptoProvider, const typename T_Container::Parameters &parameters);
 
-		/// Destructor - void implementation
-		~RandomizerCache () {}
+		/// Destructor
+		~RandomizerCache ();
 
 		/// Extracts one element
-		const T_Container &Pop ();
+		T_Container Pop ();
+
+		/// Returns the number of elements in the buffer
+		size_t GetDepth () const;
+
+		/// Returns the cache metrics
+		Metrics GetMetrics () const;
+
+		/// Fills the buffer with count elements, using threadCount threads
+		void Reserve (const size_t count, const size_t threadCount);
+
+		/// Appends precomputed elements to the store of the crypto provider public key and the cache parameters
+		static void Precompute (const typename T_Container::CryptoProvider &cryptoProvider, const typename T_Container::Parameters &parameters, const size_t count);
 
 	private:
-		/// Internal cache vector
-		std::vector<T_Container> cache;
+		/// Ring buffer slot
+		struct Slot {
+			/// Sequence number, which tells producers and consumers the round in which the slot can be used
+			std::atomic<size_t> sequence;
+
+			/// The stored element
+			std::unique_ptr<T_Container> element;
+		};
 
 		/// Reference to the crypto provider
 		const typename T_Container::CryptoProvider &cryptoProvider;
@@ -71,12 +139,90 @@ namespace Core {
 		/// Parameters required to build the cache
 		const typename T_Container::Parameters parameters;
 
-		/// The index of the next element that will be retrieved
-		size_t index;
+		/// The capacity of the ring buffer (RandomizerCacheParameters::capacity, unless Reserve required more elements)
+		size_t capacity;
+
+		/// The ring buffer
+		std::unique_ptr<Slot[]> slots;
+
+		/// The precomputation store (NULL if it is not used)
+		std::unique_ptr<PrecomputationStore> store;
+
+		/// The position of the next element which will be stored
+		std::atomic<size_t> enqueuePosition;
+
+		/// The position of the next element which will be extracted
+		std::atomic<size_t> dequeuePosition;
 
-		/// Populates the cache
+		/// The buffer depth at which the producer threads are woken up
+		size_t lowWaterCount;
+
+		/// The producer threads
+		std::vector<std::thread> producers;
+
+		/// Flag which stops the producer threads
+		std::atomic<bool> stopping;
+
+		/// Flag set when a producer thread fails to generate an element
+		std::atomic<bool> producerFailed;
+
+		/// Mutex associated with the condition variables
+		std::mutex mutex;
+
+		/// Condition variable on which the producer threads sleep while the buffer is above the low-water mark
+		std::condition_variable producerCondition;
+
+		/// Condition variable on which Pop waits while the buffer is empty
+		std::condition_variable consumerCondition;
+
+		/// The number of sleeping producer threads
+		std::atomic<size_t> sleepingProducers;
+
+		/// The number of waiting consumers
+		std::atomic<size_t> waitingConsumers;
+
+		/// Metrics::produced
+		std::atomic<unsigned long long> produced;
+
+		/// Metrics::consumed
+		std::atomic<unsigned long long> consumed;
+
+		/// Metrics::stalls
+		std::atomic<unsigned long long> stalls;
+
+		/// Metrics::inlineGenerated
+		std::atomic<unsigned long long> inlineGenerated;
+
+		/// Metrics::loaded
+		std::atomic<unsigned long long> loaded;
+
+		/// The time (in nanoseconds) spent by the producer threads generating elements
+		std::atomic<unsigned long long> productionTime;
+
+		/// Allocates the buffer and fills it or starts the producer threads
 		void initialize ();
 
+		/// Loads the next element from the precomputation store or generates it
+		std::unique_ptr<T_Container> createElement ();
+
+		/// Allocates an empty buffer
+		void allocate (const size_t capacity);
+
+		/// Stores an element in the buffer
+		bool tryPush (std::unique_ptr<T_Container> &element);
+
+		/// Extracts an element from the buffer
+		bool tryPop (std::unique_ptr<T_Container> &element);
+
+		/// Producer thread procedure
+		void produce ();
+
+		/// Wakes up the sleeping producer threads
+		void wakeProducers ();
+
+		/// Stops and joins the producer threads
+		void stopProducers ();
+
 		/// Copy constructor - not implemented
 		RandomizerCache (const RandomizerCache &);
 
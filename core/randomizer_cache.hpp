@@ -42,7 +42,20 @@ namespace Core {
 	RandomizerCache<T_Container>::RandomizerCache (const typename T_Container::CryptoProvider &cryptoProvider, const std::string &configurationPath) :
 		cryptoProvider(cryptoProvider),
 		parameters(configurationPath),
-		index(0) {
+		capacity(0),
+		enqueuePosition(0),
+		dequeuePosition(0),
+		lowWaterCount(0),
+		stopping(false),
+		producerFailed(false),
+		sleepingProducers(0),
+		waitingConsumers(0),
+		produced(0),
+		consumed(0),
+		stalls(0),
+		inlineGenerated(0),
+		loaded(0),
+		productionTime(0) {
 		this->initialize();
 	}
 
@@ -56,36 +69,458 @@ namespace Core {
 	RandomizerCache<T_Container>::RandomizerCache (const typename T_Container::CryptoProvider &cryptoProvider, const typename T_Container::Parameters &parameters) :
 		cryptoProvider(cryptoProvider),
 		parameters(parameters),
-		index(0) {
+		capacity(0),
+		enqueuePosition(0),
+		dequeuePosition(0),
+		lowWaterCount(0),
+		stopping(false),
+		producerFailed(false),
+		sleepingProducers(0),
+		waitingConsumers(0),
+		produced(0),
+		consumed(0),
+		stalls(0),
+		inlineGenerated(0),
+		loaded(0),
+		productionTime(0) {
 		this->initialize();
 	}
 
 	/**
-	This implementation reuses cache items once all of them are depleted.
+	Stops the producer threads.
+	*/
+	template <typename T_Container>
+	RandomizerCache<T_Container>::~RandomizerCache () {
+		this->stopProducers();
+	}
+
+	/**
+	The element is moved out of the buffer, so each randomizer is used only once. Safe to call from multiple threads.
 
-	@return A reference to a T_Container.
+	@return A T_Container.
 	*/
 	template <typename T_Container>
-	const T_Container &RandomizerCache<T_Container>::Pop () {
-		size_t currentIndex = this->index;
-		
-		++this->index;
-		//wrap the index around once the cache is exhausted
-		this->index %= this->parameters.capacity;
+	T_Container RandomizerCache<T_Container>::Pop () {
+		std::unique_ptr<T_Container> element;
+
+		if (this->tryPop(element)) {
+			++this->consumed;
+
+			//only take the lock if some producer needs to be woken up
+			if (this->sleepingProducers > 0 && this->GetDepth() <= this->lowWaterCount) {
+				this->wakeProducers();
+			}
+
+			return std::move(*element);
+		}
+
+		++this->stalls;
 
-		return this->cache[currentIndex];
+		if (!this->producers.empty() && this->parameters.blockWhenEmpty) {
+			this->wakeProducers();
+
+			std::unique_lock<std::mutex> lock(this->mutex);
+			++this->waitingConsumers;
+			//the timeout covers the notifications sent between the failed tryPop and the wait
+			while (!this->producerFailed && !this->tryPop(element)) {
+				this->consumerCondition.wait_for(lock, std::chrono::milliseconds(1));
+			}
+			--this->waitingConsumers;
+			lock.unlock();
+
+			if (element) {
+				++this->consumed;
+
+				return std::move(*element);
+			}
+		}
+
+		//no producer threads, blocking disabled or the producers failed (in which case the exception is reproduced here, in the calling thread)
+		++this->inlineGenerated;
+
+		return std::move(*this->createElement());
 	}
 
 	/**
-	Reserves space for the required amount of items and fills the cache.
+	The value is approximate while other threads access the cache.
+
+	@return The number of elements in the buffer.
+	*/
+	template <typename T_Container>
+	size_t RandomizerCache<T_Container>::GetDepth () const {
+		//read the dequeue position first, so that it can't overtake the enqueue position
+		size_t dequeued = this->dequeuePosition;
+		size_t enqueued = this->enqueuePosition;
+
+		return enqueued - dequeued;
+	}
+
+	/**
+	@return A snapshot of the cache metrics.
+	*/
+	template <typename T_Container>
+	typename RandomizerCache<T_Container>::Metrics RandomizerCache<T_Container>::GetMetrics () const {
+		Metrics metrics;
+
+		metrics.depth = this->GetDepth();
+		metrics.capacity = this->capacity;
+		metrics.produced = this->produced;
+		metrics.consumed = this->consumed;
+		metrics.stalls = this->stalls;
+		metrics.inlineGenerated = this->inlineGenerated;
+		metrics.loaded = this->loaded;
+
+		unsigned long long productionTime = this->productionTime;
+		metrics.refillRate = productionTime == 0 ? 0 : static_cast<double>(metrics.produced) * 1e9 / static_cast<double>(productionTime);
+
+		return metrics;
+	}
+
+	/**
+	Meant for an offline phase which precomputes the elements consumed by a known workload: the buffer grows to count elements, if required,
+	and the missing elements are generated by threadCount threads (loaded from the precomputation store, if available).
+	The producer threads are stopped, so the cache no longer refills itself: the elements requested after the reserved ones are generated inline.
+	Must not be called concurrently with Pop.
+
+	@param count the number of elements which the buffer must contain
+	@param threadCount the number of threads which generate the elements (0 uses one thread for each hardware thread)
+	@throws std::exception any exception thrown while generating the elements
+	*/
+	template <typename T_Container>
+	void RandomizerCache<T_Container>::Reserve (const size_t count, const size_t threadCount) {
+		this->stopProducers();
+
+		if (count > this->capacity) {
+			//move the remaining elements to a larger buffer
+			std::vector<std::unique_ptr<T_Container>> elements;
+			std::unique_ptr<T_Container> element;
+			while (this->tryPop(element)) {
+				elements.push_back(std::move(element));
+			}
+
+			this->allocate(count);
+
+			for (typename std::vector<std::unique_ptr<T_Container>>::iterator iterator = elements.begin(); iterator != elements.end(); ++iterator) {
+				this->tryPush(*iterator);
+			}
+		}
+
+		size_t depth = this->GetDepth();
+		if (depth >= count) {
+			return;
+		}
+
+		size_t missing = count - depth;
+		size_t workerCount = threadCount > 0 ? threadCount : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+		workerCount = std::min(workerCount, missing);
+
+		std::atomic<size_t> next(0);
+		std::mutex exceptionMutex;
+		std::exception_ptr exception;
+
+		std::function<void ()> work = [this, missing, &next, &exceptionMutex, &exception] () {
+			try {
+				while (next++ < missing) {
+					std::unique_ptr<T_Container> element = this->createElement();
+					this->tryPush(element);
+					++this->produced;
+				}
+			}
+			catch (...) {
+				std::lock_guard<std::mutex> lock(exceptionMutex);
+				if (!exception) {
+					exception = std::current_exception();
+				}
+				//stop the other workers
+				next = missing;
+			}
+		};
+
+		//the calling thread is one of the workers
+		std::vector<std::thread> threads;
+		for (size_t i = 1; i < workerCount; ++i) {
+			threads.emplace_back(work);
+		}
+		work();
+		for (std::vector<std::thread>::iterator thread = threads.begin(); thread != threads.end(); ++thread) {
+			thread->join();
+		}
+
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+	}
+
+	/**
+	Meant for an offline precomputation phase: the elements are generated, serialized and appended (in chunks) to the store file
+	in parameters.storeDirectory. The caches created later for the same public key and parameters load them instead of generating them.
+
+	@param cryptoProvider the Crypto Provider
+	@param parameters configuration parameters
+	@param count the number of elements
+	@throws std::runtime_error parameters.storeDirectory is empty or the store can't be written
+	*/
+	template <typename T_Container>
+	void RandomizerCache<T_Container>::Precompute (const typename T_Container::CryptoProvider &cryptoProvider, const typename T_Container::Parameters &parameters, const size_t count) {
+		if (parameters.storeDirectory.empty()) {
+			throw std::runtime_error("The precomputation store directory is not set.");
+		}
+
+		std::string key = T_Container::GetStoreKey(cryptoProvider, parameters);
+		std::string path = PrecomputationStore::GetPath(parameters.storeDirectory, key);
+
+		//bound the memory used by the serialized records
+		const size_t chunkSize = 256;
+		std::vector<PrecomputationStore::RecordWriter> records;
+		for (size_t i = 0; i < count; i += chunkSize) {
+			records.assign(std::min(chunkSize, count - i), PrecomputationStore::RecordWriter());
+			for (size_t j = 0; j < records.size(); ++j) {
+				T_Container(cryptoProvider, parameters).Serialize(records[j]);
+			}
+
+			PrecomputationStore::Append(path, key, records);
+		}
+	}
+
+	/**
+	Without producer threads, the buffer is filled here. Otherwise, the producer threads fill it in the background.
+
+	@throws std::runtime_error the low-water mark is larger than 100%
 	*/
 	template <typename T_Container>
 	void RandomizerCache<T_Container>::initialize () {
-		this->cache.reserve(this->parameters.capacity);
+		if (this->parameters.lowWaterMark > 100) {
+			throw std::runtime_error("The low-water mark must be a percentage of the cache capacity.");
+		}
+
+		size_t capacity = this->parameters.capacity;
+		this->allocate(capacity);
+
+		if (!this->parameters.storeDirectory.empty()) {
+			std::string key = T_Container::GetStoreKey(this->cryptoProvider, this->parameters);
+			std::string path = PrecomputationStore::GetPath(this->parameters.storeDirectory, key);
+
+			//there is nothing to load if no elements were precomputed for this key
+			if (PrecomputationStore::Exists(path)) {
+				this->store.reset(new PrecomputationStore(path, key));
+			}
+		}
+
+		//a cache without capacity generates every element inline
+		if (0 == capacity) {
+			return;
+		}
+
+		if (0 == this->parameters.producerThreadCount) {
+			for (size_t i = 0; i < capacity; ++i) {
+				std::unique_ptr<T_Container> element = this->createElement();
+				this->tryPush(element);
+			}
+			this->produced = capacity;
+
+			return;
+		}
+
+		try {
+			for (size_t i = 0; i < this->parameters.producerThreadCount; ++i) {
+				this->producers.emplace_back(&RandomizerCache<T_Container>::produce, this);
+			}
+		}
+		catch (...) {
+			//std::thread throws std::system_error if it can't start the thread
+			this->stopProducers();
+			throw;
+		}
+	}
+
+	/**
+	Discards the previous buffer. The producer threads must be stopped.
+
+	@param capacity the number of slots
+	*/
+	template <typename T_Container>
+	void RandomizerCache<T_Container>::allocate (const size_t capacity) {
+		this->capacity = capacity;
+		this->lowWaterCount = capacity * this->parameters.lowWaterMark / 100;
+
+		this->slots.reset(new Slot[capacity]);
+		for (size_t i = 0; i < capacity; ++i) {
+			this->slots[i].sequence = i;
+		}
+
+		this->enqueuePosition = 0;
+		this->dequeuePosition = 0;
+	}
+
+	/**
+	Thread safe.
+
+	@return A new element.
+	*/
+	template <typename T_Container>
+	std::unique_ptr<T_Container> RandomizerCache<T_Container>::createElement () {
+		if (this->store) {
+			PrecomputationStore::RecordReader record;
+
+			if (this->store->Pop(record)) {
+				++this->loaded;
+
+				return std::unique_ptr<T_Container>(new T_Container(this->cryptoProvider, this->parameters, record));
+			}
+		}
+
+		return std::unique_ptr<T_Container>(new T_Container(this->cryptoProvider, this->parameters));
+	}
+
+	/**
+	Bounded MPMC queue (D. Vyukov): a slot is free for position pos when its sequence number equals pos and holds an element when it equals pos + 1.
+
+	@param element the element (moved into the buffer on success)
+	@return false if the buffer is full, true otherwise
+	*/
+	template <typename T_Container>
+	bool RandomizerCache<T_Container>::tryPush (std::unique_ptr<T_Container> &element) {
+		size_t capacity = this->capacity;
+		size_t position = this->enqueuePosition.load(std::memory_order_relaxed);
+		Slot *slot;
+
+		while (true) {
+			if (0 == capacity) {
+				return false;
+			}
+
+			slot = &this->slots[position % capacity];
+			size_t sequence = slot->sequence.load(std::memory_order_acquire);
+
+			if (sequence == position) {
+				if (this->enqueuePosition.compare_exchange_weak(position, position + 1)) {
+					break;
+				}
+			}
+			//the slot still holds the element stored one round earlier
+			else if (sequence < position) {
+				return false;
+			}
+			else {
+				position = this->enqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+
+		slot->element = std::move(element);
+		slot->sequence.store(position + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	/**
+	@param element receives the element on success
+	@return false if the buffer is empty, true otherwise
+	*/
+	template <typename T_Container>
+	bool RandomizerCache<T_Container>::tryPop (std::unique_ptr<T_Container> &element) {
+		size_t capacity = this->capacity;
+		size_t position = this->dequeuePosition.load(std::memory_order_relaxed);
+		Slot *slot;
+
+		while (true) {
+			if (0 == capacity) {
+				return false;
+			}
+
+			slot = &this->slots[position % capacity];
+			size_t sequence = slot->sequence.load(std::memory_order_acquire);
+
+			if (sequence == position + 1) {
+				if (this->dequeuePosition.compare_exchange_weak(position, position + 1)) {
+					break;
+				}
+			}
+			//the element for this position has not been stored yet
+			else if (sequence < position + 1) {
+				return false;
+			}
+			else {
+				position = this->dequeuePosition.load(std::memory_order_relaxed);
+			}
+		}
+
+		element = std::move(slot->element);
+		//release the slot for the next round
+		slot->sequence.store(position + capacity, std::memory_order_release);
+
+		return true;
+	}
+
+	/**
+	Generates elements until the buffer is full, then sleeps until its depth drops to the low-water mark.
+	If the element generation throws, the thread exits and Pop falls back to inline generation.
+	*/
+	template <typename T_Container>
+	void RandomizerCache<T_Container>::produce () {
+		std::unique_ptr<T_Container> element;
+
+		while (!this->stopping) {
+			if (!element) {
+				std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+				try {
+					element = this->createElement();
+				}
+				catch (...) {
+					this->producerFailed = true;
+
+					std::lock_guard<std::mutex> lock(this->mutex);
+					this->consumerCondition.notify_all();
+
+					return;
+				}
+
+				this->productionTime += static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+			}
+
+			if (this->tryPush(element)) {
+				++this->produced;
+
+				if (this->waitingConsumers > 0) {
+					std::lock_guard<std::mutex> lock(this->mutex);
+					this->consumerCondition.notify_one();
+				}
+
+				continue;
+			}
+
+			//the buffer is full; the element is kept until a slot is released
+			std::unique_lock<std::mutex> lock(this->mutex);
+			++this->sleepingProducers;
+			this->producerCondition.wait(lock, [this] () { return this->stopping || this->GetDepth() <= this->lowWaterCount; });
+			--this->sleepingProducers;
+		}
+	}
+
+	/**
+	Takes the mutex before notifying, so that a producer which is about to wait can't miss the notification.
+	*/
+	template <typename T_Container>
+	void RandomizerCache<T_Container>::wakeProducers () {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->producerCondition.notify_all();
+	}
+
+	/**
+	Signals the producer threads to stop and joins them (they finish the element they are generating first).
+	*/
+	template <typename T_Container>
+	void RandomizerCache<T_Container>::stopProducers () {
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->stopping = true;
+			this->producerCondition.notify_all();
+		}
 
-		for (size_t i = 0; i < this->parameters.capacity; ++i) {
-			this->cache.emplace_back(T_Container(this->cryptoProvider, this->parameters));
+		for (std::vector<std::thread>::iterator producer = this->producers.begin(); producer != this->producers.end(); ++producer) {
+			producer->join();
 		}
+		this->producers.clear();
 	}
 }//namespace Core
 }//namespace SeComLib
@@ -31,12 +31,17 @@ limitations under the License.
 namespace SeComLib {
 namespace Core {
 	/**
-	Populates the internal members from the configuration file.
+	Populates the internal members from the configuration file. Only the capacity is mandatory; by default, there are no producer threads,
+	the low-water mark is 50%, Pop blocks when the cache is empty and no precomputation store is used.
 
 	@param configurationPath the configuration path for parameters
 	*/
 	RandomizerCacheParameters::RandomizerCacheParameters (const std::string &configurationPath) :
-		capacity(Utils::Config::GetInstance().GetParameter<size_t>(configurationPath + ".capacity")) {
+		capacity(Utils::Config::GetInstance().GetParameter<size_t>(configurationPath + ".capacity")),
+		producerThreadCount(Utils::Config::GetInstance().GetParameter<size_t>(configurationPath + ".producerThreadCount", 0)),
+		lowWaterMark(Utils::Config::GetInstance().GetParameter<size_t>(configurationPath + ".lowWaterMark", 50)),
+		blockWhenEmpty(Utils::Config::GetInstance().GetParameter<bool>(configurationPath + ".blockWhenEmpty", true)),
+		storeDirectory(Utils::Config::GetInstance().GetParameter<std::string>(configurationPath + ".storeDirectory", "")) {
 	}
 }//namespace Core
 }//namespace SeComLib
\ No newline at end of file
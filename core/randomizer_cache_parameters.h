@@ -42,6 +42,18 @@ namespace Core {
 		/// The capacity of the cache
 		size_t capacity;
 
+		/// The number of background threads which refill the cache (0 fills it once, in the constructor)
+		size_t producerThreadCount;
+
+		/// The depth (percentage of the capacity) at which the producer threads resume refilling the cache
+		size_t lowWaterMark;
+
+		/// Flag indicating whether RandomizerCache::Pop waits for the producer threads when the cache is empty (otherwise it generates the element inline)
+		bool blockWhenEmpty;
+
+		/// The directory of the precomputation stores (empty if the cache doesn't use them)
+		std::string storeDirectory;
+
 		/// Default constructor - void implementation
 		//RandomizerCacheParameters () {}
 
@@ -32,6 +32,7 @@ limitations under the License.
 //include our headers
 #include "utils/config.h"
 #include "core/big_integer.h"
+#include "core/precomputation_store.h"
 
 namespace SeComLib {
 namespace Core {
@@ -55,6 +56,15 @@ namespace Core {
 
 		/// Constructor
 		RandomizerContainer (const T_CryptoProvider &cryptoProvider, const T_Parameters &parameters);
+
+		/// Constructor which loads the data from a precomputed record
+		RandomizerContainer (const T_CryptoProvider &cryptoProvider, const T_Parameters &parameters, PrecomputationStore::RecordReader &record);
+
+		/// Serializes the data into a precomputed record
+		void Serialize (PrecomputationStore::RecordWriter &record) const;
+
+		/// Returns the key of the precomputation store
+		static std::string GetStoreKey (const T_CryptoProvider &cryptoProvider, const T_Parameters &parameters);
 	};
 
 }//namespace Core
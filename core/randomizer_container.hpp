@@ -42,6 +42,37 @@ namespace Core {
 		randomizer(cryptoProvider.GetRandomizer()) {
 	}
 
+	/**
+	Loads the randomizer.
+
+	@param cryptoProvider unused parameter
+	@param parameters unused parameter
+	@param record the precomputed record
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	RandomizerContainer<T_CryptoProvider, T_Parameters>::RandomizerContainer (const T_CryptoProvider &/*cryptoProvider*/, const T_Parameters &/*parameters*/, PrecomputationStore::RecordReader &record) {
+		this->randomizer.Deserialize(record);
+	}
+
+	/**
+	@param record the record which receives the data
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	void RandomizerContainer<T_CryptoProvider, T_Parameters>::Serialize (PrecomputationStore::RecordWriter &record) const {
+		this->randomizer.Serialize(record);
+	}
+
+	/**
+	The randomizers only depend on the public key.
+
+	@param cryptoProvider the crypto provider
+	@param parameters unused parameter
+	@return The store key.
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	std::string RandomizerContainer<T_CryptoProvider, T_Parameters>::GetStoreKey (const T_CryptoProvider &cryptoProvider, const T_Parameters &/*parameters*/) {
+		return "RandomizerContainer;" + cryptoProvider.GetPublicKeyFingerprint();
+	}
 }//namespace Core
 }//namespace SeComLib
 
@@ -50,6 +50,48 @@ namespace Core {
 		this->encryptedMinusR1R2 = cryptoProvider.EncryptInteger(-this->r1 * this->r2);
 	}
 
+	/**
+	Loads @f$ r_1 @f$, @f$ r_2 @f$, @f$ [-r_1] @f$, @f$ [-r_2] @f$ and @f$ [-r_1 r_2] @f$.
+
+	@param cryptoProvider the crypto provider
+	@param parameters unused parameter
+	@param record the precomputed record
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	SecureMultiplicationBlindingFactorContainer<T_CryptoProvider, T_Parameters>::SecureMultiplicationBlindingFactorContainer (const T_CryptoProvider &cryptoProvider, const T_Parameters &/*parameters*/, PrecomputationStore::RecordReader &record) {
+		this->r1 = record.ReadBigInteger();
+		this->r2 = record.ReadBigInteger();
+		this->encryptedMinusR1 = record.ReadCiphertext(cryptoProvider);
+		this->encryptedMinusR2 = record.ReadCiphertext(cryptoProvider);
+		this->encryptedMinusR1R2 = record.ReadCiphertext(cryptoProvider);
+	}
+
+	/**
+	@param record the record which receives the data
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	void SecureMultiplicationBlindingFactorContainer<T_CryptoProvider, T_Parameters>::Serialize (PrecomputationStore::RecordWriter &record) const {
+		record.Write(this->r1);
+		record.Write(this->r2);
+		record.Write(this->encryptedMinusR1.data);
+		record.Write(this->encryptedMinusR2.data);
+		record.Write(this->encryptedMinusR1R2.data);
+	}
+
+	/**
+	The blinding factors depend on the public key, @f$ l @f$ and @f$ \kappa @f$.
+
+	@param cryptoProvider the crypto provider
+	@param parameters configuration parameters
+	@return The store key.
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	std::string SecureMultiplicationBlindingFactorContainer<T_CryptoProvider, T_Parameters>::GetStoreKey (const T_CryptoProvider &cryptoProvider, const T_Parameters &parameters) {
+		std::stringstream key;
+		key << "SecureMultiplicationBlindingFactorContainer;" << cryptoProvider.GetPublicKeyFingerprint() << ";l=" << parameters.l << ";kappa=" << parameters.kappa;
+
+		return key.str();
+	}
 }//namespace Core
 }//namespace SeComLib
 
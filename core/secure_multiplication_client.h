@@ -33,6 +33,7 @@ limitations under the License.
 #include "utils/config.h"
 #include "big_integer.h"
 #include "random_provider.h"
+#include "precomputation_plan.h"
 #include "secure_multiplication_server.h"
 
 namespace SeComLib {
@@ -57,6 +58,9 @@ namespace Core {
 		/// Computes the encrypted product
 		typename T_CryptoProvider::Ciphertext Multiply (const typename T_CryptoProvider::Ciphertext &lhs, const typename T_CryptoProvider::Ciphertext &rhs) const;
 
+		/// Adds the randomizers consumed by multiplicationCount multiplications to the plan
+		void PlanMultiplications (PrecomputationPlan &plan, const size_t multiplicationCount) const;
+
 		/// Setter for this->secureMultiplicationServer
 		void SetServer (const std::shared_ptr<SecureMultiplicationServer<T_CryptoProvider>> &secureMultiplicationServer);
 
@@ -52,6 +52,17 @@ namespace Core {
 		return this->cryptoProvider.EncryptInteger(a * b);
 	}
 
+	/**
+	Each multiplication encrypts the product.
+
+	@param plan the precomputation plan
+	@param multiplicationCount the number of calls to Multiply
+	*/
+	template <typename T_CryptoProvider>
+	void SecureMultiplicationClient<T_CryptoProvider>::PlanMultiplications (PrecomputationPlan &plan, const size_t multiplicationCount) const {
+		plan.AddRandomizers("Secure multiplication client randomizers", this->cryptoProvider, multiplicationCount);
+	}
+
 	/**
 	@param secureMultiplicationServer a SecureMultiplicationServer instance
 	*/
@@ -34,6 +34,7 @@ limitations under the License.
 #include "big_integer.h"
 #include "random_provider.h"
 #include "randomizer_cache.h"
+#include "precomputation_plan.h"
 #include "blinding_factor_cache_parameters.h"
 #include "secure_multiplication_blinding_factor_container.h"
 #include "secure_multiplication_client.h"
@@ -60,6 +61,9 @@ namespace Core {
 		/// Interactive secure multiplication
 		typename T_CryptoProvider::Ciphertext Multiply (const typename T_CryptoProvider::Ciphertext &lhs, const typename T_CryptoProvider::Ciphertext &rhs);
 
+		/// Adds the blinding factors consumed by multiplicationCount multiplications to the plan
+		void PlanMultiplications (PrecomputationPlan &plan, const size_t multiplicationCount);
+
 		/// Setter for this->secureMultiplicationClient
 		void SetClient (const std::shared_ptr<SecureMultiplicationClient<T_CryptoProvider>> &secureMultiplicationClient);
 
@@ -70,6 +70,17 @@ namespace Core {
 		return output;
 	}
 
+	/**
+	Each multiplication consumes one blinding factor container (the server does not randomize any ciphertexts).
+
+	@param plan the precomputation plan
+	@param multiplicationCount the number of calls to Multiply
+	*/
+	template <typename T_CryptoProvider>
+	void SecureMultiplicationServer<T_CryptoProvider>::PlanMultiplications (PrecomputationPlan &plan, const size_t multiplicationCount) {
+		plan.Add("Secure multiplication blinding factors", this->blindingFactorCache, multiplicationCount);
+	}
+
 	/**
 	@param secureMultiplicationClient a SecureMultiplicationClient instance
 	*/
@@ -0,0 +1,195 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/worker_pool.cpp
+@brief Implementation of class WorkerPool.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#include "worker_pool.h"
+
+namespace SeComLib {
+namespace Core {
+	thread_local bool WorkerPool::insideJob = false;
+
+	/**
+	@return A reference to the instance shared by the whole process
+	*/
+	WorkerPool &WorkerPool::GetInstance () {
+		static WorkerPool instance;
+
+		return instance;
+	}
+
+	/**
+	Reads Core.WorkerPool.threadCount and starts threadCount - 1 worker threads.
+	*/
+	WorkerPool::WorkerPool () : task(NULL), count(0), nextIndex(0), busyWorkers(0), freeSlots(0), generation(0), stopping(false) {
+		size_t threadCount = Utils::Config::GetInstance().GetParameter<size_t>("Core.WorkerPool.threadCount", 0);
+
+		if (0 == threadCount) {
+			threadCount = std::thread::hardware_concurrency();
+		}
+
+		for (size_t i = 1; i < threadCount; ++i) {
+			this->threads.push_back(std::thread(&WorkerPool::work, this));
+		}
+	}
+
+	/**
+	Waits for the worker threads to exit.
+	*/
+	WorkerPool::~WorkerPool () {
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->stopping = true;
+		}
+
+		this->jobAvailable.notify_all();
+
+		for (std::vector<std::thread>::iterator thread = this->threads.begin(); thread != this->threads.end(); ++thread) {
+			thread->join();
+		}
+	}
+
+	/**
+	@return The number of worker threads plus one
+	*/
+	size_t WorkerPool::GetThreadCount () const {
+		return this->threads.size() + 1;
+	}
+
+	/**
+	The calls are spread over the worker threads and the calling thread, in no particular order, so task must be safe to call concurrently
+	for different indexes (typically, each call writes only the element at index of a presized output vector).
+
+	@param count the number of indexes
+	@param task the function called for each index
+	@throws std::exception the first exception thrown by task (the indexes which were not started yet are skipped)
+	*/
+	void WorkerPool::ParallelFor (const size_t count, const std::function<void (const size_t index)> &task) {
+		//small jobs, nested jobs and jobs submitted while the pool is busy run on the calling thread
+		if (count < 2 || this->threads.empty() || WorkerPool::insideJob || !this->submitMutex.try_lock()) {
+			for (size_t i = 0; i < count; ++i) {
+				task(i);
+			}
+
+			return;
+		}
+
+		std::lock_guard<std::mutex> submitLock(this->submitMutex, std::adopt_lock);
+
+		//the calling thread processes one of the indexes
+		size_t helperCount = std::min(this->threads.size(), count - 1);
+
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+
+			this->task = &task;
+			this->count = count;
+			this->nextIndex = 0;
+			this->busyWorkers = helperCount;
+			this->freeSlots = helperCount;
+			this->exception = std::exception_ptr();
+			++this->generation;
+		}
+
+		if (helperCount == this->threads.size()) {
+			this->jobAvailable.notify_all();
+		}
+		else {
+			for (size_t i = 0; i < helperCount; ++i) {
+				this->jobAvailable.notify_one();
+			}
+		}
+
+		WorkerPool::insideJob = true;
+		this->runJob();
+		WorkerPool::insideJob = false;
+
+		std::exception_ptr exception;
+
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->jobFinished.wait(lock, [this] () { return 0 == this->busyWorkers; });
+
+			this->task = NULL;
+			std::swap(exception, this->exception);
+		}
+
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+	}
+
+	/**
+	A worker thread joins a job only if the job has free slots left (if it joins after the indexes are used up, it simply reports that it finished).
+	*/
+	void WorkerPool::work () {
+		WorkerPool::insideJob = true;
+		unsigned long long lastGeneration = 0;
+
+		while (true) {
+			{
+				std::unique_lock<std::mutex> lock(this->mutex);
+				this->jobAvailable.wait(lock, [this, &lastGeneration] () { return this->stopping || (this->generation != lastGeneration && this->freeSlots > 0); });
+
+				if (this->stopping) {
+					return;
+				}
+
+				lastGeneration = this->generation;
+				--this->freeSlots;
+			}
+
+			this->runJob();
+
+			std::lock_guard<std::mutex> lock(this->mutex);
+
+			if (0 == --this->busyWorkers) {
+				this->jobFinished.notify_one();
+			}
+		}
+	}
+
+	/**
+	After an exception, the remaining indexes are skipped.
+	*/
+	void WorkerPool::runJob () {
+		for (size_t index = this->nextIndex++; index < this->count; index = this->nextIndex++) {
+			try {
+				(*this->task)(index);
+			}
+			catch (...) {
+				std::lock_guard<std::mutex> lock(this->mutex);
+
+				if (!this->exception) {
+					this->exception = std::current_exception();
+				}
+
+				this->nextIndex = this->count;
+			}
+		}
+	}
+}//namespace Core
+}//namespace SeComLib
\ No newline at end of file
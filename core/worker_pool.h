@@ -0,0 +1,135 @@
+/*
+SeComLib
+Copyright 2012-2013 TU Delft, Information Security & Privacy Lab (http://isplab.tudelft.nl/)
+
+Contributors:
+Inald Lagendijk (R.L.Lagendijk@TUDelft.nl)
+Mihai Todor (todormihai@gmail.com)
+Thijs Veugen (P.J.M.Veugen@tudelft.nl)
+Zekeriya Erkin (z.erkin@tudelft.nl)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+/**
+@file core/worker_pool.h
+@brief Definition of class WorkerPool.
+@author Mihai Todor (todormihai@gmail.com)
+*/
+
+#ifndef WORKER_POOL_HEADER_GUARD
+#define WORKER_POOL_HEADER_GUARD
+
+//include our headers
+#include "utils/config.h"
+
+//include C++ headers
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SeComLib {
+namespace Core {
+	/**
+	@brief Process-wide pool of worker threads which runs the batch operations of the crypto providers
+
+	The threads are started once, on first use, and wait for jobs on a condition variable, so a job costs a wake-up instead of a thread creation.
+	ParallelFor hands out the indexes of a job one at a time (through an atomic counter), so the threads stay busy even when the items
+	take different amounts of time. The calling thread works on the job as well and returns once every index has been processed.
+	Only as many worker threads as the job can use are woken up (one for a job with two indexes), so short jobs are cheap to hand off.
+
+	Only one job runs at a time. A job submitted while the pool is busy (by another thread or from inside a running job) runs on the calling thread.
+
+	The number of worker threads is read from Core.WorkerPool.threadCount (0, the default, selects one thread for each hardware thread;
+	the calling thread counts as one of them, so 1 runs every job on the calling thread).
+	*/
+	class WorkerPool {
+	public:
+		/// Returns the instance shared by the whole process
+		static WorkerPool &GetInstance ();
+
+		/// Destructor - stops the worker threads
+		~WorkerPool ();
+
+		/// Returns the number of threads which run a job (including the calling thread)
+		size_t GetThreadCount () const;
+
+		/// Calls task(i) for every i in [0, count) and waits for all the calls to finish
+		void ParallelFor (const size_t count, const std::function<void (const size_t index)> &task);
+
+	private:
+		/// The worker threads
+		std::vector<std::thread> threads;
+
+		/// Guards the job state shared with the worker threads
+		std::mutex mutex;
+
+		/// Signaled when a new job is available or when the pool is stopped
+		std::condition_variable jobAvailable;
+
+		/// Signaled when the last worker thread finishes the current job
+		std::condition_variable jobFinished;
+
+		/// Held by the thread which submitted the current job
+		std::mutex submitMutex;
+
+		/// The current job
+		const std::function<void (const size_t index)> *task;
+
+		/// The number of indexes of the current job
+		size_t count;
+
+		/// The next index to be processed
+		std::atomic<size_t> nextIndex;
+
+		/// The number of worker threads which have not finished the current job yet
+		size_t busyWorkers;
+
+		/// The number of worker threads which may still join the current job
+		size_t freeSlots;
+
+		/// Incremented for every job (wakes up the worker threads)
+		unsigned long long generation;
+
+		/// Set by the destructor
+		bool stopping;
+
+		/// The first exception thrown by the current job
+		std::exception_ptr exception;
+
+		/// True on the worker threads and on a thread which is running a job
+		static thread_local bool insideJob;
+
+		/// Constructor - starts the worker threads
+		WorkerPool ();
+
+		/// The loop of a worker thread
+		void work ();
+
+		/// Processes indexes of the current job until there are none left
+		void runJob ();
+
+		/// Copy constructor - not implemented
+		WorkerPool (const WorkerPool &);
+
+		/// Copy assignment operator - not implemented
+		WorkerPool operator= (const WorkerPool &);
+	};
+}//namespace Core
+}//namespace SeComLib
+
+#endif//WORKER_POOL_HEADER_GUARD
\ No newline at end of file
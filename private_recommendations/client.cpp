@@ -84,12 +84,24 @@ namespace PrivateRecommendations {
 				continue;
 			}
 
-			std::vector<unsigned long> URSum;
+			std::vector<Paillier::Ciphertext> blindedURSum;
+			std::vector<BigInteger> URSumBlindingFactors;
+			blindedURSum.reserve(encryptedURSum.size());
+			URSumBlindingFactors.reserve(encryptedURSum.size());
 			for (ServiceProvider::EncryptedUserData::iterator encryptedURSumIterator = encryptedURSum.begin(); encryptedURSumIterator != encryptedURSum.end(); ++encryptedURSumIterator) {
 				const BlindingFactorContainer &URSumblindingFactor = this->blindingFactorCache.Pop();
 
-				/// @f$ UR_{sum}^i = Dec([UR_{sum}^i][r]) - r @f$
-				URSum.push_back((this->privacyServiceProvider->SecureDecryption(*encryptedURSumIterator + URSumblindingFactor.encryptedR) - URSumblindingFactor.r).ToUnsignedLong());
+				blindedURSum.emplace_back(*encryptedURSumIterator + URSumblindingFactor.encryptedR);
+				URSumBlindingFactors.emplace_back(URSumblindingFactor.r);
+			}
+
+			/// @f$ UR_{sum}^i = Dec([UR_{sum}^i][r]) - r @f$ (all the items are decrypted in one batch)
+			std::vector<BigInteger> blindedURSumValues = this->privacyServiceProvider->SecureDecryption(blindedURSum);
+
+			std::vector<unsigned long> URSum;
+			URSum.reserve(blindedURSumValues.size());
+			for (size_t i = 0; i < blindedURSumValues.size(); ++i) {
+				URSum.push_back((blindedURSumValues[i] - URSumBlindingFactors[i]).ToUnsignedLong());
 			}
 
 			/*
@@ -110,5 +122,23 @@ namespace PrivateRecommendations {
 		}
 	}
 
+	/**
+	Each processed user consumes one blinding factor for @f$ L @f$ and one for each of the @f$ M - R @f$ values of @f$ UR_{sum} @f$
+	(the latter are not used when @f$ L = 0 @f$).
+
+	@param plan the precomputation plan
+	*/
+	void Client::PlanPrecomputations (PrecomputationPlan &plan) {
+	#ifdef FIRST_USER_ONLY
+		size_t processedUserCount = 1;
+	#else
+		size_t processedUserCount = this->userCount;
+	#endif
+		size_t itemCount = Utils::Config::GetInstance().GetParameter<size_t>(configurationPath + ".itemCount");
+		size_t denselyRatedItemCount = Utils::Config::GetInstance().GetParameter<size_t>(configurationPath + ".denselyRatedItemCount");
+
+		plan.Add("Client decryption blinding factors", this->blindingFactorCache, processedUserCount * (1 + itemCount - denselyRatedItemCount));
+	}
+
 }//namespace PrivateRecommendations
 }//namespace SeComLib
\ No newline at end of file
@@ -35,6 +35,7 @@ limitations under the License.
 #include "core/paillier.h"
 #include "core/randomizer_cache.h"
 #include "core/blinding_factor_cache_parameters.h"
+#include "core/precomputation_plan.h"
 
 #include "private_recommendations_utils/decryption_blinding_factor_container.h"
 #include "service_provider.h"
@@ -69,6 +70,9 @@ namespace PrivateRecommendations {
 		/// Interact with the server(s) to extract the recommendations for every user
 		void ComputeRecommendations ();
 
+		/// Adds the blinding factors consumed by ComputeRecommendations to the plan
+		void PlanPrecomputations (PrecomputationPlan &plan);
+
 	private:
 		/// Alias for the blinding factor container
 		typedef DecryptionBlindingFactorContainer<Paillier, BlindingFactorCacheParameters> BlindingFactorContainer;
@@ -46,6 +46,9 @@ int main (int argc, char *argv[]) {
 			Utils::Config::SetConfigFile(std::string(argv[1]));
 		}
 
+		/// Install the GMP memory pool, if enabled (before any big integers are allocated)
+		Core::GmpMemoryPool::Initialize();
+
 		std::cout << Utils::DateTime::Now() << ": Starting simulation." << std::endl << std::endl;
 
 		/// Initialize the servers
@@ -59,6 +62,19 @@ int main (int argc, char *argv[]) {
 
 		std::cout << Utils::DateTime::Now() << ": Finished initializing servers." << std::endl << std::endl;
 
+		/// Precompute the randomizers and blinding factors of the whole simulation, if enabled (offline phase)
+		Core::PrecomputationPlan plan;
+		bool precompute = Utils::Config::GetInstance().GetParameter<bool>("Core.PrecomputationPlan.enabled", false);
+		if (precompute) {
+			serviceProvider->PlanPrecomputations(plan);
+			client.PlanPrecomputations(plan);
+			plan.Execute();
+
+			std::cout << Utils::DateTime::Now() << ": Finished the offline phase in " << Utils::CpuTimer::ToString(plan.GetOfflineTime()) << "." << std::endl << std::endl;
+		}
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
 		serviceProvider->GenerateDummyDatabase();
 
 		std::cout << Utils::DateTime::Now() << ": Finished encrypting client data." << std::endl << std::endl;
@@ -75,6 +91,11 @@ int main (int argc, char *argv[]) {
 		client.ComputeRecommendations();
 
 		std::cout << std::endl << Utils::DateTime::Now() << ": Finished simulation." << std::endl << std::endl;
+
+		if (precompute) {
+			std::cout << "Online phase: " << Utils::CpuTimer::ToString(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()) << std::endl;
+			plan.PrintReport(std::cout);
+		}
 	}
 	catch (const std::runtime_error &exception) {
 		std::cout << exception.what() << std::endl;
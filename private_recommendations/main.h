@@ -31,7 +31,10 @@ limitations under the License.
 
 //include our headers
 #include "utils/config.h"
+#include "core/gmp_memory_pool.h"
 #include "utils/date_time.h"
+#include "utils/cpu_timer.h"
+#include "core/precomputation_plan.h"
 #include "service_provider.h"
 #include "privacy_service_provider.h"
 #include "client.h"
@@ -39,6 +42,7 @@ limitations under the License.
 //include C++ headers
 #include <iostream>
 #include <stdexcept>
+#include <chrono>
 
 using namespace SeComLib;
 using namespace SeComLib::PrivateRecommendations;
@@ -59,6 +59,26 @@ namespace PrivateRecommendations {
 		return this->paillierCryptoProvider.DecryptInteger(input);
 	}
 
+	/**
+	The ciphertexts are decrypted in parallel, with Paillier::DecryptBatch.
+
+	@param input Paillier ciphertexts
+	@return the decrypted integers, in the same order as the input
+	*/
+	std::vector<BigInteger> PrivacyServiceProvider::SecureDecryption (const std::vector<Paillier::Ciphertext> &input) const {
+		return this->paillierCryptoProvider.DecryptBatch(input);
+	}
+
+	/**
+	@param plan the precomputation plan
+	@param multiplicationCount the number of secure multiplications
+	@param comparisonCount the number of secure comparisons
+	*/
+	void PrivacyServiceProvider::PlanPrecomputations (PrecomputationPlan &plan, const size_t multiplicationCount, const size_t comparisonCount) const {
+		this->secureMultiplicationClient->PlanMultiplications(plan, multiplicationCount);
+		this->secureComparisonClient->PlanComparisons(plan, comparisonCount);
+	}
+
 	/**
 	@param serviceProvider a ServiceProvider instance
 	*/
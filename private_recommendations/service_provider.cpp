@@ -263,6 +263,33 @@ namespace PrivateRecommendations {
 		}
 	}
 
+	/**
+	The Service Provider encrypts the @f$ M @f$ ratings of each user, computes @f$ R @f$ secure multiplications and one secure comparison for each similarity value
+	and @f$ M - R @f$ secure multiplications for each of the @f$ N - 1 @f$ other users of every processed user.
+	The Privacy Service Provider counterparts of the secure multiplications and comparisons are planned as well.
+
+	Must be called after SetPrivacyServiceProvider.
+
+	@param plan the precomputation plan
+	*/
+	void ServiceProvider::PlanPrecomputations (PrecomputationPlan &plan) {
+	#ifdef FIRST_USER_ONLY
+		size_t processedUserCount = 1;
+		size_t similarityValueCount = this->userCount - 1;
+	#else
+		size_t processedUserCount = this->userCount;
+		size_t similarityValueCount = this->userCount * (this->userCount - 1) / 2;
+	#endif
+		size_t multiplicationCount = similarityValueCount * this->denselyRatedItemCount + processedUserCount * (this->userCount - 1) * (this->itemCount - this->denselyRatedItemCount);
+
+		plan.AddRandomizers("Service Provider rating encryptions", this->paillierCryptoProvider, this->userCount * this->itemCount);
+
+		this->secureMultiplicationServer->PlanMultiplications(plan, multiplicationCount);
+		this->secureComparisonServer->PlanComparisons(plan, similarityValueCount);
+
+		this->privacyServiceProvider.lock()->PlanPrecomputations(plan, multiplicationCount, similarityValueCount);
+	}
+
 	/**
 	@param userId The index of the user
 	@return @f$ [L] @f$
@@ -38,6 +38,7 @@ limitations under the License.
 #include "core/paillier.h"
 #include "core/dgk.h"
 #include "core/secure_multiplication_server.h"
+#include "core/precomputation_plan.h"
 
 #include "private_recommendations_utils/secure_comparison_server.h"
 
@@ -87,6 +88,9 @@ namespace PrivateRecommendations {
 		/// Computes @f$ [\Gamma] @f$, @f$ [L] @f$ and @f$ [UR_{sum}] @f$ for each user
 		void ComputeUserRecommendations ();
 
+		/// Adds the randomizers and blinding factors consumed by GenerateDummyDatabase, ComputeSimilarityValues and ComputeUserRecommendations to the plan
+		void PlanPrecomputations (PrecomputationPlan &plan);
+
 		/// Returns the @f$ [L] @f$ value for the specified user
 		const Paillier::Ciphertext &GetEncryptedL (size_t userId) const;
 
@@ -255,6 +255,30 @@ namespace PrivateRecommendationsDataPacking {
 		}
 	}
 
+	/**
+	Each processed user consumes one blinding factor for @f$ L @f$ and one for each packed encryption of @f$ UR_{sum} @f$
+	(the latter are not used when @f$ L = 0 @f$ or @f$ L \geq \hat{L} @f$).
+	@f$ UR_{sum} @f$ has as many encryptions as the packed sparse ratings of the other users.
+
+	The ratings are encrypted by the constructor, before the plan can be executed, so their randomizers are not planned.
+
+	@param plan the precomputation plan
+	*/
+	void Client::PlanPrecomputations (PrecomputationPlan &plan) {
+	#ifdef FIRST_USER_ONLY
+		size_t processedUserCount = 1;
+	#else
+		size_t processedUserCount = this->userCount;
+	#endif
+		size_t URSumEncryptionCount = 0;
+		for (size_t user = 0; user < processedUserCount; ++user) {
+			URSumEncryptionCount += this->sparseRatings[user == 0 ? 1 : 0].size();
+		}
+
+		plan.Add("Client L decryption blinding factors", this->LdecryptionBlindingFactorCache, processedUserCount);
+		plan.Add("Client UR_sum decryption blinding factors", this->URSumDecryptionBlindingFactorCache, URSumEncryptionCount);
+	}
+
 	/**
 	@param L the number of similar users
 	@return the empty buckets
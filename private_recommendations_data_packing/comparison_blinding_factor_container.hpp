@@ -58,6 +58,53 @@ namespace PrivateRecommendationsDataPacking {
 			}
 		}
 	}
+
+	/**
+	Loads @f$ r @f$, @f$ [r] @f$ and @f$ r^{(i)} @f$.
+
+	@param cryptoProvider the crypto provider
+	@param parameters unused parameter
+	@param record the precomputed record
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	ComparisonBlindingFactorContainer<T_CryptoProvider, T_Parameters>::ComparisonBlindingFactorContainer (const T_CryptoProvider &cryptoProvider, const T_Parameters &/*parameters*/, PrecomputationStore::RecordReader &record) {
+		this->r = record.ReadBigInteger();
+		this->encryptedR = record.ReadCiphertext(cryptoProvider);
+
+		size_t count = static_cast<size_t>(record.ReadLong());
+		for (size_t i = 0; i < count; ++i) {
+			this->ri.emplace_back(record.ReadBigInteger());
+		}
+	}
+
+	/**
+	@param record the record which receives the data
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	void ComparisonBlindingFactorContainer<T_CryptoProvider, T_Parameters>::Serialize (PrecomputationStore::RecordWriter &record) const {
+		record.Write(this->r);
+		record.Write(this->encryptedR.data);
+
+		record.Write(static_cast<long>(this->ri.size()));
+		for (std::deque<BigInteger>::const_iterator ri = this->ri.begin(); ri != this->ri.end(); ++ri) {
+			record.Write(*ri);
+		}
+	}
+
+	/**
+	The blinding factors depend on the public key, @f$ l @f$, @f$ \kappa @f$ and the number of buckets.
+
+	@param cryptoProvider the crypto provider
+	@param parameters configuration parameters
+	@return The store key.
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	std::string ComparisonBlindingFactorContainer<T_CryptoProvider, T_Parameters>::GetStoreKey (const T_CryptoProvider &cryptoProvider, const T_Parameters &parameters) {
+		std::stringstream key;
+		key << "DataPackingComparisonBlindingFactorContainer;" << cryptoProvider.GetPublicKeyFingerprint() << ";l=" << parameters.l << ";kappa=" << parameters.kappa << ";buckets=" << parameters.emptyBuckets.size();
+
+		return key.str();
+	}
 }//namespace PrivateRecommendationsDataPacking
 }//namespace SeComLib
 
@@ -59,6 +59,16 @@ namespace PrivateRecommendationsDataPacking {
 		return this->paillierCryptoProvider.DecryptInteger(input);
 	}
 
+	/**
+	@param plan the precomputation plan
+	@param multiplicationCount the number of secure multiplications
+	@param comparisonCount the number of secure comparisons (one for each similarity value)
+	*/
+	void PrivacyServiceProvider::PlanPrecomputations (PrecomputationPlan &plan, const size_t multiplicationCount, const size_t comparisonCount) const {
+		this->secureMultiplicationClient->PlanMultiplications(plan, multiplicationCount);
+		this->secureComparisonClient->PlanComparisons(plan, comparisonCount);
+	}
+
 	/**
 	@param serviceProvider a ServiceProvider instance
 	*/
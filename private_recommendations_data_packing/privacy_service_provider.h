@@ -36,6 +36,7 @@ limitations under the License.
 #include "core/paillier.h"
 #include "core/dgk.h"
 #include "core/secure_multiplication_client.h"
+#include "core/precomputation_plan.h"
 
 #include "secure_comparison_client.h"
 
@@ -70,6 +71,9 @@ namespace PrivateRecommendationsDataPacking {
 		/// Decrypts a blinded Paillier ciphertext
 		BigInteger SecureDecryption (const Paillier::Ciphertext &input) const;
 
+		/// Adds the randomizers consumed by the secure multiplications and comparisons to the plan
+		void PlanPrecomputations (PrecomputationPlan &plan, const size_t multiplicationCount, const size_t comparisonCount) const;
+
 		/// Sets a reference to the Privacy Service Provider
 		void SetServiceProvider (const std::shared_ptr<const ServiceProvider> &serviceProvider);
 
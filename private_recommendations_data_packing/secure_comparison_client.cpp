@@ -78,6 +78,18 @@ namespace PrivateRecommendationsDataPacking {
 		this->dgkComparisonClient->SetZModTwoPowL(this->zi[i]);
 	}
 
+	/**
+	Unpacking @f$ [z] @f$ doesn't consume randomizers, so only the DGK comparisons of the @f$ l + 1 @f$ bit buckets are planned.
+
+	Must be called after SetServer.
+
+	@param plan the precomputation plan
+	@param comparisonCount the number of comparisons
+	*/
+	void SecureComparisonClient::PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount) const {
+		this->dgkComparisonClient->PlanComparisons(plan, comparisonCount, this->secureComparisonServer->GetDgkComparisonServer()->GetMSBPosition());
+	}
+
 	/**
 	@param secureComparisonServer a SecureComparisonServer instance
 	*/
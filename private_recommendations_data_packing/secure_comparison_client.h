@@ -35,6 +35,7 @@ limitations under the License.
 #include "core/random_provider.h"
 #include "core/paillier.h"
 #include "core/dgk.h"
+#include "core/precomputation_plan.h"
 
 #include "private_recommendations_utils/dgk_comparison_client.h"
 
@@ -66,6 +67,9 @@ namespace PrivateRecommendationsDataPacking {
 		/// Specifies which @f$ z^{(i)} @f$ to send to the dgkComparisonClient for the current comparison
 		void SetZi (const size_t i) const;
 
+		/// Adds the randomizers consumed by comparisonCount comparisons to the plan
+		void PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount) const;
+
 		/// Setter for this->secureComparisonServer
 		void SetServer (const std::shared_ptr<SecureComparisonServer> &secureComparisonServer);
 
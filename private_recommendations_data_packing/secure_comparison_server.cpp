@@ -104,6 +104,19 @@ namespace PrivateRecommendationsDataPacking {
 		return gammaVector;
 	}
 
+	/**
+	Each packed encryption consumes one blinding factor container and each similarity value it contains one DGK comparison (see DgkComparisonServer::ComputeDi).
+
+	@param plan the precomputation plan
+	@param encryptionCount the number of packed similarity value encryptions passed to Compare
+	@param comparisonCount the number of similarity values
+	*/
+	void SecureComparisonServer::PlanComparisons (PrecomputationPlan &plan, const size_t encryptionCount, const size_t comparisonCount) {
+		plan.Add("Secure comparison blinding factors", this->blindingFactorCache, encryptionCount);
+
+		this->dgkComparisonServer->PlanComparisons(plan, comparisonCount);
+	}
+
 	/**
 	@param index The index of the bucket
 	@return a reference to the requested empty bucket
@@ -36,6 +36,7 @@ limitations under the License.
 #include "core/paillier.h"
 #include "core/dgk.h"
 #include "core/randomizer_cache.h"
+#include "core/precomputation_plan.h"
 
 #include "comparison_blinding_factor_cache_parameters.h"
 #include "comparison_blinding_factor_container.h"
@@ -72,6 +73,9 @@ namespace PrivateRecommendationsDataPacking {
 		/// Interactive secure comparison
 		EncryptedUserData Compare (const PackedData &packedSimilarityValues, const size_t similarityValueCountInLastEncryption);
 
+		/// Adds the blinding factors and randomizers consumed by the comparisons of the packed similarity values to the plan
+		void PlanComparisons (PrecomputationPlan &plan, const size_t encryptionCount, const size_t comparisonCount);
+
 		/// Fetch an empty bucket for the given index
 		const BigInteger &GetEmptyBucket (const size_t index) const;
 
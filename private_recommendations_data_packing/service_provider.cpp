@@ -88,7 +88,12 @@ namespace PrivateRecommendationsDataPacking {
 
 		@f$ [V_{(user, j)}^{c}] = [\tilde{v}_{(0, j)}^d | \tilde{v}_{(1, j)}^d | ... | \tilde{v}_{(N - 2, j)}^d] = \left[\displaystyle\sum_{i=0, i \neq user}^{N - 2}{2 \tilde{v}_{(i, j)}^d (2^{2k + \lceil log_2(R) \rceil + 2})^i} \right] = \displaystyle\prod_{i=0, i \neq user}^{N - 2}{[\tilde{v}_{(i, j)}]^{2(2^{2k + \lceil log_2(R) \rceil + 2})^i}} @f$
 		*/
-		BigInteger two(2);
+		/// All empty buckets have one empty zero bit at the bottom and one at the top. We want to insert the normalizedScaledRatings in the middle of each bucket, which explains the shift by one
+		std::vector<BigInteger> bucketShifts;
+		for (size_t i = 0; i < this->maxPackedBuckets; ++i) {
+			bucketShifts.emplace_back(this->emptyBuckets[i] << 1);
+		}
+
 	#ifdef FIRST_USER_ONLY
 		std::cout << "Warning: running simulation for a single user." << std::endl << std::endl;
 		for (size_t user = 0; user < 1; ++user) {
@@ -103,46 +108,25 @@ namespace PrivateRecommendationsDataPacking {
 				/// @f$ [v_{(user, item)}^c] @f$
 				PackedData packedItems;
 				
-				Paillier::Ciphertext packedBuckets;
-				size_t bucketCount = 0;
+				//the values which go in the buckets of the current encryption
+				std::vector<Paillier::Ciphertext> bucketValues;
 				for (size_t i = 0; i < this->userCount; ++i) {
 					//sim(i, i) does not exist and sim(A, B) = sim(B, A), so we compute only sim(A, B) (the upper triangle of the matrix, without the diagonal)
 					if (i > user) {
-						/// All empty buckets have one empty zero bit at the bottom and one at the top. We want to insert the normalizedScaledRatings in the middle of each bucket, which explains the shift by one
-
-						//the encryption is empty, so we assign to it the next value
-						if (0 == bucketCount) {
-							/*
-							this->privacyServiceProvider.lock()->DebugPaillierEncryption(this->normalizedScaledRatings[i][item]);
-							std::cout << this->emptyBuckets[bucketCount].ToString() << std::endl << std::endl;
-							*/
-							packedBuckets = normalizedScaledRatings[i][item] * (this->emptyBuckets[bucketCount] << 1);
-							//this->privacyServiceProvider.lock()->DebugPaillierEncryption(packedBuckets);
-						}
-						//the encryption is not empty, so we add values to it using homomorphic addition
-						else {
-							/*
-							this->privacyServiceProvider.lock()->DebugPaillierEncryption(this->normalizedScaledRatings[i][item]);
-							std::cout << this->emptyBuckets[bucketCount].ToString() << std::endl << std::endl;
-							*/
-							packedBuckets = packedBuckets + normalizedScaledRatings[i][item] * (this->emptyBuckets[bucketCount] << 1);
-							//this->privacyServiceProvider.lock()->DebugPaillierEncryption(packedBuckets);
-						}
+						bucketValues.push_back(normalizedScaledRatings[i][item]);
 
-						//if all the buckets inside the encryption are full, persist the encryption and reset the bucket counter
-						if (bucketCount == this->maxPackedBuckets - 1) {
-							packedItems.emplace_back(packedBuckets);
-							bucketCount = 0;
-						}
-						else {
-							++bucketCount;
+						//if all the buckets inside the encryption are full, pack them with a single multi-exponentiation and persist the encryption
+						if (bucketValues.size() == this->maxPackedBuckets) {
+							packedItems.emplace_back(this->paillierCryptoProvider.HomomorphicDotProduct(bucketValues, bucketShifts));
+							//this->privacyServiceProvider.lock()->DebugPaillierEncryption(packedItems.back());
+							bucketValues.clear();
 						}
 					}
 				}
 
 				//store the last packed buckets for the current item
-				if (bucketCount > 0) {
-					packedItems.emplace_back(packedBuckets);
+				if (bucketValues.size() > 0) {
+					packedItems.emplace_back(this->paillierCryptoProvider.HomomorphicDotProduct(bucketValues, std::vector<BigInteger>(bucketShifts.begin(), bucketShifts.begin() + static_cast<std::ptrdiff_t>(bucketValues.size()))));
 				}
 
 				/// Store @f$ [v_{(user, item)}^c] @f$
@@ -261,6 +245,50 @@ namespace PrivateRecommendationsDataPacking {
 		}
 	}
 
+	/**
+	ComputeSimilarityValues computes @f$ R @f$ secure multiplications for each packed encryption of the similarity values of a user and compares them:
+	one blinding factor for each packed encryption and one DGK comparison for each similarity value.
+	ComputeUserRecommendations computes one secure multiplication for each packed encryption of the sparse ratings of the @f$ N - 1 @f$ other users.
+	The Privacy Service Provider counterparts of the secure multiplications and comparisons are planned as well.
+
+	Must be called after SetPrivacyServiceProvider.
+
+	@param plan the precomputation plan
+	@param sparseRatings @f$ [V_i^{Packed}] @f$
+	*/
+	void ServiceProvider::PlanPrecomputations (PrecomputationPlan &plan, const PackedItems &sparseRatings) {
+	#ifdef FIRST_USER_ONLY
+		size_t processedUserCount = 1;
+	#else
+		size_t processedUserCount = this->userCount;
+	#endif
+		size_t multiplicationCount = 0;
+		size_t encryptionCount = 0;
+		size_t similarityValueCount = 0;
+		//the last user has no similarity values of its own (sim(A, B) = sim(B, A))
+		for (size_t user = 0; user < processedUserCount && user < this->userCount - 1; ++user) {
+			size_t rowSimilarityCount = this->userCount - 1 - user;
+			size_t rowEncryptionCount = (rowSimilarityCount + this->maxPackedBuckets - 1) / this->maxPackedBuckets;
+
+			multiplicationCount += this->denselyRatedItemCount * rowEncryptionCount;
+			encryptionCount += rowEncryptionCount;
+			similarityValueCount += rowSimilarityCount;
+		}
+
+		for (size_t user = 0; user < processedUserCount; ++user) {
+			for (size_t i = 0; i < this->userCount; ++i) {
+				if (i != user) {
+					multiplicationCount += sparseRatings[i].size();
+				}
+			}
+		}
+
+		this->secureMultiplicationServer->PlanMultiplications(plan, multiplicationCount);
+		this->secureComparisonServer->PlanComparisons(plan, encryptionCount, similarityValueCount);
+
+		this->privacyServiceProvider.lock()->PlanPrecomputations(plan, multiplicationCount, similarityValueCount);
+	}
+
 	/**
 	@param userId The index of the user
 	@return @f$ [L_{user}] @f$
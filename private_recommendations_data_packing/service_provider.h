@@ -36,6 +36,7 @@ limitations under the License.
 #include "core/random_provider.h"
 #include "core/paillier.h"
 #include "core/secure_multiplication_server.h"
+#include "core/precomputation_plan.h"
 
 #include "secure_comparison_server.h"
 
@@ -43,6 +44,7 @@ limitations under the License.
 //include C++ libraries
 #include <string>
 #include <deque>
+#include <vector>
 #include <stdexcept>
 
 namespace SeComLib {
@@ -91,6 +93,9 @@ namespace PrivateRecommendationsDataPacking {
 		/// Computes @f$ [\Gamma] @f$, @f$ [L] @f$ and @f$ [UR_{sum}] @f$ for each user
 		void ComputeUserRecommendations (const PackedItems &sparseRatings);
 
+		/// Adds the randomizers and blinding factors consumed by ComputeSimilarityValues and ComputeUserRecommendations to the plan
+		void PlanPrecomputations (PrecomputationPlan &plan, const PackedItems &sparseRatings);
+
 		/// Returns the @f$ [L] @f$ value for the specified user
 		const Paillier::Ciphertext &GetEncryptedL (const size_t userId) const;
 
@@ -50,6 +50,46 @@ namespace PrivateRecommendationsUtils {
 		this->encryptedRDivTwoPowL = cryptoProvider.EncryptInteger(this->r / parameters.twoPowL);
 	}
 
+	/**
+	Loads @f$ r @f$, @f$ r \pmod 2^l @f$, @f$ [r] @f$ and @f$ [r \div 2^l] @f$.
+
+	@param cryptoProvider the crypto provider
+	@param parameters unused parameter
+	@param record the precomputed record
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	ComparisonBlindingFactorContainer<T_CryptoProvider, T_Parameters>::ComparisonBlindingFactorContainer (const T_CryptoProvider &cryptoProvider, const T_Parameters &/*parameters*/, PrecomputationStore::RecordReader &record) {
+		this->r = record.ReadBigInteger();
+		this->rModTwoPowL = record.ReadBigInteger();
+		this->encryptedR = record.ReadCiphertext(cryptoProvider);
+		this->encryptedRDivTwoPowL = record.ReadCiphertext(cryptoProvider);
+	}
+
+	/**
+	@param record the record which receives the data
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	void ComparisonBlindingFactorContainer<T_CryptoProvider, T_Parameters>::Serialize (PrecomputationStore::RecordWriter &record) const {
+		record.Write(this->r);
+		record.Write(this->rModTwoPowL);
+		record.Write(this->encryptedR.data);
+		record.Write(this->encryptedRDivTwoPowL.data);
+	}
+
+	/**
+	The blinding factors depend on the public key, @f$ l @f$ and @f$ \kappa @f$.
+
+	@param cryptoProvider the crypto provider
+	@param parameters configuration parameters
+	@return The store key.
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	std::string ComparisonBlindingFactorContainer<T_CryptoProvider, T_Parameters>::GetStoreKey (const T_CryptoProvider &cryptoProvider, const T_Parameters &parameters) {
+		std::stringstream key;
+		key << "ComparisonBlindingFactorContainer;" << cryptoProvider.GetPublicKeyFingerprint() << ";l=" << parameters.l << ";kappa=" << parameters.kappa;
+
+		return key.str();
+	}
 }//namespace PrivateRecommendationsUtils
 }//namespace SeComLib
 
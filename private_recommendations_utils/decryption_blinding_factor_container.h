@@ -32,9 +32,11 @@ limitations under the License.
 //include our headers
 #include "utils/config.h"
 #include "core/big_integer.h"
+#include "core/precomputation_store.h"
 
 //include C++ libraries
 #include <string>
+#include <sstream>
 #include <deque>
 #include <stdexcept>
 
@@ -65,6 +67,15 @@ namespace PrivateRecommendationsUtils {
 
 		/// Constructor
 		DecryptionBlindingFactorContainer (const T_CryptoProvider &cryptoProvider, const T_Parameters &parameters);
+
+		/// Constructor which loads the data from a precomputed record
+		DecryptionBlindingFactorContainer (const T_CryptoProvider &cryptoProvider, const T_Parameters &parameters, PrecomputationStore::RecordReader &record);
+
+		/// Serializes the data into a precomputed record
+		void Serialize (PrecomputationStore::RecordWriter &record) const;
+
+		/// Returns the key of the precomputation store
+		static std::string GetStoreKey (const T_CryptoProvider &cryptoProvider, const T_Parameters &parameters);
 	};
 
 }//namespace PrivateRecommendationsUtils
@@ -44,6 +44,42 @@ namespace PrivateRecommendationsUtils {
 		this->encryptedR = cryptoProvider.EncryptInteger(r);
 	}
 
+	/**
+	Loads @f$ r @f$ and @f$ [r] @f$.
+
+	@param cryptoProvider the crypto provider
+	@param parameters unused parameter
+	@param record the precomputed record
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	DecryptionBlindingFactorContainer<T_CryptoProvider, T_Parameters>::DecryptionBlindingFactorContainer (const T_CryptoProvider &cryptoProvider, const T_Parameters &/*parameters*/, PrecomputationStore::RecordReader &record) {
+		this->r = record.ReadBigInteger();
+		this->encryptedR = record.ReadCiphertext(cryptoProvider);
+	}
+
+	/**
+	@param record the record which receives the data
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	void DecryptionBlindingFactorContainer<T_CryptoProvider, T_Parameters>::Serialize (PrecomputationStore::RecordWriter &record) const {
+		record.Write(this->r);
+		record.Write(this->encryptedR.data);
+	}
+
+	/**
+	The blinding factors depend on the public key, @f$ l @f$ and @f$ \kappa @f$.
+
+	@param cryptoProvider the crypto provider
+	@param parameters configuration parameters
+	@return The store key.
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	std::string DecryptionBlindingFactorContainer<T_CryptoProvider, T_Parameters>::GetStoreKey (const T_CryptoProvider &cryptoProvider, const T_Parameters &parameters) {
+		std::stringstream key;
+		key << "DecryptionBlindingFactorContainer;" << cryptoProvider.GetPublicKeyFingerprint() << ";l=" << parameters.l << ";kappa=" << parameters.kappa;
+
+		return key.str();
+	}
 }//namespace PrivateRecommendationsUtils
 }//namespace SeComLib
 
@@ -117,6 +117,18 @@ namespace PrivateRecommendationsUtils {
 		}
 	}
 
+	/**
+	Each comparison encrypts the @f$ l @f$ bits of @f$ b @f$, re-randomizes @f$ l - 1 @f$ @f$ \llbracket tb \rrbracket @f$ values and encrypts the Paillier result.
+
+	@param plan the precomputation plan
+	@param comparisonCount the number of comparisons
+	@param l bitsize of the comparison operands
+	*/
+	void DgkComparisonClient::PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount, const size_t l) const {
+		plan.AddRandomizers("DGK comparison client DGK randomizers", this->dgkCryptoProvider, comparisonCount * (2 * l - 1));
+		plan.AddRandomizers("DGK comparison client Paillier randomizers", this->paillierCryptoProvider, comparisonCount);
+	}
+
 	/**
 	@param dgkComparisonServer a DgkComparisonServer instance
 	*/
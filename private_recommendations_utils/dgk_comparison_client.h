@@ -35,6 +35,7 @@ limitations under the License.
 #include "core/random_provider.h"
 #include "core/paillier.h"
 #include "core/dgk.h"
+#include "core/precomputation_plan.h"
 
 namespace SeComLib {
 using namespace Core;
@@ -69,6 +70,9 @@ namespace PrivateRecommendationsUtils {
 		/// Computes @f$ [d_{l + 1}^{(i, PSP)}] = [z_{l + 1}^{(i)} \oplus C_{i(l + 2) + (l + 1)}^{PSP}] @f$
 		Paillier::Ciphertext ComputeDiPSP (const Dgk::Ciphertext &CiPSP) const;
 
+		/// Adds the randomizers consumed by comparisonCount comparisons to the plan
+		void PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount, const size_t l) const;
+
 		/// Setter for this->dgkComparisonServer
 		void SetServer (const std::shared_ptr<DgkComparisonServer> &dgkComparisonServer);
 
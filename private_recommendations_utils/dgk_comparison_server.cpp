@@ -52,14 +52,14 @@ namespace PrivateRecommendationsUtils {
 	@return encrypted result of the comparison: @f$ [0] @f$ or @f$ [1] @f$
 	*/
 	Paillier::Ciphertext DgkComparisonServer::Compare (const BigInteger &rModTwoPowL) const {
-		BigInteger c = RandomProvider::GetInstance().GetRandomInteger(1);
+		bool c = RandomBitSource::GetInstance().GetBit();
 
 		Dgk::Ciphertext tau = this->computeTau(rModTwoPowL, c);
 
 		/// Compute @f$ t_l = t_{PSP} \oplus t_{SP} @f$
 		Dgk::Ciphertext tl;
 		/// @f$ t_{PSP} = \tau @f$ and @f$ t_{SP} = c @f$
-		if (c == 0) {
+		if (!c) {
 			/// @f$ [t_l] = [t_{PSP}] @f$
 			tl = tau;
 		}
@@ -78,7 +78,7 @@ namespace PrivateRecommendationsUtils {
 	@return @f$ [d^{(i)}] @f$
 	*/
 	Paillier::Ciphertext DgkComparisonServer::ComputeDi (const BigInteger &ri) const {
-		BigInteger CiSP = RandomProvider::GetInstance().GetRandomInteger(1);
+		bool CiSP = RandomBitSource::GetInstance().GetBit();
 
 		/// @f$ \llbracket C_{i(l + 2) + (l + 1)}^{PSP} \rrbracket = \llbracket \tau \rrbracket @f$
 		Dgk::Ciphertext CiPSP = this->computeTau(ri, CiSP);
@@ -91,7 +91,7 @@ namespace PrivateRecommendationsUtils {
 
 		/// @f$ [d_{l + 1}^{(i, SP)}] = [r_{l + 1}^{(i)} \oplus C_{i(l + 2) + (l + 1)}^{SP}] @f$
 		int diSP;
-		if (CiSP != static_cast<long>(ri.GetBit(this->GetMSBPosition()))) {
+		if (CiSP != (ri.GetBit(this->GetMSBPosition()) == 1)) {
 			diSP = 1;
 		}
 		else {
@@ -113,8 +113,23 @@ namespace PrivateRecommendationsUtils {
 	@param tSP the additive share of the Server, denoted as @f$ c @f$ in the protocol
 	@return Unrandomized @f$ [\tau] @f$
 	*/
-	Dgk::Ciphertext DgkComparisonServer::computeTau (const BigInteger &a, const BigInteger &tSP) const {
-		Dgk::Ciphertext b0 = this->dgkComparisonClient.lock()->GetBi(0);
+	Dgk::Ciphertext DgkComparisonServer::computeTau (const BigInteger &a, const bool tSP) const {
+		/// Fetch @f$ \llbracket b_i \rrbracket @f$, @f$ i = 0 : l - 1 @f$ (they do not depend on the interaction)
+		std::vector<Dgk::Ciphertext> b;
+		b.reserve(this->l);
+		for (size_t i = 0; i < this->l; ++i) {
+			b.push_back(this->dgkComparisonClient.lock()->GetBi(i));
+		}
+
+		/// Compute @f$ \llbracket 1 - b_i \rrbracket = \llbracket 1 \rrbracket \llbracket b_i \rrbracket^{-1} \pmod n @f$ for all @f$ i @f$ where @f$ a_i = 1 @f$ using a single modular inversion
+		std::vector<Dgk::Ciphertext> selectedB;
+		for (size_t i = 0; i < this->l; ++i) {
+			if (a.GetBit(i) == 1) {
+				selectedB.push_back(b[i]);
+			}
+		}
+		std::vector<Dgk::Ciphertext> oneMinusB = this->dgkCryptoProvider.BatchSubtract(this->dgkCryptoProvider.GetEncryptedOne(false), selectedB);
+		std::vector<Dgk::Ciphertext>::const_iterator oneMinusBi = oneMinusB.begin();
 
 		Dgk::Ciphertext t;
 
@@ -125,18 +140,18 @@ namespace PrivateRecommendationsUtils {
 		}
 		else {
 			/// @f$ \llbracket t \rrbracket = \llbracket 1 \rrbracket \llbracket b_0 \rrbracket^{-1} \pmod n @f$
-			t = this->dgkCryptoProvider.GetEncryptedOne(false) - b0;
+			t = *oneMinusBi++;
 		}
 
 		/// @f$ i = 1 : l - 1 @f$
 		for (size_t i = 1; i < this->l; ++i) {
 			/// Blind @f$ t = t_i @f$ by tossing a fair coin @f$ c \in {-1, 1} @f$
-			BigInteger c = RandomProvider::GetInstance().GetRandomInteger(1);
+			bool c = RandomBitSource::GetInstance().GetBit();
 
 			Dgk::Ciphertext tau;
 			
 			//perform blinding
-			if (c == 0) {
+			if (!c) {
 				/// @f$ \llbracket \tau \rrbracket = \llbracket t \rrbracket @f$
 				tau = t;
 			}
@@ -151,13 +166,10 @@ namespace PrivateRecommendationsUtils {
 			/// Fetch @f$ \llbracket tb \rrbracket @f$
 			Dgk::Ciphertext tb = this->dgkComparisonClient.lock()->GetTb(tau, i);
 
-			/// Fetch @f$ \llbracket b_i \rrbracket @f$
-			Dgk::Ciphertext bi = this->dgkComparisonClient.lock()->GetBi(i);
-
 			/// If @f$ c = 1 @f$
-			if (c == 1) {
+			if (c) {
 				/// @f$ \llbracket tb \rrbracket = \llbracket b_i \rrbracket \llbracket tb \rrbracket^{-1} \pmod n @f$
-				tb = bi - tb;
+				tb = b[i] - tb;
 			}
 
 			if (a.GetBit(i) == 0) {
@@ -166,12 +178,12 @@ namespace PrivateRecommendationsUtils {
 			}
 			else {
 				/// @f$ \llbracket t \rrbracket = \llbracket tb \rrbracket \llbracket 1 \rrbracket \llbracket b_i \rrbracket^{-1} \pmod n @f$
-				t = tb + (this->dgkCryptoProvider.GetEncryptedOne(false) - bi);
+				t = tb + *oneMinusBi++;
 			}
 		}
 		
 		/// Blind @f$ t = t_l @f$ by tossing a fair coin @f$ c \in {-1, 1} @f$
-		if (tSP == 0) {
+		if (!tSP) {
 			/// @f$ \llbracket \tau \rrbracket = \llbracket t \rrbracket @f$
 			return t;
 		}
@@ -188,6 +200,16 @@ namespace PrivateRecommendationsUtils {
 		return this->l;
 	}
 
+	/**
+	Each comparison re-randomizes @f$ l - 1 @f$ blinded @f$ \llbracket \tau \rrbracket @f$ values and @f$ \llbracket t_l \rrbracket @f$.
+
+	@param plan the precomputation plan
+	@param comparisonCount the number of calls to Compare
+	*/
+	void DgkComparisonServer::PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount) const {
+		plan.AddRandomizers("DGK comparison server randomizers", this->dgkCryptoProvider, comparisonCount * this->l);
+	}
+
 	/**
 	@param dgkComparisonClient a DgkComparisonClient instance
 	*/
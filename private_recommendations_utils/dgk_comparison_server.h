@@ -33,8 +33,10 @@ limitations under the License.
 #include "utils/config.h"
 #include "core/big_integer.h"
 #include "core/random_provider.h"
+#include "core/random_bit_source.h"
 #include "core/paillier.h"
 #include "core/dgk.h"
+#include "core/precomputation_plan.h"
 
 namespace SeComLib {
 using namespace Core;
@@ -63,6 +65,9 @@ namespace PrivateRecommendationsUtils {
 		/// Returns the bit position of the MSB of the operands (since l is not available for the dgkComparisonClient)
 		size_t GetMSBPosition () const;
 
+		/// Adds the randomizers consumed by comparisonCount comparisons to the plan
+		void PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount) const;
+
 		/// Setter for this->dgkComparisonClient
 		void SetClient (const std::shared_ptr<DgkComparisonClient> &dgkComparisonClient);
 
@@ -80,7 +85,7 @@ namespace PrivateRecommendationsUtils {
 		size_t l;
 
 		/// Computes the encrypted additive share of the client
-		Dgk::Ciphertext computeTau (const BigInteger &a, const BigInteger &tSP) const;
+		Dgk::Ciphertext computeTau (const BigInteger &a, const bool tSP) const;
 
 		/// Copy constructor - not implemented
 		DgkComparisonServer (DgkComparisonServer const &);
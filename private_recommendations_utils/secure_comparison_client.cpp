@@ -60,6 +60,18 @@ namespace PrivateRecommendationsUtils {
 		return this->paillierCryptoProvider.EncryptInteger(plaintextZ / this->twoPowL);
 	}
 
+	/**
+	Each comparison encrypts @f$ z \div 2^l @f$, plus the randomizers of the DGK comparison.
+
+	@param plan the precomputation plan
+	@param comparisonCount the number of comparisons
+	*/
+	void SecureComparisonClient::PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount) const {
+		plan.AddRandomizers("Secure comparison client randomizers", this->paillierCryptoProvider, comparisonCount);
+
+		this->dgkComparisonClient->PlanComparisons(plan, comparisonCount, this->l);
+	}
+
 	/**
 	@param secureComparisonServer a SecureComparisonServer instance
 	*/
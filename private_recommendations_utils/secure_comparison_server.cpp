@@ -134,6 +134,18 @@ namespace PrivateRecommendationsUtils {
 		return gamma;
 	}
 
+	/**
+	Each comparison consumes one blinding factor container, plus the randomizers of the DGK comparison.
+
+	@param plan the precomputation plan
+	@param comparisonCount the number of calls to Compare
+	*/
+	void SecureComparisonServer::PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount) {
+		plan.Add("Secure comparison blinding factors", this->blindingFactorCache, comparisonCount);
+
+		this->dgkComparisonServer->PlanComparisons(plan, comparisonCount);
+	}
+
 	/**
 	@param secureComparisonClient a SecureComparisonClient instance
 	*/
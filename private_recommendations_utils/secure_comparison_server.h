@@ -36,6 +36,7 @@ limitations under the License.
 #include "core/paillier.h"
 #include "core/dgk.h"
 #include "core/randomizer_cache.h"
+#include "core/precomputation_plan.h"
 
 #include "comparison_blinding_factor_cache_parameters.h"
 #include "comparison_blinding_factor_container.h"
@@ -68,6 +69,9 @@ namespace PrivateRecommendationsUtils {
 		/// Interactive secure comparison of a similarity value with a preset threshold
 		Paillier::Ciphertext Compare (const Paillier::Ciphertext &similarityValue);
 
+		/// Adds the blinding factors and randomizers consumed by comparisonCount comparisons to the plan
+		void PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount);
+
 		/// Setter for this->secureComparisonClient
 		void SetClient (const std::shared_ptr<SecureComparisonClient> & secureComparisonClient);
 
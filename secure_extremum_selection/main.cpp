@@ -46,6 +46,9 @@ int main (int argc, char *argv[]) {
 			Utils::Config::SetConfigFile(std::string(argv[1]));
 		}
 
+		/// Install the GMP memory pool, if enabled (before any big integers are allocated)
+		Core::GmpMemoryPool::Initialize();
+
 		/// Initialize the servers
 		std::shared_ptr<Client> client = std::make_shared<Client>();
 		std::shared_ptr<Server> server = std::make_shared<Server>(client->paillierCryptoProvider.GetPublicKey(), client->dgkCryptoProvider.GetPublicKey());
@@ -31,6 +31,7 @@ limitations under the License.
 
 //include our headers
 #include "utils/config.h"
+#include "core/gmp_memory_pool.h"
 
 #include "server.h"
 #include "client.h"
@@ -71,6 +71,17 @@ namespace SecureFaceRecognition {
 		this->secureComparisonClient->SetServer(server->GetSecureComparisonServer());
 	}
 
+	/**
+	The simulation encrypts @f$ a @f$ and @f$ b @f$ and performs a single comparison.
+
+	@param plan the precomputation plan
+	*/
+	void Client::PlanPrecomputations (PrecomputationPlan &plan) const {
+		plan.AddRandomizers("Client input encryptions", this->paillierCryptoProvider, 2);
+
+		this->secureComparisonClient->PlanComparisons(plan, 1);
+	}
+
 	/**
 	@return The SecureComparisonClient instance.
 	*/
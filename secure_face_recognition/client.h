@@ -34,6 +34,7 @@ limitations under the License.
 #include "core/big_integer.h"
 #include "core/paillier.h"
 #include "core/dgk.h"
+#include "core/precomputation_plan.h"
 
 #include "secure_face_recognition_utils/secure_comparison_client.h"
 
@@ -68,6 +69,9 @@ namespace SecureFaceRecognition {
 		/// Sets a reference to the Privacy Service Provider
 		void SetServer (const std::shared_ptr<const Server> &server);
 
+		/// Adds the randomizers consumed by StartSimulation to the plan
+		void PlanPrecomputations (PrecomputationPlan &plan) const;
+
 		/// Getter for this->secureComparisonClient
 		const std::shared_ptr<SecureComparisonClient> &GetSecureComparisonClient () const;
 
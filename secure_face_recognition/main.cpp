@@ -47,6 +47,9 @@ int main (int argc, char *argv[]) {
 			Utils::Config::SetConfigFile(std::string(argv[1]));
 		}
 
+		/// Install the GMP memory pool, if enabled (before any big integers are allocated)
+		Core::GmpMemoryPool::Initialize();
+
 		/// Initialize the servers
 		std::shared_ptr<Client> client = std::make_shared<Client>();
 		std::shared_ptr<Server> server = std::make_shared<Server>(client->paillierCryptoProvider.GetPublicKey(), client->dgkCryptoProvider.GetPublicKey());
@@ -54,8 +57,26 @@ int main (int argc, char *argv[]) {
 		server->SetClient(client);
 		client->SetServer(server);
 
+		/// Precompute the randomizers and blinding factors of the simulation, if enabled (offline phase)
+		Core::PrecomputationPlan plan;
+		bool precompute = Utils::Config::GetInstance().GetParameter<bool>("Core.PrecomputationPlan.enabled", false);
+		if (precompute) {
+			server->PlanPrecomputations(plan);
+			client->PlanPrecomputations(plan);
+			plan.Execute();
+
+			std::cout << "Offline phase: " << Utils::CpuTimer::ToString(plan.GetOfflineTime()) << std::endl;
+		}
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
 		/// Start the simulation
 		client->StartSimulation();
+
+		if (precompute) {
+			std::cout << "Online phase: " << Utils::CpuTimer::ToString(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()) << std::endl;
+			plan.PrintReport(std::cout);
+		}
 	}
 	catch (const std::runtime_error &exception) {
 		std::cout << exception.what() << std::endl;
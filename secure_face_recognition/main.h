@@ -31,6 +31,9 @@ limitations under the License.
 
 //include our headers
 #include "utils/config.h"
+#include "core/gmp_memory_pool.h"
+#include "core/precomputation_plan.h"
+#include "utils/cpu_timer.h"
 
 #include "server.h"
 #include "client.h"
@@ -38,6 +41,7 @@ limitations under the License.
 //include C++ headers
 #include <iostream>
 #include <stdexcept>
+#include <chrono>
 
 using namespace SeComLib;
 using namespace SeComLib::SecureFaceRecognition;
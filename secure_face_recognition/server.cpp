@@ -74,6 +74,15 @@ namespace SecureFaceRecognition {
 		this->secureComparisonServer->SetClient(client->GetSecureComparisonClient());
 	}
 
+	/**
+	The simulation performs a single comparison.
+
+	@param plan the precomputation plan
+	*/
+	void Server::PlanPrecomputations (PrecomputationPlan &plan) {
+		this->secureComparisonServer->PlanComparisons(plan, 1);
+	}
+
 	/**
 	@return The SecureComparisonServer instance.
 	*/
@@ -34,6 +34,7 @@ limitations under the License.
 #include "core/big_integer.h"
 #include "core/paillier.h"
 #include "core/dgk.h"
+#include "core/precomputation_plan.h"
 
 #include "secure_face_recognition_utils/secure_comparison_server.h"
 
@@ -62,6 +63,9 @@ namespace SecureFaceRecognition {
 		/// Sets a reference to the Privacy Service Provider
 		void SetClient (const std::shared_ptr<const Client> &client);
 
+		/// Adds the blinding factors and randomizers consumed by SecureComparison to the plan
+		void PlanPrecomputations (PrecomputationPlan &plan);
+
 		/// Getter for this->secureComparisonServer
 		const std::shared_ptr<SecureComparisonServer> &GetSecureComparisonServer () const;
 
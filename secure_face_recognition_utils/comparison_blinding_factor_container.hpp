@@ -53,6 +53,52 @@ namespace SecureFaceRecognitionUtils {
 		this->encryptedRModTwoPowL = cryptoProvider.EncryptIntegerNonrandom(hatR);
 	}
 
+	/**
+	Loads the bits of @f$ \hat{r} @f$, @f$ [r] @f$ and @f$ [r \pmod {2^l}] @f$.
+
+	@param cryptoProvider the crypto provider
+	@param parameters unused parameter
+	@param record the precomputed record
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	ComparisonBlindingFactorContainer<T_CryptoProvider, T_Parameters>::ComparisonBlindingFactorContainer (const T_CryptoProvider &cryptoProvider, const T_Parameters &/*parameters*/, PrecomputationStore::RecordReader &record) {
+		size_t bitCount = static_cast<size_t>(record.ReadLong());
+		for (size_t i = 0; i < bitCount; ++i) {
+			this->hatRBits.emplace_back(record.ReadLong());
+		}
+
+		this->encryptedR = record.ReadCiphertext(cryptoProvider);
+		this->encryptedRModTwoPowL = record.ReadCiphertext(cryptoProvider);
+	}
+
+	/**
+	@param record the record which receives the data
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	void ComparisonBlindingFactorContainer<T_CryptoProvider, T_Parameters>::Serialize (PrecomputationStore::RecordWriter &record) const {
+		record.Write(static_cast<long>(this->hatRBits.size()));
+		for (std::deque<long>::const_iterator bit = this->hatRBits.begin(); bit != this->hatRBits.end(); ++bit) {
+			record.Write(*bit);
+		}
+
+		record.Write(this->encryptedR.data);
+		record.Write(this->encryptedRModTwoPowL.data);
+	}
+
+	/**
+	The blinding factors depend on the public key, @f$ l @f$ and @f$ \kappa @f$.
+
+	@param cryptoProvider the crypto provider
+	@param parameters configuration parameters
+	@return The store key.
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	std::string ComparisonBlindingFactorContainer<T_CryptoProvider, T_Parameters>::GetStoreKey (const T_CryptoProvider &cryptoProvider, const T_Parameters &parameters) {
+		std::stringstream key;
+		key << "ComparisonBlindingFactorContainer;" << cryptoProvider.GetPublicKeyFingerprint() << ";l=" << parameters.l << ";kappa=" << parameters.kappa;
+
+		return key.str();
+	}
 }//namespace SecureFaceRecognitionUtils
 }//namespace SeComLib
 
@@ -46,6 +46,48 @@ namespace SecureFaceRecognitionUtils {
 		}
 	}
 
+	/**
+	Loads the @f$ l + 1 @f$ random numbers and their encryptions.
+
+	@param cryptoProvider the crypto provider
+	@param parameters unused parameter
+	@param record the precomputed record
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	DgkComparisonBlindingFactorContainer<T_CryptoProvider, T_Parameters>::DgkComparisonBlindingFactorContainer (const T_CryptoProvider &cryptoProvider, const T_Parameters &/*parameters*/, PrecomputationStore::RecordReader &record) {
+		size_t count = static_cast<size_t>(record.ReadLong());
+		for (size_t i = 0; i < count; ++i) {
+			this->R.emplace_back(record.ReadBigInteger());
+			this->encryptedR.emplace_back(record.ReadCiphertext(cryptoProvider));
+		}
+	}
+
+	/**
+	@param record the record which receives the data
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	void DgkComparisonBlindingFactorContainer<T_CryptoProvider, T_Parameters>::Serialize (PrecomputationStore::RecordWriter &record) const {
+		record.Write(static_cast<long>(this->R.size()));
+		for (size_t i = 0; i < this->R.size(); ++i) {
+			record.Write(this->R[i]);
+			record.Write(this->encryptedR[i].data);
+		}
+	}
+
+	/**
+	The blinding factors depend on the public key and @f$ l + 1 @f$.
+
+	@param cryptoProvider the crypto provider
+	@param parameters configuration parameters
+	@return The store key.
+	*/
+	template <typename T_CryptoProvider, typename T_Parameters>
+	std::string DgkComparisonBlindingFactorContainer<T_CryptoProvider, T_Parameters>::GetStoreKey (const T_CryptoProvider &cryptoProvider, const T_Parameters &parameters) {
+		std::stringstream key;
+		key << "DgkComparisonBlindingFactorContainer;" << cryptoProvider.GetPublicKeyFingerprint() << ";lPlusOne=" << parameters.lPlusOne;
+
+		return key.str();
+	}
 }//namespace SecureFaceRecognitionUtils
 }//namespace SeComLib
 
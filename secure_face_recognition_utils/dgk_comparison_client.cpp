@@ -55,14 +55,16 @@ namespace SecureFaceRecognitionUtils {
 	@return The encrypted bits of @f$ \hat{d} @f$.
 	*/
 	std::deque<Dgk::Ciphertext> DgkComparisonClient::GetHatDBits () const {
-		std::deque<Dgk::Ciphertext> hatDBits;
-
-		/// Encrypt each bit of @f$ \hat{d} @f$ using DGK @f$ \Rightarrow \llbracket \hat{d} \rrbracket @f$
+		std::vector<BigInteger> bits;
+		bits.reserve(this->l);
 		for (size_t i = 0; i < this->l; ++i) {
-			hatDBits.emplace_back(this->dgkCryptoProvider.EncryptInteger(BigInteger(static_cast<long>(this->hatD.GetBit(i)))));
+			bits.emplace_back(static_cast<long>(this->hatD.GetBit(i)));
 		}
 
-		return hatDBits;
+		/// Encrypt each bit of @f$ \hat{d} @f$ using DGK @f$ \Rightarrow \llbracket \hat{d} \rrbracket @f$ (in one batch)
+		std::vector<Dgk::Ciphertext> hatDBits = this->dgkCryptoProvider.EncryptBatch(bits);
+
+		return std::deque<Dgk::Ciphertext>(std::make_move_iterator(hatDBits.begin()), std::make_move_iterator(hatDBits.end()));
 	}
 	 
 	/**
@@ -83,6 +85,17 @@ namespace SecureFaceRecognitionUtils {
 		return this->paillierCryptoProvider.GetEncryptedZero();
 	}
 
+	/**
+	Each comparison encrypts the @f$ l @f$ bits of @f$ \hat{d} @f$ and returns a fresh Paillier encryption of @f$ \lambda @f$.
+
+	@param plan the precomputation plan
+	@param comparisonCount the number of comparisons
+	*/
+	void DgkComparisonClient::PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount) const {
+		plan.AddRandomizers("DGK comparison client DGK randomizers", this->dgkCryptoProvider, comparisonCount * this->l);
+		plan.AddRandomizers("DGK comparison client Paillier randomizers", this->paillierCryptoProvider, comparisonCount);
+	}
+
 	/**
 	@param dgkComparisonServer a DgkComparisonServer instance
 	*/
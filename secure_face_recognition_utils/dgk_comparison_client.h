@@ -35,9 +35,12 @@ limitations under the License.
 #include "core/random_provider.h"
 #include "core/paillier.h"
 #include "core/dgk.h"
+#include "core/precomputation_plan.h"
 
 //include c++ headers
 #include <deque>
+#include <iterator>
+#include <vector>
 
 namespace SeComLib {
 using namespace Core;
@@ -66,6 +69,9 @@ namespace SecureFaceRecognitionUtils {
 		/// Computes @f$ [\lambda] @f$
 		Paillier::Ciphertext ComputeLambda (const std::deque<Dgk::Ciphertext> &e) const;
 
+		/// Adds the randomizers consumed by comparisonCount comparisons to the plan
+		void PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount) const;
+
 		/// Setter for this->dgkComparisonServer
 		void SetServer (const std::shared_ptr<DgkComparisonServer> &dgkComparisonServer);
 
@@ -51,7 +51,7 @@ namespace SecureFaceRecognitionUtils {
 	@param s random value @f$ s \in {0, 1} @f$
 	@return @f$ \lambda @f$
 	*/
-	Paillier::Ciphertext DgkComparisonServer::ComputeLambda (const std::deque<long> &hatRBits, const BigInteger &s) {
+	Paillier::Ciphertext DgkComparisonServer::ComputeLambda (const std::deque<long> &hatRBits, const long s) {
 		/// Implementation of Protocol 4.10, as described in Martin Franz' Master Thesis from 2008 (@f$ a = [\hat{d}] @f$, @f$ b = \hat{r} @f$
 
 		/// Fetch @f$ \hat{d} @f$ from the client
@@ -59,9 +59,33 @@ namespace SecureFaceRecognitionUtils {
 
 		const BlindingFactorContainer &blindingFactorContainer = this->blindingFactorCache.Pop();
 
+		/// Compute @f$ [-1] @f$ and @f$ [-\hat{d}_i] @f$ for all @f$ i @f$ where @f$ \hat{r}_i = 1 @f$ using a single modular inversion
+		std::vector<Dgk::Ciphertext> negationInputs;
+		for (size_t i = 0; i < this->l; ++i) {
+			if (hatRBits[i] == 1) {
+				negationInputs.push_back(hatDBits[i]);
+			}
+		}
+		negationInputs.push_back(this->dgkCryptoProvider.GetEncryptedOne(false));
+		std::vector<Dgk::Ciphertext> negations = this->dgkCryptoProvider.BatchNegate(negationInputs);
+		const Dgk::Ciphertext &encryptedMinusOne = negations.back();
+
+		/// @f$ [xor(\hat{d}_i, \hat{r}_i)] = [\hat{d}_i] @f$ if @f$ \hat{r}_i = 0 @f$ and @f$ [1 - \hat{d}_i] = [1] [-\hat{d}_i] @f$ otherwise
+		std::vector<Dgk::Ciphertext> xorBits;
+		xorBits.reserve(this->l);
+		for (size_t i = 0, j = 0; i < this->l; ++i) {
+			xorBits.push_back(hatRBits[i] == 0 ? hatDBits[i] : (this->dgkCryptoProvider.GetEncryptedOne(false) + negations[j++]));
+		}
+
 		/// Compute the @f$ e @f$ vector
 		std::deque<Dgk::Ciphertext> e;
 
+		/// The blinding exponentiations @f$ [e_i] = [c_i]^{R_i} @f$ are collected and computed together at the end.
+		/// Until then, e contains @f$ [c_i] @f$ and blindedPositions records their positions, counted from the back of e (emplace_front does not change them)
+		std::vector<Dgk::Ciphertext> blindingBases;
+		std::vector<BigInteger> blindingExponents;
+		std::vector<size_t> blindedPositions;
+
 		/// If @f$ \hat{r}_{l - 1} = s @f$
 		if (s == hatRBits[l - 1]) {
 			/// @warning Protocol 4.10 from Martin Franz' Master Thesis DOES NOT take into account the two different cases when @f$ \hat{r}_{l - 1} = 0 @f$ and @f$ \hat{r}_{l - 1} = 1 @f$ so the protocol does not work properly for values that differ starting with the MSB!
@@ -69,14 +93,15 @@ namespace SecureFaceRecognitionUtils {
 			/// @f$ [e_{l - 1}] = [0] @f$ if @f$ (d_{l - 1} < r_{l - 1}) \land s = 1 @f$ or if @f$ (d_{l - 1} > r_{l - 1}) \land s = 0 @f$
 			if (hatRBits[l - 1] == 0) {
 				/// @f$ [e_{l - 1}] = [\hat{d}_{l - 1} - 1]^{R_{l - 1}}) = (([\hat{d}_{l - 1}] [1]^{-1})^{R_{l - 1}}) @f$
-				e.emplace_front((hatDBits[l - 1] - this->dgkCryptoProvider.GetEncryptedOne(false)) * blindingFactorContainer.R[l]);
+				e.emplace_front(hatDBits[l - 1] + encryptedMinusOne);
 			}
 			else {
 				/// @f$ [e_{l - 1}] = ([\hat{d}_{l - 1}]^{R_{l - 1}}) @f$
-				e.emplace_front(hatDBits[l - 1] * blindingFactorContainer.R[l]);//the indexes in R are shifted by one
+				e.emplace_front(hatDBits[l - 1]);
 			}
-			/// @f$ [e_{l - 1}] = [e_{l - 1}]_{re-rand} @f$
-			e.front() = this->dgkCryptoProvider.RandomizeCiphertext(e.front());
+			blindingExponents.push_back(blindingFactorContainer.R[l]);//the indexes in R are shifted by one
+			blindedPositions.push_back(e.size());
+			/// @f$ [e_{l - 1}] = [e_{l - 1}]_{re-rand} @f$ (after the blinding)
 		}
 		else {
 			/// @f$ [e_{l - 1}] = [R_{l-1}] @f$
@@ -84,7 +109,7 @@ namespace SecureFaceRecognitionUtils {
 		}
 
 		/// @f$ [\sigma] = xor([\hat{d}_{l - 1}], \hat{r}_{l - 1}) @f$
-		Dgk::Ciphertext sigma = hatRBits[l - 1] == 0 ? hatDBits[l - 1] : (this->dgkCryptoProvider.GetEncryptedOne(false) - hatDBits[l - 1]);
+		Dgk::Ciphertext sigma = xorBits[l - 1];
 		//can't use size_t because the stop condition requires i = -1
 		for (long i = static_cast<long>(this->l - 2); i >= 0; --i) {
 			/// If @f$ b_i = s @f$
@@ -94,12 +119,13 @@ namespace SecureFaceRecognitionUtils {
 				
 				if (s == 0) {
 					/// @f$ [c] = [c - 1 + \sigma] = [c] [-1] [\sigma] @f$
-					c = c - this->dgkCryptoProvider.GetEncryptedOne(false) + sigma;
+					c = c + encryptedMinusOne + sigma;
 				}
 
-				/// @f$ [e_i] = ([c]^{R_i})_{re-rand}@f$
-				e.emplace_front(c * blindingFactorContainer.R[i + 1]);//the indexes in R are shifted by one
-				e.front() = this->dgkCryptoProvider.RandomizeCiphertext(e.front());
+				/// @f$ [e_i] = ([c]^{R_i})_{re-rand}@f$ (after the blinding)
+				e.emplace_front(c);
+				blindingExponents.push_back(blindingFactorContainer.R[i + 1]);//the indexes in R are shifted by one
+				blindedPositions.push_back(e.size());
 			}
 			else {
 				/// @f$ [e_i] = [R_i] @f$
@@ -107,7 +133,7 @@ namespace SecureFaceRecognitionUtils {
 			}
 			
 			/// @f$ [\sigma] = [\sigma] xor([\hat{d}_{i}], \hat{r}_{i}) @f$
-			sigma = sigma + (hatRBits[i] == 0 ? hatDBits[i] : (this->dgkCryptoProvider.GetEncryptedOne(false) - hatDBits[i]));
+			sigma = sigma + xorBits[i];
 		}
 
 		/**
@@ -122,9 +148,20 @@ namespace SecureFaceRecognitionUtils {
 			e.emplace_front(blindingFactorContainer.encryptedR[0]);//the indexes in encryptedR are shifted by one
 		}
 		else {
-			/// @f$ [e_{-1}] = ([\sigma]^{R_{-1}})_{re-rand}@f$
-			e.emplace_front(sigma * blindingFactorContainer.R[0]);//the indexes in R are shifted by one
-			e.front() = this->dgkCryptoProvider.RandomizeCiphertext(e.front());//is this really necessary?
+			/// @f$ [e_{-1}] = ([\sigma]^{R_{-1}})_{re-rand}@f$ (after the blinding)
+			e.emplace_front(sigma);
+			blindingExponents.push_back(blindingFactorContainer.R[0]);//the indexes in R are shifted by one
+			blindedPositions.push_back(e.size());
+		}
+
+		/// Blind all the collected @f$ [c_i] @f$ values together and re-randomize them
+		blindingBases.reserve(blindedPositions.size());
+		for (size_t i = 0; i < blindedPositions.size(); ++i) {
+			blindingBases.push_back(e[e.size() - blindedPositions[i]]);
+		}
+		std::vector<Dgk::Ciphertext> blindedValues = this->dgkCryptoProvider.BatchMultiply(blindingBases, blindingExponents);
+		for (size_t i = 0; i < blindedPositions.size(); ++i) {
+			e[e.size() - blindedPositions[i]] = this->dgkCryptoProvider.RandomizeCiphertext(blindedValues[i]);
 		}
 
 		/// Apply a random permutation to vector @f$ e @f$
@@ -141,6 +178,18 @@ namespace SecureFaceRecognitionUtils {
 		return lambda;
 	}
 
+	/**
+	Each comparison consumes one blinding factor container and re-randomizes the blinded @f$ [e_i] @f$ values.
+	Their number depends on @f$ s @f$ and @f$ \hat{r} @f$, so the plan reserves the upper bound of @f$ l + 1 @f$ randomizers per comparison.
+
+	@param plan the precomputation plan
+	@param comparisonCount the number of calls to ComputeLambda
+	*/
+	void DgkComparisonServer::PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount) {
+		plan.Add("DGK comparison blinding factors", this->blindingFactorCache, comparisonCount);
+		plan.AddRandomizers("DGK comparison server randomizers", this->dgkCryptoProvider, comparisonCount * (this->l + 1));
+	}
+
 	/**
 	@param dgkComparisonClient a DgkComparisonClient instance
 	*/
@@ -36,6 +36,7 @@ limitations under the License.
 #include "core/paillier.h"
 #include "core/dgk.h"
 #include "core/secure_permutation.h"
+#include "core/precomputation_plan.h"
 
 #include "dgk_comparison_blinding_factor_container.h"
 #include "dgk_comparison_blinding_factor_cache_parameters.h"
@@ -62,7 +63,10 @@ namespace SecureFaceRecognitionUtils {
 		~DgkComparisonServer () {}
 
 		/// Compute @f$ \lambda @f$
-		Paillier::Ciphertext ComputeLambda (const std::deque<long> &hatRBits, const BigInteger &s);
+		Paillier::Ciphertext ComputeLambda (const std::deque<long> &hatRBits, const long s);
+
+		/// Adds the blinding factors and randomizers consumed by comparisonCount comparisons to the plan
+		void PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount);
 
 		/// Setter for this->dgkComparisonClient
 		void SetClient (const std::shared_ptr<DgkComparisonClient> & dgkComparisonClient);
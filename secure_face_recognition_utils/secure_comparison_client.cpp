@@ -59,6 +59,18 @@ namespace SecureFaceRecognitionUtils {
 		return this->paillierCryptoProvider.EncryptInteger(-plaintextDModTwoPowL);
 	}
 
+	/**
+	Each comparison encrypts @f$ -(d \pmod {2^l}) @f$, plus the randomizers of the DGK comparison.
+
+	@param plan the precomputation plan
+	@param comparisonCount the number of comparisons
+	*/
+	void SecureComparisonClient::PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount) const {
+		plan.AddRandomizers("Secure comparison client randomizers", this->paillierCryptoProvider, comparisonCount);
+
+		this->dgkComparisonClient->PlanComparisons(plan, comparisonCount);
+	}
+
 	/**
 	@param secureComparisonServer a SecureComparisonServer instance
 	*/
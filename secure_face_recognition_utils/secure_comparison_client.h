@@ -35,6 +35,7 @@ limitations under the License.
 #include "core/random_provider.h"
 #include "core/paillier.h"
 #include "core/dgk.h"
+#include "core/precomputation_plan.h"
 
 #include "dgk_comparison_client.h"
 
@@ -59,6 +60,9 @@ namespace SecureFaceRecognitionUtils {
 		/// Computes @f$ [-(d \pmod {2^l})] @f$
 		Paillier::Ciphertext ComputeMinusDModTwoPowL (const Paillier::Ciphertext &d) const;
 
+		/// Adds the randomizers consumed by comparisonCount comparisons to the plan
+		void PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount) const;
+
 		/// Setter for this->secureComparisonServer
 		void SetServer (const std::shared_ptr<SecureComparisonServer> &secureComparisonServer);
 
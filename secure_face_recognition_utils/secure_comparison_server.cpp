@@ -85,13 +85,13 @@ namespace SecureFaceRecognitionUtils {
 		*/
 
 		/// Choose random @f$ s \in {0, 1} @f$
-		BigInteger s = RandomProvider::GetInstance().GetRandomInteger(1);
+		long s = RandomBitSource::GetInstance().GetBit() ? 1 : 0;
 		
 		/*
 		std::cout << "z: "; this->secureComparisonClient.lock()->DebugPaillierEncryption(z);
 		std::cout << "d%2^l: "; this->secureComparisonClient.lock()->DebugPaillierEncryption(this->paillierCryptoProvider.HomomorphicMultiply(minusDModTwoPowL, -1)); 
 		std::cout << "r%2^l: "; this->secureComparisonClient.lock()->DebugPaillierEncryption(blindingFactorContainer.encryptedRModTwoPowL);
-		std::cout << "s:" << s.ToString(10) << std::endl;
+		std::cout << "s:" << s << std::endl;
 		*/
 
 		/// Compute @f$ \lambda @f$
@@ -105,6 +105,19 @@ namespace SecureFaceRecognitionUtils {
 		return y;
 	}
 
+	/**
+	Each comparison consumes one blinding factor container and re-randomizes @f$ [d] @f$, plus the blinding factors and randomizers of the DGK comparison.
+
+	@param plan the precomputation plan
+	@param comparisonCount the number of calls to Compare
+	*/
+	void SecureComparisonServer::PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount) {
+		plan.Add("Secure comparison blinding factors", this->blindingFactorCache, comparisonCount);
+		plan.AddRandomizers("Secure comparison server randomizers", this->paillierCryptoProvider, comparisonCount);
+
+		this->dgkComparisonServer->PlanComparisons(plan, comparisonCount);
+	}
+
 	/**
 	@param secureComparisonClient a SecureComparisonClient instance
 	*/
@@ -33,9 +33,11 @@ limitations under the License.
 #include "utils/config.h"
 #include "core/big_integer.h"
 #include "core/random_provider.h"
+#include "core/random_bit_source.h"
 #include "core/paillier.h"
 #include "core/dgk.h"
 #include "core/randomizer_cache.h"
+#include "core/precomputation_plan.h"
 
 #include "comparison_blinding_factor_container.h"
 #include "comparison_blinding_factor_cache_parameters.h"
@@ -62,6 +64,9 @@ namespace SecureFaceRecognitionUtils {
 		/// Interactive secure comparison
 		Paillier::Ciphertext Compare (const Paillier::Ciphertext &a, const Paillier::Ciphertext &b);
 
+		/// Adds the blinding factors and randomizers consumed by comparisonCount comparisons to the plan
+		void PlanComparisons (PrecomputationPlan &plan, const size_t comparisonCount);
+
 		/// Setter for this->secureComparisonClient
 		void SetClient (const std::shared_ptr<SecureComparisonClient> & secureComparisonClient);
 
@@ -59,6 +59,9 @@ namespace SecureRecommendations {
 		/// Generate keys
 		this->cryptoProvider.GenerateKeys();
 
+		/// Traffic is measured in serialized ciphertexts
+		this->ciphertextBitSize = static_cast<unsigned long>(8 * Paillier::Ciphertext::GetSerializedSize(this->cryptoProvider.GetEncryptionModulus()));
+
 		/// Set the kernel
 		this->kernel = SecureSvm::GetKernel(Utils::Config::GetInstance().GetParameter<std::string>("SecureRecommendations.kernel"));
 
@@ -128,28 +131,27 @@ namespace SecureRecommendations {
 
 	Replaces the contents of input with @f$ [1] @f$ if @f$ input[i] \geq 0 @f$ or @f$ [0] @f$ otherwise
 
+	The values are decrypted and the results re-randomized with the batch operations of the crypto provider.
+
 	@param input the encrypted SVM values
 	*/
 	void Hub::EvaluateSign (SecureSvm::EncryptedVector &input) const {
+		if (this->measureTraffic) {
+			Hub::bitsReceived += this->ciphertextBitSize * static_cast<unsigned long>(input.size());
+		}
+
+		/// Decrypt the values
+		std::vector<BigInteger> decryptedValues = this->cryptoProvider.DecryptBatch(input);
+
 		for (size_t i = 0; i < input.size(); ++i) {
-			if (this->measureTraffic) {
-				Hub::bitsReceived += static_cast<unsigned long>(input[i].data.GetSize());
-			}
+			input[i] = decryptedValues[i] >= 0 ? this->cryptoProvider.GetEncryptedOne(false) : this->cryptoProvider.GetEncryptedZero(false);
+		}
 
-			/// Decrypt the value
-			BigInteger decryptedValue = this->cryptoProvider.DecryptInteger(input[i]);
-			
-			/// Populate the vector received from the server with RE-RANDOMIZED [0]s and [1]s
-			if (decryptedValue >= 0) {
-				input[i] = this->cryptoProvider.GetEncryptedOne();
-			}
-			else {
-				input[i] = this->cryptoProvider.GetEncryptedZero();
-			}
+		/// Populate the vector received from the server with RE-RANDOMIZED [0]s and [1]s
+		input = this->cryptoProvider.RandomizeBatch(input);
 
-			if (this->measureTraffic) {
-				Hub::bitsSent += static_cast<unsigned long>(input[i].data.GetSize());
-			}
+		if (this->measureTraffic) {
+			Hub::bitsSent += this->ciphertextBitSize * static_cast<unsigned long>(input.size());
 		}
 	}
 
@@ -164,46 +166,43 @@ namespace SecureRecommendations {
 	*/
 	void Hub::EvaluateMaximum (SecureSvm::EncryptedVector &input) const {
 		if (this->measureTraffic) {
-			for (SecureSvm::EncryptedVector::const_iterator i = input.begin(); i != input.end(); ++i) {
-				Hub::bitsReceived += static_cast<unsigned long>((*i).data.GetSize());
-			}
+			Hub::bitsReceived += this->ciphertextBitSize * static_cast<unsigned long>(input.size());
 		}
 
+		/// Decrypt the values
+		std::vector<BigInteger> values = this->cryptoProvider.DecryptBatch(input);
+
 		/// Set the maximum as the first value
-		BigInteger maximum = this->cryptoProvider.DecryptInteger(input[0]);
 		//store the index of the maximum value
 		size_t index = 0;
-		//set the fist value to [0] (we'll update it later to [1], if this turns out to be the real maximum)
-		input[0] = this->cryptoProvider.GetEncryptedZero();//do not precompute this!
 
 		//detect if the maximum value occurs more than once in the input data
 		bool uniqueMaximumValue = true;
 
 		/// Compare maximum with the other values to determine the real maximum
-		for (size_t i = 1; i < input.size(); ++i) {
-			//decrypt the current value
-			BigInteger value = this->cryptoProvider.DecryptInteger(input[i]);
-
-			if (maximum == value) {
+		for (size_t i = 1; i < values.size(); ++i) {
+			if (values[index] == values[i]) {
 				uniqueMaximumValue = false;
 			}
-			else if (maximum < value) {
-				maximum = value;
+			else if (values[index] < values[i]) {
 				index = i;
 				uniqueMaximumValue = true;//reset this flag if we update the maximum
 			}
+		}
 
-			//set all the values to [0]
-			input[i] = this->cryptoProvider.GetEncryptedZero();//do not precompute this!
+		//set all the values to [0]
+		for (size_t i = 0; i < input.size(); ++i) {
+			input[i] = this->cryptoProvider.GetEncryptedZero(false);
 		}
 
 		// Set [1] at the index where the first occurence of the maximum was found, but only if the maximum is unique
-		if (uniqueMaximumValue) input[index] = this->cryptoProvider.GetEncryptedOne();//do not precompute this!
+		if (uniqueMaximumValue && !input.empty()) input[index] = this->cryptoProvider.GetEncryptedOne(false);
+
+		//every element is re-randomized, so the results are not precomputed values
+		input = this->cryptoProvider.RandomizeBatch(input);
 
 		if (this->measureTraffic) {
-			for (SecureSvm::EncryptedVector::const_iterator i = input.begin(); i != input.end(); ++i) {
-				Hub::bitsSent += static_cast<unsigned long>((*i).data.GetSize());
-			}
+			Hub::bitsSent += this->ciphertextBitSize * static_cast<unsigned long>(input.size());
 		}
 	}
 
@@ -212,21 +211,27 @@ namespace SecureRecommendations {
 
 	Decrypts the received denominators, computes @f$ 1 / D_i @f$, reencrypts and sets the results back in the input vector.
 
+	The denominators are decrypted and the results encrypted with the batch operations of the crypto provider.
+
 	@param numerator the value of the numerator
 	@param input the encrypted denominators. Will be overwritten by the encrypted results of the division
 	*/
 	void Hub::EvaluateDivision (const BigInteger &numerator, SecureSvm::EncryptedVector &input) const {
+		if (this->measureTraffic) {
+			Hub::bitsReceived += this->ciphertextBitSize * static_cast<unsigned long>(input.size());
+		}
+
+		std::vector<BigInteger> quotients = this->cryptoProvider.DecryptBatch(input);
+
 		/// Perform division
-		for (size_t i = 0; i < input.size(); ++i) {
-			if (this->measureTraffic) {
-				Hub::bitsReceived += static_cast<unsigned long>(input[i].data.GetSize());
-			}
+		for (size_t i = 0; i < quotients.size(); ++i) {
+			quotients[i] = numerator / quotients[i];
+		}
 
-			input[i] = this->cryptoProvider.EncryptInteger(numerator / this->cryptoProvider.DecryptInteger(input[i]));
+		input = this->cryptoProvider.EncryptBatch(quotients);
 
-			if (this->measureTraffic) {
-				Hub::bitsSent += static_cast<unsigned long>(input[i].data.GetSize());
-			}
+		if (this->measureTraffic) {
+			Hub::bitsSent += this->ciphertextBitSize * static_cast<unsigned long>(input.size());
 		}
 	}
 
@@ -310,7 +315,7 @@ namespace SecureRecommendations {
 			/// Simulate client decryption and processing of the received data (but do not store it...)
 			for (size_t j = 0; j < firstTwoBlocksPredictions.size(); ++j) {
 				if (this->measureTraffic) {
-					Hub::bitsReceived += static_cast<unsigned long>(firstTwoBlocksPredictions[j].data.GetSize()) + static_cast<unsigned long>(safetyBlockPredictions[j].data.GetSize());
+					Hub::bitsReceived += 2 * this->ciphertextBitSize;
 				}
 
 				this->cryptoProvider.DecryptInteger(firstTwoBlocksPredictions[j]) * this->cryptoProvider.DecryptInteger(safetyBlockPredictions[j]);
@@ -371,18 +376,15 @@ namespace SecureRecommendations {
 
 			/// In a real scenario, we only have a single test data file, so we don't want to count the medical safety test files
 			if (this->measureTraffic) {
-				for (SecureSvm::EncryptedVector::const_iterator i = this->medicalRelevanceTestData.back().x.begin(); i != this->medicalRelevanceTestData.back().x.end(); ++i)
-					Hub::bitsSent += static_cast<unsigned long>((*i).data.GetSize());
-				for (SecureSvm::EncryptedVector::const_iterator i = this->medicalRelevanceTestData.back().xx.begin(); i != this->medicalRelevanceTestData.back().xx.end(); ++i)
-					Hub::bitsSent += static_cast<unsigned long>((*i).data.GetSize());
-				for (SecureSvm::EncryptedVector::const_iterator i = this->medicalRelevanceTestData.back().xSquared.begin(); i != this->medicalRelevanceTestData.back().xSquared.end(); ++i)
-					Hub::bitsSent += static_cast<unsigned long>((*i).data.GetSize());
+				Hub::bitsSent += this->ciphertextBitSize * static_cast<unsigned long>(this->medicalRelevanceTestData.back().x.size());
+				Hub::bitsSent += this->ciphertextBitSize * static_cast<unsigned long>(this->medicalRelevanceTestData.back().xx.size());
+				Hub::bitsSent += this->ciphertextBitSize * static_cast<unsigned long>(this->medicalRelevanceTestData.back().xSquared.size());
 			}
 
 			this->server->GetPerformancePredictions(firstTwoBlocksPredictions, safetyBlockPredictions, this->medicalRelevanceTestData[i], this->safetyTestData[i]);
 
 			for (size_t j = 0; j < firstTwoBlocksPredictions.size(); ++j) {
-				Hub::bitsReceived += static_cast<unsigned long>(firstTwoBlocksPredictions[j].data.GetSize()) + static_cast<unsigned long>(safetyBlockPredictions[j].data.GetSize());
+				Hub::bitsReceived += 2 * this->ciphertextBitSize;
 			}
 
 			totalBitsSent += Hub::bitsSent;
@@ -140,6 +140,9 @@ namespace SecureRecommendations {
 		/// Enables traffic profiling
 		static bool measureTraffic;
 
+		/// The number of bits of a serialized ciphertext (see Paillier::Ciphertext::Serialize)
+		unsigned long ciphertextBitSize;
+
 		/// Counts the numbe of bits sent to the server
 		static BigInteger bitsSent;
 
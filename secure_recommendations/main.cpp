@@ -46,6 +46,9 @@ int main (int argc, char *argv[]) {
 			Utils::Config::SetConfigFile(std::string(argv[1]));
 		}
 
+		/// Install the GMP memory pool, if enabled (before any big integers are allocated)
+		Core::GmpMemoryPool::Initialize();
+
 		/// Initialize the hub and the server
 		std::shared_ptr<Hub> hub = std::make_shared<Hub>();
 		std::shared_ptr<Server> server = std::make_shared<Server>(hub->GetPublicKey());
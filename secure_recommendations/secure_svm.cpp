@@ -186,6 +186,29 @@ namespace SecureRecommendations {
 		return this->safetyModelUnsafeClasses;
 	}
 
+	/**
+	Without exponentiation tables, the elements are only wrapped, so HomomorphicDotProduct computes all their terms with a single multi-exponentiation.
+
+	@param input a vector of encrypted data
+	@param buildTables build the exponentiation tables (with the Core.PrecomputedCiphertext settings) for the elements which are used often enough (defaults to true)
+	@return A vector containing a PrecomputedCiphertext for each element of input
+	*/
+	SecureSvm::PrecomputedVector SecureSvm::Precompute (const SecureSvm::EncryptedVector &input, const bool buildTables) {
+		SecureSvm::PrecomputedVector output;
+		output.reserve(input.size());
+
+		for (SecureSvm::EncryptedVector::const_iterator i = input.begin(); i != input.end(); ++i) {
+			if (buildTables) {
+				output.emplace_back(*i);
+			}
+			else {
+				output.emplace_back(*i, 0, 0);
+			}
+		}
+
+		return output;
+	}
+
 	/**
 	Evaluates the encrypted prediction function, @f$ [f(x)] @f$
 
@@ -198,6 +221,9 @@ namespace SecureRecommendations {
 	Where @f$ a_i^* = \frac{a_i}{m} @f$, @f$ b^* = \frac{b}{m} @f$ and @f$ m = min(min(a_i), b) @f$. Also, @f$ t @f$ is the number of SV.
 	
 	If the sign of the labels produced by libsvm is reversed, then the signs of @f$ a_i @f$ and @f$ b @f$ are reversed during preprocessing. See preprocessData() for details.
+
+	x and xx are wrapped with Precompute() for the duration of the call. Only x gets exponentiation tables: xx holds @f$ k (k + 1) / 2 @f$ elements, whose tables would
+	take up to @f$ k (k + 1) / 2 @f$ times the Core.PrecomputedCiphertext.memoryBudget.
 	
 	@param x the encrypted attribute vector
 	@param xx the encrypted attribute vector product combinations, @f$ x_i x_j @f$, stored as an unraveled upper triangular matrix (defaults to SecureSvm::nullVector)
@@ -206,42 +232,47 @@ namespace SecureRecommendations {
 	@throw std::runtime_error Invalid kernel type.
 	*/
 	Paillier::Ciphertext SecureSvm::Predict (const SecureSvm::EncryptedVector &x, const SecureSvm::EncryptedVector &xx, const SecureSvm::EncryptedVector &xSquared) const {
+		return this->Predict(SecureSvm::Precompute(x), SecureSvm::Precompute(xx, false), xSquared);
+	}
+
+	/**
+	Each element of x and xx is raised to a different model weight for every support vector, so the exponentiation tables of the precomputed ciphertexts are amortized even within a single SVM.
+	Passing the same precomputed vectors to several SVMs reuses the tables across all of them.
+
+	@param x the precomputed encrypted attribute vector
+	@param xx the precomputed encrypted attribute vector product combinations, @f$ x_i x_j @f$, stored as an unraveled upper triangular matrix (may be empty if the kernel does not require it)
+	@param xSquared the encrypted squared attribute vector (defaults to SecureSvm::nullVector)
+	@return The encrypted value of the kernel
+	@throw std::runtime_error Invalid kernel type.
+	*/
+	Paillier::Ciphertext SecureSvm::Predict (const SecureSvm::PrecomputedVector &x, const SecureSvm::PrecomputedVector &xx, const SecureSvm::EncryptedVector &xSquared) const {
 		/// Initialize the accumulator with [0] for the homomorphic addition to work!!!
 		Paillier::Ciphertext output = this->encryptedZero;
 
-		//stores the values for the inverse quadratic RBF kernel
-		SecureSvm::EncryptedVector inverseQuadraticRbfKernelValues;
+		//stores the kernel values (for the inverse quadratic RBF kernel, the denominators are replaced with the actual kernel values later)
+		SecureSvm::EncryptedVector kernelValues;
 
 		//iterate over the model rows (vectors)
 		for (size_t i = 0; i < this->aVector.size(); ++i) {
-			Paillier::Ciphertext encryptedKernelValue;
-
 			//compute kernel
 			switch (this->kernel) {
 				case SecureSvm::linear:
-					encryptedKernelValue = this->linearKernel(x, this->sMatrix[i]);
+					kernelValues.emplace_back(this->linearKernel(x, this->sMatrix[i]));
 					break;
 				case SecureSvm::homogeneousPolynomial:
-					encryptedKernelValue = this->homogeneousPolynomialKernel(xx, this->twoGammaSquaredSSMatrix[i]);
+					kernelValues.emplace_back(this->homogeneousPolynomialKernel(xx, this->twoGammaSquaredSSMatrix[i]));
 					break;
 				case SecureSvm::inhomogeneousPolynomial:
-					encryptedKernelValue = this->inhomogeneousPolynomialKernel(x, xx, this->twoGammaSMatrix[i], this->twoGammaSquaredSSMatrix[i]);
+					kernelValues.emplace_back(this->inhomogeneousPolynomialKernel(x, xx, this->twoGammaSMatrix[i], this->twoGammaSquaredSSMatrix[i]));
 					break;
 				case SecureSvm::inverseQuadraticRBF:
 					/// Compute @f$ (1 + c d) @f$ for the inverse quadratic RBF kernel and use an interactive protocol to produce the actual kernel values
-					inverseQuadraticRbfKernelValues.emplace_back(this->computeInverseQuadraticRbfKernelDenominator(x, xSquared, this->minusTwoSMatrix[i], encryptedSSquaredMatrix[i]));
+					kernelValues.emplace_back(this->computeInverseQuadraticRbfKernelDenominator(x, xSquared, this->minusTwoSMatrix[i], encryptedSSquaredMatrix[i]));
 					break;
 				default:
 					/// @todo Throw a custom error here
 					throw std::runtime_error("Invalid kernel type.");
 			}
-			
-			/// Compute @f$ \prod_i{([K(s_i, x)]^{a_i})} @f$
-
-			//compute this separately for the inverse quadratic RBF kernel
-			if (SecureSvm::inverseQuadraticRBF != this->kernel) {
-				output = output + encryptedKernelValue * this->aVector[i];
-			}
 		}
 
 		/// The inverse quadratic RBF kernel requires an interactive protocol to compute the kernel values
@@ -252,24 +283,15 @@ namespace SecureRecommendations {
 			//std::cout << "numerator:" << this->inverseQuadraticRbfNumerator.ToString(10) << std::endl;
 
 			//replace the denominator values with the actual kernel values
-			this->server.lock()->InteractiveSecureDivision(this->inverseQuadraticRbfNumerator, inverseQuadraticRbfKernelValues);
-
-			for (size_t i = 0; i < this->aVector.size(); ++i) {
-				//debug
-				//this->server.lock()->DebugValue(inverseQuadraticRbfKernelValues[i]);
-				//std::cout << this->aVector[i].ToString(10).c_str() << std::endl;
-
-				output = output + inverseQuadraticRbfKernelValues[i] * this->aVector[i];
+			this->server.lock()->InteractiveSecureDivision(this->inverseQuadraticRbfNumerator, kernelValues);
+		}
 
-				//debug
-				//this->server.lock()->DebugValue(this->cryptoProvider.HomomorphicMultiply(inverseQuadraticRbfKernelValues[i], this->aVector[i]));
-				//this->server.lock()->DebugValue(output);
-			}
+		/// Compute @f$ \prod_i{([K(s_i, x)]^{a_i})} @f$ with a single multi-exponentiation
+		output = output + this->cryptoProvider.HomomorphicDotProduct(kernelValues, this->aVector);
 
-			//debug
-			//this->server.lock()->DebugValue(output);
-			//this->server.lock()->DebugValue(this->encryptedB);
-		}
+		//debug
+		//this->server.lock()->DebugValue(output);
+		//this->server.lock()->DebugValue(this->encryptedB);
 
 		output = output + this->encryptedB;
 
@@ -547,20 +569,9 @@ namespace SecureRecommendations {
 	@param s a model vector
 	@return The encrypted value of the kernel
 	*/
-	Paillier::Ciphertext SecureSvm::linearKernel (const SecureSvm::EncryptedVector &x, const SecureSvm::ModelVector &s) const {
-		/// Initialize the accumulator with [0] for the homomorphic addition to work!!!
-		Paillier::Ciphertext output = this->encryptedZero;
-
-		for (size_t i = 0; i < s.size(); ++i) {
-			//debug
-			/*
-			this->server.lock()->DebugValue(x[i]);
-			std::cout << s[i].ToString(10) << std::endl;
-			*/
-			output = output + x[i] * s[i];
-		}
-		
-		return output;
+	Paillier::Ciphertext SecureSvm::linearKernel (const SecureSvm::PrecomputedVector &x, const SecureSvm::ModelVector &s) const {
+		/// Add [0] to the result, such that it does not depend only on the randomness of x
+		return this->encryptedZero + this->cryptoProvider.HomomorphicDotProduct(x, s);
 	}
 
 	/**
@@ -576,13 +587,9 @@ namespace SecureRecommendations {
 	@param twoGammaSquaredSS the model weights vector product combinations, @f$ 2 \gamma^2 s_i s_j @f$, where @f$ i \neq j @f$ and @f$ \gamma^2 s_i s_j @f$, where @f$ i = j @f$, stored as an unraveled upper triangular matrix
 	@return The encrypted value of the kernel
 	*/
-	Paillier::Ciphertext SecureSvm::homogeneousPolynomialKernel (const SecureSvm::EncryptedVector &xx, const SecureSvm::ModelVector &twoGammaSquaredSS) const {
-		/// Initialize the accumulator with [0] for the homomorphic addition to work!
-		Paillier::Ciphertext output = this->encryptedZero;
-
-		for (size_t i = 0; i < xx.size(); ++i) {
-			output = output + xx[i] * twoGammaSquaredSS[i];
-		}
+	Paillier::Ciphertext SecureSvm::homogeneousPolynomialKernel (const SecureSvm::PrecomputedVector &xx, const SecureSvm::ModelVector &twoGammaSquaredSS) const {
+		/// Add [0] to the result, such that it does not depend only on the randomness of xx
+		Paillier::Ciphertext output = this->encryptedZero + this->cryptoProvider.HomomorphicDotProduct(xx, twoGammaSquaredSS);
 	
 	#if 0
 		/* previous algorithm with complex index logic. Now, we just do sum(2*(xi xj)(si sj)) if i != j and sum((xi xj)(si sj)) if i==j in the encrypted domain */
@@ -627,7 +634,7 @@ namespace SecureRecommendations {
 	@param twoGammaSquaredSS the model weights vector product combinations, @f$ 2 \gamma^2 s_i s_j @f$, where @f$ i \neq j @f$ and @f$ \gamma^2 s_i s_j @f$, where @f$ i = j @f$, stored as an unraveled upper triangular matrix
 	@return The encrypted value of the kernel
 	*/
-	Paillier::Ciphertext SecureSvm::inhomogeneousPolynomialKernel (const SecureSvm::EncryptedVector &x, const SecureSvm::EncryptedVector &xx, const SecureSvm::ModelVector &twoGammaS, const SecureSvm::ModelVector &twoGammaSquaredSS) const {
+	Paillier::Ciphertext SecureSvm::inhomogeneousPolynomialKernel (const SecureSvm::PrecomputedVector &x, const SecureSvm::PrecomputedVector &xx, const SecureSvm::ModelVector &twoGammaS, const SecureSvm::ModelVector &twoGammaSquaredSS) const {
 		//leverage the homogeneousPolynomialKernel and linearKernel implementations to simplify the formula
 		return this->homogeneousPolynomialKernel(xx, twoGammaSquaredSS) + this->linearKernel(x, twoGammaS) + this->encryptedScaledOne;
 	}
@@ -654,12 +661,12 @@ namespace SecureRecommendations {
 	@param encryptedSSquared @f$ [s_i^2] @f$
 	@return The encrypted value of the kernel
 	*/
-	Paillier::Ciphertext SecureSvm::computeInverseQuadraticRbfKernelDenominator (const SecureSvm::EncryptedVector &x, const SecureSvm::EncryptedVector &xSquared, const SecureSvm::ModelVector &minusTwoS, const SecureSvm::EncryptedVector &encryptedSSquared) const {
-		Paillier::Ciphertext encryptedDenominator = this->encryptedZero;
+	Paillier::Ciphertext SecureSvm::computeInverseQuadraticRbfKernelDenominator (const SecureSvm::PrecomputedVector &x, const SecureSvm::EncryptedVector &xSquared, const SecureSvm::ModelVector &minusTwoS, const SecureSvm::EncryptedVector &encryptedSSquared) const {
+		/// Compute @f$ \prod_{j=1}^f([x_j \cdot sc_f]^{-2 \cdot s_{i,j} \cdot sc_f}) @f$ with a single multi-exponentiation
+		Paillier::Ciphertext encryptedDenominator = this->encryptedZero + this->cryptoProvider.HomomorphicDotProduct(x, minusTwoS);
 
 		for (size_t i = 0; i < x.size(); ++i) {
-			encryptedDenominator = encryptedDenominator + xSquared[i] + x[i] * minusTwoS[i] + encryptedSSquared[i];
-
+			encryptedDenominator = encryptedDenominator + xSquared[i] + encryptedSSquared[i];
 		}
 
 		/// Compute [1 + c d], where c is gamma
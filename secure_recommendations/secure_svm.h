@@ -33,6 +33,7 @@ limitations under the License.
 #include "utils/config.h"
 #include "core/big_integer.h"
 #include "core/paillier.h"
+#include "core/precomputed_ciphertext.h"
 
 //include 3rd party libraries
 #include "libsvm/svm.h"
@@ -61,6 +62,9 @@ namespace SecureRecommendations {
 		/// Define a vector template specialization for vectors of encrypted data
 		typedef std::vector<Paillier::Ciphertext> EncryptedVector;
 
+		/// Define a vector template specialization for vectors of encrypted data which are multiplied with many different scalars
+		typedef std::vector<PrecomputedCiphertext<Paillier::Ciphertext>> PrecomputedVector;
+
 		/// Use this to pass a NULL vector to the Predict method;
 		static const EncryptedVector nullVector;
 
@@ -79,9 +83,15 @@ namespace SecureRecommendations {
 		/// Returns the unsafe classes of safety block SVMs
 		const std::string &GetUnsafeClasses () const;
 
+		/// Wraps each element of the input in a PrecomputedCiphertext
+		static PrecomputedVector Precompute (const SecureSvm::EncryptedVector &input, const bool buildTables = true);
+
 		/// Computes the prediction for a given set of data
 		Paillier::Ciphertext Predict (const SecureSvm::EncryptedVector &x, const SecureSvm::EncryptedVector &xx = SecureSvm::nullVector, const SecureSvm::EncryptedVector &xSquared = SecureSvm::nullVector) const;
 
+		/// Computes the prediction for a given set of data (the precomputed vectors can be shared by several SVMs)
+		Paillier::Ciphertext Predict (const SecureSvm::PrecomputedVector &x, const SecureSvm::PrecomputedVector &xx, const SecureSvm::EncryptedVector &xSquared = SecureSvm::nullVector) const;
+
 	private:
 		/// The crypto provider
 		Paillier cryptoProvider;
@@ -170,16 +180,16 @@ namespace SecureRecommendations {
 		void preprocessData ();
 
 		/// Computes the linear kernel on encrypted data
-		Paillier::Ciphertext linearKernel (const SecureSvm::EncryptedVector &x, const SecureSvm::ModelVector &s) const;
+		Paillier::Ciphertext linearKernel (const SecureSvm::PrecomputedVector &x, const SecureSvm::ModelVector &s) const;
 
 		/// Computes the second degree polynomial kernel on encrypted data
-		Paillier::Ciphertext homogeneousPolynomialKernel (const SecureSvm::EncryptedVector &xx, const SecureSvm::ModelVector &twoGammaSquaredSS) const;
+		Paillier::Ciphertext homogeneousPolynomialKernel (const SecureSvm::PrecomputedVector &xx, const SecureSvm::ModelVector &twoGammaSquaredSS) const;
 
 		/// Computes the second degree polynomial kernel on encrypted data
-		Paillier::Ciphertext inhomogeneousPolynomialKernel (const SecureSvm::EncryptedVector &x, const SecureSvm::EncryptedVector &xx, const SecureSvm::ModelVector &twoGammaS, const SecureSvm::ModelVector &twoGammaSquaredSS) const;
+		Paillier::Ciphertext inhomogeneousPolynomialKernel (const SecureSvm::PrecomputedVector &x, const SecureSvm::PrecomputedVector &xx, const SecureSvm::ModelVector &twoGammaS, const SecureSvm::ModelVector &twoGammaSquaredSS) const;
 
 		/// Computes the inverse quadratic RBF kernel d values on encrypted data
-		Paillier::Ciphertext computeInverseQuadraticRbfKernelDenominator (const SecureSvm::EncryptedVector &x, const SecureSvm::EncryptedVector &xSquared, const SecureSvm::ModelVector &minusTwoS, const SecureSvm::EncryptedVector &encryptedSSquared) const;
+		Paillier::Ciphertext computeInverseQuadraticRbfKernelDenominator (const SecureSvm::PrecomputedVector &x, const SecureSvm::EncryptedVector &xSquared, const SecureSvm::ModelVector &minusTwoS, const SecureSvm::EncryptedVector &encryptedSSquared) const;
 
 		/// Copy constructor - not implemented
 		SecureSvm (SecureSvm const &);
@@ -119,15 +119,15 @@ namespace SecureRecommendations {
 	void Server::InteractiveSecureDivision (const BigInteger &numerator, SecureSvm::EncryptedVector &denominators) const {
 		std::vector<BigInteger> blindingFactors;
 
-		/// Blind the encrypted denominators. Store the blinding factors.
+		/// Generate the blinding factors.
 		for (size_t i = 0; i < denominators.size(); ++i) {
 			/// @f$ r_i @f$ must always be > 0!
 			blindingFactors.emplace_back(RandomProvider::GetInstance().GetRandomInteger(this->blindingFactorSize) + 1);
-
-			//blind the encrypted denominators
-			denominators[i] = denominators[i] * blindingFactors.back();
 		}
 
+		/// Blind the encrypted denominators (all the exponentiations are computed together).
+		denominators = this->cryptoProvider.BatchMultiply(denominators, blindingFactors);
+
 		/// Get a random permutation
 		SecurePermutation permutation(denominators.size());
 		
@@ -141,12 +141,12 @@ namespace SecureRecommendations {
 		permutation.InvertPermutation(denominators);
 
 		/// Undo the blinding
-		for (size_t i = 0; i < denominators.size(); ++i) {
-			//debug kernel values
-			//this->client.lock()->DebugValue(denominators[i]);
+		//debug kernel values
+		//for (size_t i = 0; i < denominators.size(); ++i) {
+		//	this->client.lock()->DebugValue(denominators[i]);
+		//}
 
-			denominators[i] = denominators[i] * blindingFactors[i];
-		}
+		denominators = this->cryptoProvider.BatchMultiply(denominators, blindingFactors);
 	}
 
 	/**
@@ -168,22 +168,33 @@ namespace SecureRecommendations {
 		Server::EncryptedSvmValues svmPredictions;
 
 		/// First, we evaluate all the medical relevance SVMs
+		/// The attribute vectors are shared by all the SVMs, so we precompute them only once (the exponentiation tables are built after the first few uses)
+		/// The quadratic number of x_i x_j products doesn't get exponentiation tables, since their total size would grow with the square of the attribute count
+		SecureSvm::PrecomputedVector medicalRelevanceX = SecureSvm::Precompute(medicalRelevanceTestData.x);
+		SecureSvm::PrecomputedVector medicalRelevanceXX = SecureSvm::Precompute(medicalRelevanceTestData.xx, false);
 		
 		for (size_t i = 0; i < this->medicalRelevanceSvms.size(); ++i) {
 			//debug
 			//std::string start = Utils::DateTime::Now();
-			svmPredictions.emplace_back(this->medicalRelevanceSvms[i]->Predict(medicalRelevanceTestData.x, medicalRelevanceTestData.xx, medicalRelevanceTestData.xSquared));
+			svmPredictions.emplace_back(this->medicalRelevanceSvms[i]->Predict(medicalRelevanceX, medicalRelevanceXX, medicalRelevanceTestData.xSquared));
 			//std::cout << "medical" << i << ": "; this->client.lock()->DebugValue(svmPredictions.back());
 			//std::cout << "start: " << start << " end: " << Utils::DateTime::Now() << " SVM: " << i << std::endl;
 		}
 		
 		/// We also evaluate the safety SVMs (we will pop these out later, because we want to perform the interactive sign evaluation in a single step)
+		/// The precomputed attribute vectors are kept for each set of unsafe classes, such that SVMs which share the test data also share the exponentiation tables
+		std::map<std::string, std::pair<SecureSvm::PrecomputedVector, SecureSvm::PrecomputedVector>> precomputedSafetyTestData;
 		for (size_t i = 0; i < this->safetySvms.size(); ++i) {
 			std::map<std::string, TestDataRow>::const_iterator safetyTestDataIterator = safetyTestData.find(safetySvms[i]->GetUnsafeClasses());
 			if (safetyTestData.end() != safetyTestDataIterator) {
+				std::map<std::string, std::pair<SecureSvm::PrecomputedVector, SecureSvm::PrecomputedVector>>::iterator precomputedIterator = precomputedSafetyTestData.find(safetyTestDataIterator->first);
+				if (precomputedSafetyTestData.end() == precomputedIterator) {
+					precomputedIterator = precomputedSafetyTestData.emplace(safetyTestDataIterator->first, std::make_pair(SecureSvm::Precompute(safetyTestDataIterator->second.x), SecureSvm::Precompute(safetyTestDataIterator->second.xx, false))).first;
+				}
+
 				//debug
 				//std::string start = Utils::DateTime::Now();
-				svmPredictions.emplace_back(this->safetySvms[i]->Predict((*safetyTestDataIterator).second.x, (*safetyTestDataIterator).second.xx, (*safetyTestDataIterator).second.xSquared));
+				svmPredictions.emplace_back(this->safetySvms[i]->Predict(precomputedIterator->second.first, precomputedIterator->second.second, (*safetyTestDataIterator).second.xSquared));
 				//std::cout << safetyTestDataIterator->first << ": "; this->client.lock()->DebugValue(svmPredictions.back());
 				//std::cout << "start: " << start << " end: " << Utils::DateTime::Now() << " SVM: " << i << " nSV: " << this->safetySvms[i]->model->l << std::endl;
 			}
@@ -236,18 +247,16 @@ namespace SecureRecommendations {
 		/// Evaluate the medical relevance votes and the safety prediction
 		this->GetAccuracyPredictions(clusterVotes, safetyPredictions, medicalRelevanceTestData, safetyTestData);
 
+		/// The content item value does not depend on the cluster, so @f$ \prod_j [vote_j]^{c_i} = (\prod_j [vote_j])^{c_i} @f$ and the votes need to be added only once
+		Paillier::Ciphertext totalVotes = this->encryptedZero;
+		for (unsigned long j = 0; j < this->medicalRelevanceClusterCount; ++j) {
+			totalVotes = totalVotes + clusterVotes[j];
+		}
+
 		/// Compute the outptut of the first two blocks
 		for (unsigned long i = 0; i < this->contentItemCount; ++i) {
-			//initialize the accumulator
-			Paillier::Ciphertext result = this->encryptedZero;
-
-			for (unsigned long j = 0; j < this->medicalRelevanceClusterCount; ++j) {
-				//multiply the content items with the cluster votes and add the products
-				result = result + clusterVotes[j] * this->dummyContentItems[i];
-			}
-
-			//combine the medical relevance and the preferences block
-			firstTwoBlocksPredictions.emplace_back(result + this->dummyEncryptedPreferenceScores[i]);
+			//multiply the content items with the cluster votes and combine the medical relevance and the preferences block
+			firstTwoBlocksPredictions.emplace_back(this->encryptedZero + totalVotes * this->dummyContentItems[i] + this->dummyEncryptedPreferenceScores[i]);
 		}
 	}
 
@@ -324,6 +333,9 @@ namespace SecureRecommendations {
 	Server::EncryptedClusterVotes Server::getTotalClusterVotes (EncryptedSvmValues &votes) const {
 		Server::EncryptedClusterVotes clusterVotes;
 
+		/// Each vote is used exactly once as prediction(i, j) = 1 - prediction(j, i), so all the complements are computed up front with a single modular inversion
+		EncryptedSvmValues complementaryVotes = this->cryptoProvider.BatchSubtract(this->encryptedOne, votes);
+
 		/// We want to compute the sum of elements on each column, so we iterate over the lines in the inner loop
 		for (unsigned int i = 0; i < this->medicalRelevanceClusterCount; ++i) {
 			//initialize the vote accumulator to [0]
@@ -349,7 +361,7 @@ namespace SecureRecommendations {
 						index = j * (medicalRelevanceClusterCount - 1) - (j - 1) * j / 2 + i - (j + 1);
 
 						//prediction(i, j) = 1 - prediction(j, i)
-						clusterVotes[i] = clusterVotes[i] + this->encryptedOne - votes[index];
+						clusterVotes[i] = clusterVotes[i] + complementaryVotes[index];
 					}
 				}
 			}//i
@@ -45,11 +45,393 @@ int main (int argc, char *argv[]) {
 			Utils::Config::SetConfigFile(std::string(argv[1]));
 		}
 
+		//the worker pool is started on first use (e.g. by the decryption tables); run the jobs on several threads even on single core machines
+		Utils::Config::GetInstance().SetParameter("Core.WorkerPool.threadCount", 4);
+
+		std::cout << "Testing the GMP memory pool." << std::endl;
+		{
+			GmpMemoryPool::Install(64 * 1024);
+			assert(GmpMemoryPool::IsInstalled());
+
+			bool exceptionThrown = false;
+			try {
+				GmpMemoryPool::Install(64 * 1024);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("Installing the GMP memory pool twice was not rejected.");
+			}
+
+			GmpMemoryPool::ResetCounters();
+			for (int i = 0; i < 10; ++i) {
+				BigInteger a = (BigInteger(1) << 1000) + i;
+				BigInteger b = a * a;
+				assert(b % a == 0);
+				assert(b / a == a);
+			}
+			assert(GmpMemoryPool::GetCounters().allocations + GmpMemoryPool::GetCounters().reallocations > 0);
+			assert(GmpMemoryPool::GetCounters().deallocations > 0);
+			assert(GmpMemoryPool::GetCounters().allocatedBytes > 0);
+			//the temporaries of the first iteration are reused by the following ones
+			assert(GmpMemoryPool::GetCounters().poolHits > 0);
+
+			GmpMemoryPool::ResetCounters();
+			assert(GmpMemoryPool::GetCounters().allocations == 0 && GmpMemoryPool::GetCounters().poolHits == 0);
+
+			GmpMemoryPool::Uninstall();
+			assert(!GmpMemoryPool::IsInstalled());
+			BigInteger c = (BigInteger(1) << 1000) * 3;
+			assert(GmpMemoryPool::GetCounters().allocations == 0);
+		}
+
 		Paillier paillierCryptoProvider;
 		OkamotoUchiyama okamotoUchiyamaCryptoProvider;
 		Dgk dgkCryptoProvider(true);//pre-compute decryption map (keep Dgk.l reasonably small for this test)
 		ElGamal elGamalCryptoProvider(true);//pre-compute decryption map (keep ElGamal.messageSpaceThresholdBitSize reasonably small for this test)
 
+		std::cout << "Testing BigInteger move semantics and (fused) modular arithmetic." << std::endl;
+		{
+			BigInteger a(12345);
+			BigInteger b(std::move(a));
+			assert(b == 12345);
+			a = BigInteger(7);
+			assert(a == 7);
+			b = std::move(a);
+			assert(b == 7);
+			assert((BigInteger(10) + b) == 17);
+			assert((BigInteger(10) - b) == 3);
+			assert((BigInteger(10) * b) == 70);
+			assert((BigInteger(70) / b) == 10);
+			assert((BigInteger(75) % b) == 5);
+			assert(-BigInteger(5) == -5);
+			BigInteger c(5);
+			assert(c.AddModN(4, b) == 2);
+			assert(c.SubtractModN(3, b) == 6);
+			assert(c.MultiplyModN(6, b) == 1);
+
+			BigInteger d;
+			BigInteger::MulModN(d, BigInteger(5), BigInteger(6), b);
+			assert(d == 2);
+			BigInteger::SquareModN(d, d, b);
+			assert(d == 4);
+			BigInteger::PowMulModN(d, d, BigInteger(3), BigInteger(2), b);
+			assert(d == 1);
+			BigInteger::MulAddModN(d, BigInteger(3), BigInteger(4), d, b);
+			assert(d == 6);
+			BigInteger::MulAddModN(d, d, d, BigInteger(1), b);
+			assert(d == 2);
+
+			std::vector<BigInteger> bases, exponents;
+			assert(BigInteger::MultiPowModN(bases, exponents, b) == 1);
+			bases.push_back(3);
+			exponents.push_back(4);
+			bases.push_back(5);
+			exponents.push_back(-1);
+			bases.push_back(2);
+			exponents.push_back(0);
+			//3^4 * 5^-1 * 2^0 = 4 * 3 * 1 (mod 7)
+			assert(BigInteger::MultiPowModN(bases, exponents, b) == 5);
+
+			//compare against the term by term computation for larger operands
+			BigInteger n = RandomProvider::GetInstance().GetRandomInteger(1024).SetBit(1023).SetBit(0);
+			bases.clear();
+			exponents.clear();
+			BigInteger expected(1);
+			for (size_t i = 0; i < 20; ++i) {
+				bases.push_back(RandomProvider::GetInstance().GetRandomInteger(n));
+				exponents.push_back(RandomProvider::GetInstance().GetRandomInteger(i * 10 + 1));
+				expected.MultiplyModN(bases.back().GetPowModN(exponents.back(), n), n);
+			}
+			assert(BigInteger::MultiPowModN(bases, exponents, n) == expected);
+		}
+
+		std::cout << "Testing thread-local random providers." << std::endl;
+		{
+			const size_t threadCount = 4;
+			std::vector<const void *> instances(threadCount);
+			std::vector<BigInteger> values(threadCount);
+
+			std::vector<std::thread> threads;
+			for (size_t i = 0; i < threadCount; ++i) {
+				threads.emplace_back([&instances, &values, i] () {
+					instances[i] = &RandomProvider::GetInstance();
+					//the same instance is returned for every call from the same thread
+					assert(instances[i] == &RandomProvider::GetInstance());
+					values[i] = RandomProvider::GetInstance().GetRandomInteger(256);
+				});
+			}
+			for (size_t i = 0; i < threadCount; ++i) {
+				threads[i].join();
+			}
+
+			//each thread has its own, independently seeded, instance
+			for (size_t i = 0; i < threadCount; ++i) {
+				assert(instances[i] != &RandomProvider::GetInstance());
+				for (size_t j = i + 1; j < threadCount; ++j) {
+					assert(values[i] != values[j]);
+				}
+			}
+		}
+
+		std::cout << "Testing the ChaCha20 random provider." << std::endl;
+		{
+			RandomProviderBase<RandomProviderChaCha20> &randomProvider = RandomProviderBase<RandomProviderChaCha20>::GetInstance();
+
+			BigInteger maximumValue(1000);
+			for (size_t i = 0; i < 1000; ++i) {
+				BigInteger value = randomProvider.GetRandomInteger(maximumValue);
+				assert(value >= 0 && value < maximumValue);
+				assert(randomProvider.GetRandomInteger(13).GetSize() <= 13);
+			}
+			assert(randomProvider.GetRandomInteger(0) == 0);
+			assert(randomProvider.GetMaxLengthRandomPrime(128).GetSize() == 128);
+
+			//requests larger than the keystream buffer, followed by buffered requests
+			std::vector<unsigned char> first(3 * RANDOM_PROVIDER_CHACHA20_BUFFER_SIZE + 5);
+			std::vector<unsigned char> second(first.size());
+			randomProvider.GetRandomBytes(&first[0], first.size());
+			randomProvider.GetRandomBytes(&second[0], second.size());
+			assert(first != second);
+
+			//RFC 8439 known-answer vector: block 0 of the all-zero key and nonce, generated by both implementations
+			const unsigned char expectedBlock[64] = {
+				0x76, 0xb8, 0xe0, 0xad, 0xa0, 0xf1, 0x3d, 0x90, 0x40, 0x5d, 0x6a, 0xe5, 0x53, 0x86, 0xbd, 0x28,
+				0xbd, 0xd2, 0x19, 0xb8, 0xa0, 0x8d, 0xed, 0x1a, 0xa8, 0x36, 0xef, 0xcc, 0x8b, 0x77, 0x0d, 0xc7,
+				0xda, 0x41, 0x59, 0x7c, 0x51, 0x57, 0x48, 0x8d, 0x77, 0x24, 0xe0, 0x3f, 0xb8, 0xd8, 0x4a, 0x37,
+				0x6a, 0x43, 0xb8, 0xf4, 0x15, 0x18, 0xa1, 0x1c, 0xc3, 0x87, 0xb6, 0x69, 0xb2, 0xee, 0x65, 0x86};
+			const uint32_t zeroKey[RANDOM_PROVIDER_CHACHA20_KEY_SIZE / 4] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+			std::vector<unsigned char> portableBlocks(8 * 64);
+			RandomProviderChaCha20::GenerateBlocksPortable(&portableBlocks[0], zeroKey, 0, 8);
+			if (!std::equal(expectedBlock, expectedBlock + 64, portableBlocks.begin())) {
+				throw std::runtime_error("The portable ChaCha20 implementation does not match the RFC 8439 test vector.");
+			}
+
+			if (RandomProviderChaCha20::IsAvx2Available()) {
+				std::vector<unsigned char> avx2Blocks(8 * 64);
+				RandomProviderChaCha20::GenerateBlocksAvx2(&avx2Blocks[0], zeroKey, 0, 8);
+				if (!std::equal(expectedBlock, expectedBlock + 64, avx2Blocks.begin()) || avx2Blocks != portableBlocks) {
+					throw std::runtime_error("The AVX2 ChaCha20 implementation does not match the RFC 8439 test vector.");
+				}
+			}
+
+			bool exceptionThrown = false;
+			try {
+				randomProvider.GetRandomInteger(BigInteger(0));
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("Drawing a random integer below 0 was not rejected.");
+			}
+		}
+
+		std::cout << "Testing the random bit source." << std::endl;
+		{
+			RandomBitSource &randomBitSource = RandomBitSource::GetInstance();
+			assert(&randomBitSource == &RandomBitSource::GetInstance());
+
+			//more than one pool of bits, so that the pool is refilled
+			size_t setBits = 0;
+			const size_t bitCount = 64 * RANDOM_BIT_SOURCE_POOL_SIZE * 4;
+			for (size_t i = 0; i < bitCount; ++i) {
+				if (randomBitSource.GetBit()) {
+					++setBits;
+				}
+			}
+			//the expected value is bitCount / 2 (the standard deviation is 64)
+			assert(setBits > bitCount / 2 - 640 && setBits < bitCount / 2 + 640);
+
+			for (size_t i = 1; i < 64; ++i) {
+				assert(randomBitSource.GetBits(i) < (static_cast<uint64_t>(1) << i));
+			}
+			assert(randomBitSource.GetBits(64) != randomBitSource.GetBits(64));
+
+			bool exceptionThrown = false;
+			try {
+				randomBitSource.GetBits(65);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("Drawing more than 64 random bits was not rejected.");
+			}
+		}
+
+		std::cout << "Testing the sieved prime search." << std::endl;
+		{
+			const size_t sizes[] = {2, 5, 31, 32, 64, 160, 512};
+			for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+				BigInteger prime = PrimeSearch::GetMaxLengthRandomPrime(sizes[i]);
+				assert(prime.GetSize() == sizes[i]);
+				assert(prime.IsPrime());
+			}
+
+			//DGK: p = 2 u v x + 1, where x is prime
+			BigInteger x;
+			BigInteger multiplier = BigInteger(2) * BigInteger(2).GetPow(21).GetNextPrime() * PrimeSearch::GetMaxLengthRandomPrime(160);
+			BigInteger p = PrimeSearch::GetLinearFormPrime(x, multiplier, 300, true);
+			assert(x.GetSize() == 300 && x.IsPrime());
+			assert(p == multiplier * x + 1 && p.IsPrime());
+
+			//Okamoto-Uchiyama: p = t x + 1, where t is an odd prime and x is any (even) integer
+			BigInteger t = PrimeSearch::GetMaxLengthRandomPrime(160);
+			p = PrimeSearch::GetLinearFormPrime(x, t, 200, false);
+			assert(x.GetSize() == 200 && x.GetBit(0) == 0);
+			assert(p == t * x + 1 && p.IsPrime());
+
+			//small x, tested without sieving
+			p = PrimeSearch::GetLinearFormPrime(x, t * 2, 16, true);
+			assert(x.GetSize() == 16 && x.IsPrime() && p == t * 2 * x + 1 && p.IsPrime());
+
+			bool exceptionThrown = false;
+			try {
+				PrimeSearch::GetMaxLengthRandomPrime(1);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("A prime of 1 bit was not rejected.");
+			}
+
+			//p = t x + 1 would be even for any odd prime x
+			exceptionThrown = false;
+			try {
+				PrimeSearch::GetLinearFormPrime(x, t, 200, true);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("An odd prime x for an odd t was not rejected.");
+			}
+		}
+
+		std::cout << "Testing fixed-base exponentiation tables." << std::endl;
+		{
+			BigInteger n = RandomProvider::GetInstance().GetRandomInteger(1024).SetBit(1023).SetBit(0);
+			//n is not prime, so make sure that the base is invertible (required by the negative exponents)
+			BigInteger base;
+			do {
+				base = RandomProvider::GetInstance().GetRandomInteger(n);
+			}
+			while (BigInteger::Gcd(base, n) != 1);
+
+			FixedBaseTable table(base, n, 320, 256 * 1024);
+			assert(!table.IsEmpty());
+			assert(FixedBaseTable::GetTableSize(n, 320, table.GetWindowSize()) <= 256 * 1024);
+			assert(table.GetPowModN(0) == 1);
+			assert(table.GetPowModN(1) == base);
+			for (size_t i = 0; i < 20; ++i) {
+				BigInteger power = RandomProvider::GetInstance().GetRandomInteger(320);
+				assert(table.GetPowModN(power) == base.GetPowModN(power, n));
+			}
+
+			//negative and oversized exponents, as well as empty tables, fall back to the regular exponentiation
+			BigInteger power = RandomProvider::GetInstance().GetRandomInteger(640);
+			assert(table.GetPowModN(-power) == base.GetPowModN(-power, n));
+			assert(table.GetPowModN(power) == base.GetPowModN(power, n));
+			FixedBaseTable emptyTable(base, n, 320, 0);
+			assert(emptyTable.IsEmpty());
+			assert(emptyTable.GetPowModN(power) == base.GetPowModN(power, n));
+		}
+
+		std::cout << "Testing decryption tables." << std::endl;
+		{
+			BigInteger p = RandomProvider::GetInstance().GetRandomInteger(512).SetBit(511).GetNextPrime();
+			BigInteger base = RandomProvider::GetInstance().GetRandomInteger(p);
+
+			//the negative exponents use the inverse of the base
+			DecryptionTable table(base, p, -2000, 5000);
+			assert(!table.IsEmpty());
+			assert(!table.IsMapped());
+			BigInteger residue = base.GetPowModN(-2000, p);
+			long exponent;
+			for (long i = -2000; i < 3000; ++i) {
+				if (!table.Find(residue, exponent) || exponent != i) {
+					throw std::runtime_error("The decryption table doesn't return the exponents of the powers of the base.");
+				}
+				BigInteger::MulModN(residue, residue, base, p);
+			}
+			assert(!table.Find(residue, exponent));
+			assert(!DecryptionTable().Find(1, exponent));
+
+			//the second table with the same parameters is mapped from the cache file
+			boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+			boost::filesystem::create_directories(directory);
+			{
+				DecryptionTable cachedTable(base, p, -2000, 5000, directory.string());
+				assert(!cachedTable.IsMapped());
+				assert(boost::filesystem::exists(DecryptionTable::GetPath(directory.string(), base, p, -2000, 5000)));
+			#if !defined(_WIN32)
+				//the cache file is only accessible by its owner
+				assert(0 == (boost::filesystem::status(DecryptionTable::GetPath(directory.string(), base, p, -2000, 5000)).permissions() & (boost::filesystem::group_all | boost::filesystem::others_all)));
+			#endif
+			}
+			DecryptionTable mappedTable(base, p, -2000, 5000, directory.string());
+			assert(mappedTable.IsMapped());
+			for (long i = -2000; i < 3000; i += 7) {
+				if (!mappedTable.Find(base.GetPowModN(BigInteger(i), p), exponent) || exponent != i) {
+					throw std::runtime_error("The mapped decryption table doesn't return the exponents of the powers of the base.");
+				}
+			}
+			assert(!mappedTable.Find(base.GetPowModN(3000, p), exponent));
+
+			//a table with different parameters gets its own file
+			assert(!DecryptionTable(base, p, 0, 5000, directory.string()).IsMapped());
+
+			boost::filesystem::remove_all(directory);
+		}
+
+		std::cout << "Testing the baby-step giant-step solver." << std::endl;
+		{
+			BigInteger p = RandomProvider::GetInstance().GetRandomInteger(512).SetBit(511).GetNextPrime();
+			BigInteger base = RandomProvider::GetInstance().GetRandomInteger(p);
+
+			//37 baby steps for the default range [-1000, 5000]
+			BabyStepGiantStep solver(base, p, -1000, 5000, 37);
+			assert(!solver.IsEmpty());
+			assert(solver.GetBabyStepCount() == 37);
+			long exponent;
+			for (long i = -1000; i <= 5000; i += 13) {
+				assert(solver.Find(base.GetPowModN(BigInteger(i), p), exponent));
+				assert(exponent == i);
+			}
+			assert(solver.Find(base.GetPowModN(5000, p), exponent));
+			assert(exponent == 5000);
+			assert(!solver.Find(base.GetPowModN(5001, p), exponent));
+
+			//bounded ranges, inside and outside the default range
+			assert(solver.Find(base.GetPowModN(1234, p), 1200, 1300, exponent));
+			assert(exponent == 1234);
+			assert(!solver.Find(base.GetPowModN(1234, p), 1235, 1300, exponent));
+			assert(solver.Find(base.GetPowModN(BigInteger(-5000), p), -5000, -4000, exponent));
+			assert(exponent == -5000);
+			assert(solver.Find(base.GetPowModN(100000, p), 99990, 100010, exponent));
+			assert(exponent == 100000);
+
+			//the baby steps are capped by the size of the default range, in which case a lookup is a single probe
+			assert(BabyStepGiantStep(base, p, -10, 10, 0).GetBabyStepCount() == 21);
+			assert(BabyStepGiantStep(base, p, -10, 10, 100).GetBabyStepCount() == 21);
+			assert(!BabyStepGiantStep().Find(1, exponent));
+
+			bool exceptionThrown = false;
+			try {
+				solver.Find(1, 10, 9, exponent);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("Reversed bounds were not rejected.");
+			}
+		}
+
 		std::cout << "Generating keys for every crypto provider." << std::endl;
 		paillierCryptoProvider.GenerateKeys();
 		okamotoUchiyamaCryptoProvider.GenerateKeys();
@@ -156,6 +538,615 @@ int main (int argc, char *argv[]) {
 			assert(elGamalCryptoProvider.DecryptInteger(prod) == x * y);
 		}
 
+		std::cout << "Testing homomorphic dot products." << std::endl;
+		{
+			std::vector<BigInteger> scalars;
+			scalars.push_back(3);
+			scalars.push_back(-2);
+			scalars.push_back(0);
+			scalars.push_back(5);
+
+			std::vector<Paillier::Ciphertext> paillierCiphertexts;
+			std::vector<ElGamal::Ciphertext> elGamalCiphertexts;
+			for (long i = 0; i < 4; ++i) {
+				paillierCiphertexts.push_back(paillierCryptoProvider.EncryptInteger(BigInteger(i - 1)));
+				elGamalCiphertexts.push_back(elGamalCryptoProvider.EncryptInteger(BigInteger(i - 1)));
+			}
+
+			//-1 * 3 + 0 * -2 + 1 * 0 + 2 * 5
+			assert(paillierCryptoProvider.DecryptInteger(paillierCryptoProvider.HomomorphicDotProduct(paillierCiphertexts, scalars)) == 7);
+			assert(elGamalCryptoProvider.DecryptInteger(elGamalCryptoProvider.HomomorphicDotProduct(elGamalCiphertexts, scalars)) == 7);
+			assert(dgkCryptoProvider.DecryptInteger(dgkCryptoProvider.HomomorphicDotProduct(std::vector<Dgk::Ciphertext>(1, dgkCryptoProvider.EncryptInteger(x)), std::vector<BigInteger>(1, y))) == x * y);
+		}
+
+		std::cout << "Testing precomputed ciphertexts." << std::endl;
+		{
+			//build the table after the second multiplication
+			PrecomputedCiphertext<Paillier::Ciphertext> precomputed(paillierCryptoProvider.EncryptInteger(x), 2, 64 * 1024);
+			assert(paillierCryptoProvider.DecryptInteger(precomputed * y) == x * y);
+			assert(paillierCryptoProvider.DecryptInteger(precomputed * BigInteger(1000)) == x * 1000);
+			assert(!precomputed.IsPrecomputed());
+			assert(paillierCryptoProvider.DecryptInteger(precomputed * BigInteger(-7)) == x * -7);
+			assert(precomputed.IsPrecomputed());
+			assert(paillierCryptoProvider.DecryptInteger(precomputed * BigInteger(999)) == x * 999);
+			//larger than the table
+			assert(paillierCryptoProvider.DecryptInteger(precomputed * BigInteger(1000000)) == x * 1000000);
+
+			std::vector<PrecomputedCiphertext<Paillier::Ciphertext>> precomputedCiphertexts;
+			for (long i = 0; i < 4; ++i) {
+				precomputedCiphertexts.emplace_back(paillierCryptoProvider.EncryptInteger(BigInteger(i - 1)), 0, 64 * 1024);
+			}
+			std::vector<BigInteger> scalars;
+			scalars.push_back(3);
+			scalars.push_back(-2);
+			scalars.push_back(0);
+			scalars.push_back(5);
+			assert(paillierCryptoProvider.DecryptInteger(paillierCryptoProvider.HomomorphicDotProduct(precomputedCiphertexts, scalars)) == 7);
+
+			//the terms without a table, or larger than their table, share one multi-exponentiation
+			precomputedCiphertexts.emplace_back(paillierCryptoProvider.EncryptInteger(BigInteger(4)), 0, 0);
+			scalars.push_back(-3);
+			assert(paillierCryptoProvider.DecryptInteger(paillierCryptoProvider.HomomorphicDotProduct(precomputedCiphertexts, scalars)) == -5);
+			assert(precomputedCiphertexts[0].IsPrecomputed() && !precomputedCiphertexts[4].IsPrecomputed());
+			scalars[0] = 1000000;
+			assert(paillierCryptoProvider.DecryptInteger(paillierCryptoProvider.HomomorphicDotProduct(precomputedCiphertexts, scalars)) == -1000002);
+		}
+
+		std::cout << "Testing batch negation and subtraction." << std::endl;
+		{
+			std::vector<BigInteger> values;
+			values.push_back(2);
+			values.push_back(3);
+			values.push_back(6);
+			std::vector<BigInteger> inverses = BigInteger::BatchInverseModN(values, BigInteger(7));
+			assert(inverses.size() == 3 && inverses[0] == 4 && inverses[1] == 5 && inverses[2] == 6);
+			assert(BigInteger::BatchInverseModN(std::vector<BigInteger>(), BigInteger(7)).empty());
+
+			std::vector<Paillier::Ciphertext> paillierLhs, paillierRhs;
+			std::vector<Dgk::Ciphertext> dgkRhs;
+			std::vector<ElGamal::Ciphertext> elGamalLhs, elGamalRhs;
+			for (long i = 0; i < 3; ++i) {
+				paillierLhs.push_back(paillierCryptoProvider.EncryptInteger(BigInteger(i)));
+				paillierRhs.push_back(paillierCryptoProvider.EncryptInteger(y + i));
+				dgkRhs.push_back(dgkCryptoProvider.EncryptInteger(BigInteger(i)));
+				elGamalLhs.push_back(elGamalCryptoProvider.EncryptInteger(BigInteger(i)));
+				elGamalRhs.push_back(elGamalCryptoProvider.EncryptInteger(x + i));
+			}
+
+			std::vector<Paillier::Ciphertext> paillierNegated = paillierCryptoProvider.BatchNegate(paillierRhs);
+			std::vector<Paillier::Ciphertext> paillierDifferences = paillierCryptoProvider.BatchSubtract(paillierLhs, paillierRhs);
+			std::vector<Dgk::Ciphertext> dgkDifferences = dgkCryptoProvider.BatchSubtract(dgkCryptoProvider.GetEncryptedOne(), dgkRhs);
+			std::vector<ElGamal::Ciphertext> elGamalNegated = elGamalCryptoProvider.BatchNegate(elGamalLhs);
+			std::vector<ElGamal::Ciphertext> elGamalDifferences = elGamalCryptoProvider.BatchSubtract(elGamalLhs, elGamalRhs);
+			for (long i = 0; i < 3; ++i) {
+				assert(paillierCryptoProvider.DecryptInteger(paillierNegated[i]) == -(y + i));
+				assert(paillierCryptoProvider.DecryptInteger(paillierDifferences[i]) == BigInteger(i) - (y + i));
+				assert(dgkCryptoProvider.DecryptInteger(dgkDifferences[i]) == BigInteger(1 - i));
+				assert(elGamalCryptoProvider.DecryptInteger(elGamalNegated[i]) == BigInteger(-i));
+				assert(elGamalCryptoProvider.DecryptInteger(elGamalDifferences[i]) == BigInteger(i) - (x + i));
+			}
+		}
+
+		std::cout << "Testing binary serialization." << std::endl;
+		{
+			unsigned char bytes[16];
+			BigInteger(0x0102).Export(bytes, 3);
+			assert(bytes[0] == 0x02 && bytes[1] == 0x01 && bytes[2] == 0x00);
+			assert(BigInteger().Import(bytes, 3) == 0x0102);
+			assert(BigInteger(0x0102).GetByteSize() == 2);
+
+			BigInteger a = (BigInteger(1) << 127) + 12345;
+			a.Export(bytes, 16);
+			assert(BigInteger().Import(bytes, 16) == a);
+			BigInteger(0).Export(bytes, 16);
+			assert(BigInteger(5).Import(bytes, 16) == 0);
+
+			bool exceptionThrown = false;
+			try {
+				a.Export(bytes, 15);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("An export into a short buffer was not rejected.");
+			}
+
+			std::vector<Paillier::Ciphertext> paillierCiphertexts;
+			std::vector<Dgk::Ciphertext> dgkCiphertexts;
+			for (long i = -2; i < 3; ++i) {
+				paillierCiphertexts.push_back(paillierCryptoProvider.EncryptInteger(BigInteger(i)));
+				dgkCiphertexts.push_back(dgkCryptoProvider.EncryptInteger(BigInteger(i)));
+			}
+
+			std::vector<unsigned char> buffer;
+			Paillier::Ciphertext::Serialize(paillierCiphertexts, buffer);
+			assert(buffer.size() == paillierCiphertexts.size() * Paillier::Ciphertext::GetSerializedSize(paillierCryptoProvider.GetEncryptionModulus()));
+			std::vector<Paillier::Ciphertext> paillierOutput;
+			Paillier::Ciphertext::Deserialize(buffer, paillierCiphertexts.front().GetEncryptionModulus(), paillierOutput);
+			//deserialize again, in place
+			Paillier::Ciphertext::Deserialize(buffer, paillierCiphertexts.front().GetEncryptionModulus(), paillierOutput);
+			assert(paillierOutput.size() == paillierCiphertexts.size());
+			for (size_t i = 0; i < paillierOutput.size(); ++i) {
+				assert(paillierOutput[i].data == paillierCiphertexts[i].data);
+				assert(paillierCryptoProvider.DecryptInteger(paillierOutput[i] + paillierOutput[i]) == 2 * (static_cast<long>(i) - 2));
+			}
+
+			Dgk::Ciphertext::Serialize(dgkCiphertexts, buffer);
+			std::vector<Dgk::Ciphertext> dgkOutput;
+			Dgk::Ciphertext::Deserialize(buffer, dgkCiphertexts.front().GetEncryptionModulus(), dgkOutput);
+			for (size_t i = 0; i < dgkOutput.size(); ++i) {
+				assert(dgkCryptoProvider.DecryptInteger(dgkOutput[i]) == static_cast<long>(i) - 2);
+			}
+
+			Paillier::Ciphertext::Serialize(std::vector<Paillier::Ciphertext>(), buffer);
+			assert(buffer.empty());
+		}
+
+		std::cout << "Testing batch modular multiplication and exponentiation." << std::endl;
+		{
+			//the Paillier n^2, a 2048 bit odd modulus (vectorized when the CPU supports it) and a small modulus (always computed one by one)
+			std::vector<BigInteger> moduli;
+			moduli.push_back(paillierCryptoProvider.GetEncryptionModulus());
+			moduli.push_back((BigInteger(1) << 2047) + (RandomProvider::GetInstance().GetRandomInteger(2040) << 1) + 1);
+			moduli.push_back(BigInteger(1000003));
+
+			//partial and multiple batches
+			const size_t counts[] = {1, 3, 9, 17};
+
+			for (size_t k = 0; k < moduli.size(); ++k) {
+				const BigInteger &n = moduli[k];
+
+				for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c) {
+					std::vector<BigInteger> lhs, rhs, exponents;
+					for (size_t i = 0; i < counts[c]; ++i) {
+						lhs.push_back(RandomProvider::GetInstance().GetRandomInteger(n.GetSize() + 8));
+						rhs.push_back(RandomProvider::GetInstance().GetRandomInteger(n.GetSize()));
+						exponents.push_back(RandomProvider::GetInstance().GetRandomInteger((i + 1) * 24));
+					}
+
+					//edge cases: n - 1, 0, 0 exponent and negative values
+					lhs[0] = n - 1;
+					rhs[0] = n - 1;
+					if (counts[c] > 2) {
+						lhs[1] = 0;
+						exponents[1] = 0;
+						lhs[2] = -lhs[2];
+					}
+
+					std::vector<const BigInteger *> lhsPointers, rhsPointers, exponentPointers;
+					for (size_t i = 0; i < counts[c]; ++i) {
+						lhsPointers.push_back(&lhs[i]);
+						rhsPointers.push_back(&rhs[i]);
+						exponentPointers.push_back(&exponents[i]);
+					}
+
+					std::vector<BigInteger> products = BigInteger::BatchMulModN(lhsPointers, rhsPointers, n);
+					std::vector<BigInteger> powers = BigInteger::BatchPowModN(lhsPointers, exponentPointers, n);
+					assert(products.size() == counts[c] && powers.size() == counts[c]);
+
+					for (size_t i = 0; i < counts[c]; ++i) {
+						BigInteger expected;
+						BigInteger::MulModN(expected, lhs[i], rhs[i], n);
+						assert(products[i] == expected);
+						assert(powers[i] == lhs[i].GetPowModN(exponents[i], n));
+					}
+				}
+			}
+
+			std::vector<Paillier::Ciphertext> paillierLhs, paillierRhs;
+			std::vector<ElGamal::Ciphertext> elGamalLhs, elGamalRhs;
+			std::vector<BigInteger> scalars;
+			for (long i = 0; i < 9; ++i) {
+				paillierLhs.push_back(paillierCryptoProvider.EncryptInteger(BigInteger(i)));
+				paillierRhs.push_back(paillierCryptoProvider.EncryptInteger(y + i));
+				elGamalLhs.push_back(elGamalCryptoProvider.EncryptInteger(BigInteger(i)));
+				elGamalRhs.push_back(elGamalCryptoProvider.EncryptInteger(x + i));
+				scalars.push_back(BigInteger(i + 1));
+			}
+
+			std::vector<Paillier::Ciphertext> paillierSums = paillierCryptoProvider.BatchAdd(paillierLhs, paillierRhs);
+			std::vector<Paillier::Ciphertext> paillierProducts = paillierCryptoProvider.BatchMultiply(paillierRhs, scalars);
+			std::vector<ElGamal::Ciphertext> elGamalSums = elGamalCryptoProvider.BatchAdd(elGamalLhs, elGamalRhs);
+			std::vector<ElGamal::Ciphertext> elGamalProducts = elGamalCryptoProvider.BatchMultiply(elGamalLhs, scalars);
+			for (long i = 0; i < 9; ++i) {
+				assert(paillierCryptoProvider.DecryptInteger(paillierSums[i]) == y + 2 * i);
+				assert(paillierCryptoProvider.DecryptInteger(paillierProducts[i]) == (y + i) * (i + 1));
+				assert(elGamalCryptoProvider.DecryptInteger(elGamalSums[i]) == x + 2 * i);
+				assert(elGamalCryptoProvider.DecryptInteger(elGamalProducts[i]) == BigInteger(i * (i + 1)));
+			}
+		}
+
+		std::cout << "Testing the randomizer cache." << std::endl;
+		{
+			typedef RandomizerCache<RandomizerContainer<Paillier, RandomizerCacheParameters>> PaillierRandomizerCache;
+
+			RandomizerCacheParameters parameters("Core.RandomizerCache");
+			parameters.lowWaterMark = 25;
+
+			//filled by the constructor, refilled by 2 blocking producers, refilled by 1 non-blocking producer and no cache at all
+			const size_t capacities[] = {16, 16, 16, 0};
+			const size_t producerThreadCounts[] = {0, 2, 1, 0};
+			const bool blockWhenEmpty[] = {true, true, false, true};
+			const size_t popCount = 48;
+
+			for (size_t i = 0; i < sizeof(capacities) / sizeof(capacities[0]); ++i) {
+				parameters.capacity = capacities[i];
+				parameters.producerThreadCount = producerThreadCounts[i];
+				parameters.blockWhenEmpty = blockWhenEmpty[i];
+
+				PaillierRandomizerCache cache(paillierCryptoProvider, parameters);
+
+				//randomizers are never reused
+				std::set<std::string> randomizers;
+				for (size_t j = 0; j < popCount; ++j) {
+					randomizers.insert(cache.Pop().randomizer.data.ToString(16));
+				}
+				assert(randomizers.size() == popCount);
+
+				PaillierRandomizerCache::Metrics metrics = cache.GetMetrics();
+				bool consistent = metrics.capacity == capacities[i] && metrics.depth <= metrics.capacity && metrics.consumed + metrics.inlineGenerated == popCount;
+				if (0 == producerThreadCounts[i]) {
+					consistent = consistent && metrics.consumed == capacities[i] && metrics.stalls == popCount - capacities[i];
+				}
+				else if (blockWhenEmpty[i]) {
+					consistent = consistent && 0 == metrics.inlineGenerated;
+				}
+				if (!consistent) {
+					throw std::runtime_error("The randomizer cache metrics don't match the consumed randomizers.");
+				}
+			}
+
+			//concurrent consumers
+			parameters.capacity = 16;
+			parameters.producerThreadCount = 1;
+			parameters.blockWhenEmpty = true;
+			PaillierRandomizerCache cache(paillierCryptoProvider, parameters);
+
+			const size_t threadCount = 4;
+			std::vector<std::vector<std::string>> threadRandomizers(threadCount);
+			std::vector<std::thread> threads;
+			for (size_t i = 0; i < threadCount; ++i) {
+				threads.emplace_back([&cache, &threadRandomizers, i, popCount] () {
+					for (size_t j = 0; j < popCount; ++j) {
+						threadRandomizers[i].push_back(cache.Pop().randomizer.data.ToString(16));
+					}
+				});
+			}
+			for (size_t i = 0; i < threadCount; ++i) {
+				threads[i].join();
+			}
+
+			std::set<std::string> randomizers;
+			for (size_t i = 0; i < threadCount; ++i) {
+				randomizers.insert(threadRandomizers[i].begin(), threadRandomizers[i].end());
+			}
+			assert(randomizers.size() == threadCount * popCount);
+			assert(cache.GetMetrics().consumed == threadCount * popCount);
+
+			//a low-water mark above 100% is rejected
+			parameters.lowWaterMark = 101;
+			bool exceptionThrown = false;
+			try {
+				PaillierRandomizerCache invalidCache(paillierCryptoProvider, parameters);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("A low-water mark above 100% was not rejected.");
+			}
+		}
+
+		std::cout << "Testing the precomputation store." << std::endl;
+		{
+			boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+			boost::filesystem::create_directories(directory);
+
+			const std::string key = "test";
+			const std::string path = PrecomputationStore::GetPath(directory.string(), key);
+			assert(!PrecomputationStore::Exists(path));
+
+			const size_t recordCount = 40;
+			std::vector<PrecomputationStore::RecordWriter> records(recordCount);
+			for (size_t i = 0; i < recordCount; ++i) {
+				records[i].Write(static_cast<long>(i) - 20);
+				records[i].Write(BigInteger(static_cast<long>(i)).Pow(BigInteger(20)));
+			}
+			//two appends, the second one reuses the existing header and drops the partial record left by an interrupted append
+			PrecomputationStore::Append(path, key, std::vector<PrecomputationStore::RecordWriter>(records.begin(), records.begin() + recordCount / 2));
+			{
+				std::ofstream output(path.c_str(), std::ios::binary | std::ios::app);
+				output.write("\x64\0\0\0\0\0\0\0partial", 15);
+			}
+			PrecomputationStore::Append(path, key, std::vector<PrecomputationStore::RecordWriter>(records.begin() + recordCount / 2, records.end()));
+			assert(PrecomputationStore::Exists(path));
+
+		#if !defined(_WIN32)
+			//the store holds secret randomizers, so it is only accessible by its owner
+			if (0 != (boost::filesystem::status(path).permissions() & (boost::filesystem::group_all | boost::filesystem::others_all))) {
+				throw std::runtime_error("The precomputation store is accessible by other users.");
+			}
+		#endif
+
+			{
+				PrecomputationStore store(path, key, 7);
+				PrecomputationStore::RecordReader record;
+				for (size_t i = 0; i < 10; ++i) {
+					assert(store.Pop(record));
+					assert(record.ReadLong() == static_cast<long>(i) - 20);
+					assert(record.ReadBigInteger() == BigInteger(static_cast<long>(i)).Pow(BigInteger(20)));
+
+					//reading past the end of the record is rejected
+					if (0 == i) {
+						bool exceptionThrown = false;
+						try {
+							record.ReadBigInteger();
+						}
+						catch (const std::runtime_error &) {
+							exceptionThrown = true;
+						}
+						if (!exceptionThrown) {
+							throw std::runtime_error("Reading past the end of a precomputed record was not rejected.");
+						}
+					}
+				}
+			}
+
+		#if !defined(_WIN32)
+			if (0 != (boost::filesystem::status(path + ".journal").permissions() & (boost::filesystem::group_all | boost::filesystem::others_all))) {
+				throw std::runtime_error("The precomputation store journal is accessible by other users.");
+			}
+		#endif
+
+			//the consumed records (and the unused reserved ones) are zeroed, but they keep a valid checksum, so appending doesn't drop them
+			{
+				const uintmax_t storeSize = boost::filesystem::file_size(path);
+				PrecomputationStore::Append(path, key, std::vector<PrecomputationStore::RecordWriter>());
+				if (boost::filesystem::file_size(path) != storeSize) {
+					throw std::runtime_error("Appending to a store dropped its consumed records.");
+				}
+
+				std::ifstream input(path.c_str(), std::ios::binary);
+				input.seekg(24);
+				for (size_t i = 0; i < 14; ++i) {
+					unsigned char prefix[8];
+					input.read(reinterpret_cast<char *>(prefix), 8);
+					std::vector<char> data(prefix[0] | (prefix[1] << 8));
+					input.read(&data[0], static_cast<std::streamsize>(data.size()));
+					if (!input || std::count(data.begin(), data.end(), 0) != static_cast<std::ptrdiff_t>(data.size())) {
+						throw std::runtime_error("A consumed precomputed record was not erased.");
+					}
+				}
+			}
+
+			//the second store starts after the records reserved by the first one (2 reservations of 7 records), which are never handed out again
+			{
+				PrecomputationStore store(path, key, 7);
+				PrecomputationStore::RecordReader record;
+				size_t i = 14;
+				while (store.Pop(record)) {
+					assert(record.ReadLong() == static_cast<long>(i) - 20);
+					++i;
+				}
+				assert(i == recordCount);
+			}
+
+			//a store which was created for a different key is rejected
+			bool exceptionThrown = false;
+			try {
+				PrecomputationStore store(path, "other", 7);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("A precomputation store created for a different key was not rejected.");
+			}
+
+			//a damaged record is rejected by the checksum
+			const std::string damagedPath = PrecomputationStore::GetPath(directory.string(), "damaged");
+			PrecomputationStore::Append(damagedPath, "damaged", std::vector<PrecomputationStore::RecordWriter>(records.begin(), records.begin() + 1));
+			{
+				std::fstream file(damagedPath.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+				file.seekp(-1, std::ios::end);
+				file.put('\xff');
+			}
+			exceptionThrown = false;
+			try {
+				PrecomputationStore store(damagedPath, "damaged", 7);
+				PrecomputationStore::RecordReader record;
+				store.Pop(record);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("A damaged precomputed record was not rejected.");
+			}
+
+			//offline precomputation of Paillier randomizers
+			typedef RandomizerCache<RandomizerContainer<Paillier, RandomizerCacheParameters>> PaillierRandomizerCache;
+
+			RandomizerCacheParameters parameters("Core.RandomizerCache");
+			parameters.capacity = 8;
+			parameters.producerThreadCount = 0;
+			parameters.storeDirectory = directory.string();
+
+			PaillierRandomizerCache::Precompute(paillierCryptoProvider, parameters, 12);
+
+			PaillierRandomizerCache cache(paillierCryptoProvider, parameters);
+			std::set<std::string> randomizers;
+			for (size_t i = 0; i < 16; ++i) {
+				RandomizerContainer<Paillier, RandomizerCacheParameters> container = cache.Pop();
+				randomizers.insert(container.randomizer.data.ToString(16));
+
+				//the loaded randomizers are encryptions of 0
+				Paillier::Ciphertext ciphertext = paillierCryptoProvider.EncryptIntegerNonrandom(BigInteger(static_cast<long>(i)));
+				ciphertext.data = ciphertext.data * container.randomizer.data % paillierCryptoProvider.GetEncryptionModulus();
+				assert(paillierCryptoProvider.DecryptInteger(ciphertext) == BigInteger(static_cast<long>(i)));
+			}
+			assert(randomizers.size() == 16);
+
+			//the 12 precomputed randomizers are consumed first, then the cache falls back to computing them
+			assert(cache.GetMetrics().loaded == 12);
+
+			boost::filesystem::remove_all(directory);
+		}
+
+		std::cout << "Testing the precomputation plan." << std::endl;
+		{
+			typedef RandomizerCache<RandomizerContainer<Paillier, RandomizerCacheParameters>> PaillierRandomizerCache;
+
+			RandomizerCacheParameters parameters("Core.RandomizerCache");
+			parameters.capacity = 4;
+			parameters.producerThreadCount = 1;
+			parameters.blockWhenEmpty = true;
+
+			//the buffer grows and the producer threads are stopped
+			PaillierRandomizerCache cache(paillierCryptoProvider, parameters);
+			cache.Reserve(20, 2);
+			PaillierRandomizerCache::Metrics metrics = cache.GetMetrics();
+			assert(metrics.capacity == 20);
+			assert(metrics.depth == 20);
+
+			std::set<std::string> randomizers;
+			for (size_t i = 0; i < 21; ++i) {
+				randomizers.insert(cache.Pop().randomizer.data.ToString(16));
+			}
+			assert(randomizers.size() == 21);
+
+			//only the element requested after the reserved ones is generated inline
+			metrics = cache.GetMetrics();
+			assert(metrics.consumed == 20);
+			assert(metrics.stalls == 1);
+			assert(metrics.inlineGenerated == 1);
+
+			//the requirements of the same cache are summed
+			parameters.producerThreadCount = 0;
+			PaillierRandomizerCache blindingFactorCache(paillierCryptoProvider, parameters);
+			Paillier encryptor(paillierCryptoProvider.GetPublicKey());
+
+			PrecomputationPlan plan;
+			plan.Add("Blinding factors", blindingFactorCache, 5);
+			plan.Add("More blinding factors", blindingFactorCache, 3);
+			plan.AddRandomizers("Encryptions", encryptor, 6);
+			plan.Execute();
+
+			for (size_t i = 0; i < 8; ++i) {
+				blindingFactorCache.Pop();
+			}
+			for (size_t i = 0; i < 6; ++i) {
+				BigInteger plaintext(static_cast<long>(i));
+				assert(paillierCryptoProvider.DecryptInteger(encryptor.EncryptInteger(plaintext)) == plaintext);
+			}
+
+			std::ostringstream report;
+			plan.PrintReport(report);
+			assert(report.str().find("Blinding factors + More blinding factors: planned 8, consumed 8, generated online 0, unused 0") != std::string::npos);
+			assert(report.str().find("Encryptions: planned 6, consumed 6, generated online 0") != std::string::npos);
+
+			//the crypto provider keys must be set
+			Paillier noKeys;
+			bool exceptionThrown = false;
+			try {
+				plan.AddRandomizers("No keys", noKeys, 1);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("A crypto provider without keys was not rejected by the precomputation plan.");
+			}
+		}
+
+		std::cout << "Testing the batch encryption, decryption and randomization." << std::endl;
+		{
+			//Core.WorkerPool.threadCount is set at the beginning of the tests
+			WorkerPool &workerPool = WorkerPool::GetInstance();
+			assert(workerPool.GetThreadCount() == 4);
+
+			//every index is processed exactly once, nested jobs run on the calling thread
+			std::vector<int> visits(100, 0);
+			workerPool.ParallelFor(visits.size(), [&visits, &workerPool] (const size_t index) {
+				int nestedVisits = 0;
+				workerPool.ParallelFor(3, [&nestedVisits] (const size_t) { ++nestedVisits; });
+				visits[index] += nestedVisits - 2;
+			});
+			for (size_t i = 0; i < visits.size(); ++i) {
+				assert(visits[i] == 1);
+			}
+
+			//the exceptions are propagated to the calling thread
+			bool exceptionThrown = false;
+			try {
+				workerPool.ParallelFor(16, [] (const size_t index) {
+					if (index == 5) {
+						throw std::runtime_error("Test exception.");
+					}
+				});
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("The exception of a parallel job was not propagated.");
+			}
+
+			std::vector<BigInteger> paillierPlaintexts;
+			std::vector<BigInteger> dgkPlaintexts;
+			for (long i = 0; i < 16; ++i) {
+				paillierPlaintexts.emplace_back(RandomProvider::GetInstance().GetRandomInteger(paillierCryptoProvider.GetPositiveNegativeBoundary()) * (i % 2 == 0 ? 1 : -1));
+				dgkPlaintexts.emplace_back(i % 4);
+			}
+
+			//the results are returned in order
+			std::vector<Paillier::Ciphertext> paillierCiphertexts = paillierCryptoProvider.EncryptBatch(paillierPlaintexts);
+			assert(paillierCiphertexts.size() == paillierPlaintexts.size());
+			assert(paillierCryptoProvider.DecryptBatch(paillierCiphertexts) == paillierPlaintexts);
+			for (size_t i = 0; i < paillierPlaintexts.size(); ++i) {
+				assert(paillierCryptoProvider.DecryptInteger(paillierCiphertexts[i]) == paillierPlaintexts[i]);
+			}
+
+			std::vector<Dgk::Ciphertext> dgkCiphertexts = dgkCryptoProvider.EncryptBatch(dgkPlaintexts);
+			assert(dgkCryptoProvider.DecryptBatch(dgkCiphertexts) == dgkPlaintexts);
+
+			//the re-randomized ciphertexts encrypt the same values
+			std::vector<Paillier::Ciphertext> randomizedPaillierCiphertexts = paillierCryptoProvider.RandomizeBatch(paillierCiphertexts);
+			assert(paillierCryptoProvider.DecryptBatch(randomizedPaillierCiphertexts) == paillierPlaintexts);
+			std::vector<Dgk::Ciphertext> randomizedDgkCiphertexts = dgkCryptoProvider.RandomizeBatch(dgkCiphertexts);
+			assert(dgkCryptoProvider.DecryptBatch(randomizedDgkCiphertexts) == dgkPlaintexts);
+			for (size_t i = 0; i < paillierCiphertexts.size(); ++i) {
+				assert(randomizedPaillierCiphertexts[i].data != paillierCiphertexts[i].data);
+				assert(randomizedDgkCiphertexts[i].data != dgkCiphertexts[i].data);
+			}
+
+			//empty batches
+			assert(paillierCryptoProvider.EncryptBatch(std::vector<BigInteger>()).empty());
+			assert(dgkCryptoProvider.DecryptBatch(std::vector<Dgk::Ciphertext>()).empty());
+		}
+
+		std::cout << "Testing the parallel CRT decryption." << std::endl;
+		{
+			Utils::Config::GetInstance().SetParameter("Core.Paillier.parallelDecryptionKeySize", 1);
+			Paillier parallelPaillier(paillierCryptoProvider.GetPublicKey(), paillierCryptoProvider.GetPrivateKey());
+			Utils::Config::GetInstance().SetParameter("Core.Paillier.parallelDecryptionKeySize", 0);
+
+			std::vector<BigInteger> plaintexts;
+			for (long i = 0; i < 8; ++i) {
+				plaintexts.emplace_back(RandomProvider::GetInstance().GetRandomInteger(paillierCryptoProvider.GetPositiveNegativeBoundary()) * (i % 2 == 0 ? 1 : -1));
+
+				Paillier::Ciphertext ciphertext = paillierCryptoProvider.EncryptInteger(plaintexts.back());
+				assert(parallelPaillier.DecryptInteger(ciphertext) == plaintexts.back());
+				assert(paillierCryptoProvider.DecryptInteger(parallelPaillier.EncryptInteger(plaintexts.back())) == plaintexts.back());
+			}
+
+			//inside a batch, the CRT halves are computed on the thread which decrypts the ciphertext
+			assert(parallelPaillier.DecryptBatch(paillierCryptoProvider.EncryptBatch(plaintexts)) == plaintexts);
+			assert(parallelPaillier.DecryptInteger(parallelPaillier.GetEncryptedZero()) == 0);
+			assert(parallelPaillier.DecryptInteger(parallelPaillier.GetEncryptedOne()) == 1);
+		}
+
 		std::cout << "Testing Data Packing with Paillier." << std::endl;
 		{
 			//initialize the data packer
@@ -219,6 +1210,29 @@ int main (int argc, char *argv[]) {
 			assert(cryptoProviderClone.DecryptInteger(cryptoProviderClone.EncryptInteger(-plaintext)) == -plaintext);
 		}
 
+		std::cout << "Testing Paillier short randomizers." << std::endl;
+		{
+			Utils::Config::GetInstance().SetParameter("Core.Paillier.shortRandomizers", true);
+
+			//encryption with the public key only
+			Paillier encryptor(paillierCryptoProvider.GetPublicKey());
+			Utils::Config::GetInstance().SetParameter("Core.Paillier.shortRandomizers", false);
+
+			//the randomizers are encryptions of 0 and are not reused
+			std::set<std::string> randomizers;
+			for (size_t i = 0; i < 16; ++i) {
+				Paillier::Randomizer randomizer = encryptor.GetRandomizer();
+				randomizers.insert(randomizer.data.ToString(16));
+				assert(paillierCryptoProvider.DecryptInteger(Paillier::Ciphertext(randomizer.data, paillierCryptoProvider.GetEncryptedZero().GetEncryptionModulus())) == 0);
+			}
+			assert(randomizers.size() == 16);
+
+			BigInteger plaintext = RandomProvider::GetInstance().GetRandomInteger(paillierCryptoProvider.GetPositiveNegativeBoundary());
+			assert(paillierCryptoProvider.DecryptInteger(encryptor.EncryptInteger(plaintext)) == plaintext);
+			assert(paillierCryptoProvider.DecryptInteger(encryptor.EncryptInteger(-plaintext)) == -plaintext);
+			assert(paillierCryptoProvider.DecryptInteger(encryptor.RandomizeCiphertext(paillierCryptoProvider.EncryptInteger(plaintext))) == plaintext);
+		}
+
 		std::cout << "Testing Okamoto-Uchiyama cryptoprovider construction from public and private key pairs." << std::endl;
 		{
 			OkamotoUchiyamaPublicKey publicKeyClone;
@@ -277,6 +1291,404 @@ int main (int argc, char *argv[]) {
 			assert(cryptoProviderClone.DecryptInteger(cryptoProviderClone.EncryptInteger(plaintext)) == plaintext);
 			assert(cryptoProviderClone.DecryptInteger(cryptoProviderClone.EncryptInteger(-plaintext)) == -plaintext);
 		}
+
+		std::cout << "Testing the baby-step giant-step decryption." << std::endl;
+		{
+			//decryption tables with 1000 values instead of the whole message space
+			Utils::Config::GetInstance().SetParameter("Core.Dgk.babyStepCount", 1000);
+			Utils::Config::GetInstance().SetParameter("Core.ElGamal.babyStepCount", 1000);
+			Dgk dgk(dgkCryptoProvider.GetPublicKey(), dgkCryptoProvider.GetPrivateKey(), true);
+			ElGamal elGamal(elGamalCryptoProvider.GetPublicKey(), elGamalCryptoProvider.GetPrivateKey(), true);
+			Utils::Config::GetInstance().SetParameter("Core.Dgk.babyStepCount", 0);
+			Utils::Config::GetInstance().SetParameter("Core.ElGamal.babyStepCount", 0);
+
+			for (size_t i = 0; i < 5; ++i) {
+				BigInteger plaintext = RandomProvider::GetInstance().GetRandomInteger(dgk.GetPositiveNegativeBoundary());
+				assert(dgk.DecryptInteger(dgk.EncryptInteger(plaintext)) == plaintext);
+				assert(dgk.DecryptInteger(dgk.EncryptInteger(-plaintext)) == -plaintext);
+
+				plaintext = RandomProvider::GetInstance().GetRandomInteger(elGamal.GetPositiveNegativeBoundary());
+				assert(elGamal.DecryptInteger(elGamal.EncryptInteger(plaintext)) == plaintext);
+				assert(elGamal.DecryptInteger(elGamal.EncryptInteger(-plaintext)) == -plaintext);
+			}
+			assert(dgk.DecryptInteger(dgk.GetEncryptedZero()) == 0);
+			assert(elGamal.DecryptInteger(elGamal.GetEncryptedOne()) == 1);
+
+			//sum of 10 values in [0, 100], decrypted in the known range [0, 1000]
+			Dgk::Ciphertext dgkSum = dgk.GetEncryptedZero();
+			ElGamal::Ciphertext elGamalSum = elGamal.GetEncryptedZero();
+			long sum = 0;
+			for (long i = 0; i < 10; ++i) {
+				dgkSum = dgkSum + dgk.EncryptInteger(BigInteger(i * 10 + 3));
+				elGamalSum = elGamalSum + elGamal.EncryptInteger(BigInteger(i * 10 + 3));
+				sum += i * 10 + 3;
+			}
+			assert(dgk.DecryptInteger(dgkSum, 0, 1000) == sum);
+			assert(elGamal.DecryptInteger(elGamalSum, 0, 1000) == sum);
+			assert(dgkCryptoProvider.DecryptInteger(dgkSum, 0, 1000) == sum);
+			assert(elGamalCryptoProvider.DecryptInteger(elGamalSum, 0, 1000) == sum);
+
+			//ElGamal plaintexts beyond 2^t can be decrypted in a bounded range
+			BigInteger largePlaintext = elGamal.GetPositiveNegativeBoundary() * 4 + 5;
+			assert(elGamal.DecryptInteger(elGamal.EncryptInteger(largePlaintext), static_cast<long>(largePlaintext.ToUnsignedLong()) - 10, static_cast<long>(largePlaintext.ToUnsignedLong()) + 10) == largePlaintext);
+
+			bool exceptionThrown = false;
+			try {
+				dgk.DecryptInteger(dgkSum, 0, sum - 1);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("A DGK plaintext outside the given range was not rejected.");
+			}
+
+			exceptionThrown = false;
+			try {
+				elGamal.DecryptInteger(elGamalSum, sum + 1, 1000);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("An ElGamal plaintext outside the given range was not rejected.");
+			}
+		}
+
+		std::cout << "Testing the CRT encryption and randomizers of the key holders." << std::endl;
+		{
+			//the key holders compute the randomizers via CRT, the public key only providers don't
+			Paillier publicPaillier(paillierCryptoProvider.GetPublicKey());
+			Utils::Config::GetInstance().SetParameter("Core.Paillier.shortRandomizers", true);
+			Paillier shortPaillier(paillierCryptoProvider.GetPublicKey(), paillierCryptoProvider.GetPrivateKey());
+			Utils::Config::GetInstance().SetParameter("Core.Paillier.shortRandomizers", false);
+			OkamotoUchiyama publicOkamotoUchiyama(okamotoUchiyamaCryptoProvider.GetPublicKey());
+
+			std::set<std::string> paillierRandomizers;
+			std::set<std::string> okamotoUchiyamaRandomizers;
+			const size_t randomizerCount = 8;
+			for (size_t i = 0; i < randomizerCount; ++i) {
+				//the randomizers are encryptions of 0
+				Paillier::Randomizer paillierRandomizer = paillierCryptoProvider.GetRandomizer();
+				paillierRandomizers.insert(paillierRandomizer.data.ToString(16));
+				assert(paillierCryptoProvider.DecryptInteger(Paillier::Ciphertext(paillierRandomizer.data, paillierCryptoProvider.GetEncryptedZero().GetEncryptionModulus())) == 0);
+
+				Paillier::Randomizer shortPaillierRandomizer = shortPaillier.GetRandomizer();
+				paillierRandomizers.insert(shortPaillierRandomizer.data.ToString(16));
+				assert(paillierCryptoProvider.DecryptInteger(Paillier::Ciphertext(shortPaillierRandomizer.data, paillierCryptoProvider.GetEncryptedZero().GetEncryptionModulus())) == 0);
+
+				OkamotoUchiyama::Randomizer okamotoUchiyamaRandomizer = okamotoUchiyamaCryptoProvider.GetRandomizer();
+				okamotoUchiyamaRandomizers.insert(okamotoUchiyamaRandomizer.data.ToString(16));
+				assert(okamotoUchiyamaCryptoProvider.DecryptInteger(OkamotoUchiyama::Ciphertext(okamotoUchiyamaRandomizer.data, okamotoUchiyamaCryptoProvider.GetEncryptedZero().GetEncryptionModulus())) == 0);
+
+				//same results as the public key path
+				BigInteger paillierPlaintext = RandomProvider::GetInstance().GetRandomInteger(paillierCryptoProvider.GetPositiveNegativeBoundary());
+				assert(paillierCryptoProvider.EncryptIntegerNonrandom(paillierPlaintext).data == publicPaillier.EncryptIntegerNonrandom(paillierPlaintext).data);
+				assert(paillierCryptoProvider.DecryptInteger(paillierCryptoProvider.EncryptInteger(paillierPlaintext)) == paillierPlaintext);
+				assert(paillierCryptoProvider.DecryptInteger(shortPaillier.EncryptInteger(-paillierPlaintext)) == -paillierPlaintext);
+				assert(paillierCryptoProvider.DecryptInteger(publicPaillier.EncryptInteger(paillierPlaintext)) == paillierPlaintext);
+
+				BigInteger okamotoUchiyamaPlaintext = RandomProvider::GetInstance().GetRandomInteger(publicOkamotoUchiyama.GetPositiveNegativeBoundary());
+				assert(okamotoUchiyamaCryptoProvider.EncryptIntegerNonrandom(okamotoUchiyamaPlaintext).data == publicOkamotoUchiyama.EncryptIntegerNonrandom(okamotoUchiyamaPlaintext).data);
+				assert(okamotoUchiyamaCryptoProvider.DecryptInteger(okamotoUchiyamaCryptoProvider.EncryptInteger(okamotoUchiyamaPlaintext)) == okamotoUchiyamaPlaintext);
+				assert(okamotoUchiyamaCryptoProvider.DecryptInteger(okamotoUchiyamaCryptoProvider.EncryptInteger(-okamotoUchiyamaPlaintext)) == -okamotoUchiyamaPlaintext);
+				assert(okamotoUchiyamaCryptoProvider.DecryptInteger(publicOkamotoUchiyama.EncryptInteger(-okamotoUchiyamaPlaintext)) == -okamotoUchiyamaPlaintext);
+			}
+			assert(paillierRandomizers.size() == 2 * randomizerCount);
+			assert(okamotoUchiyamaRandomizers.size() == randomizerCount);
+
+			//homomorphic operations between the two paths
+			BigInteger plaintext = RandomProvider::GetInstance().GetRandomInteger(publicOkamotoUchiyama.GetPositiveNegativeBoundary());
+			assert(okamotoUchiyamaCryptoProvider.DecryptInteger(okamotoUchiyamaCryptoProvider.EncryptInteger(plaintext) + publicOkamotoUchiyama.EncryptInteger(-plaintext)) == 0);
+			assert(paillierCryptoProvider.DecryptInteger(paillierCryptoProvider.EncryptInteger(plaintext) + publicPaillier.EncryptInteger(-plaintext)) == 0);
+		}
+
+		std::cout << "Testing the Damgard-Jurik cryptoprovider." << std::endl;
+		{
+			Utils::Config::GetInstance().SetParameter("Core.DamgardJurik.s", 3);
+			DamgardJurik damgardJurikCryptoProvider;
+			damgardJurikCryptoProvider.GenerateKeys();
+			Utils::Config::GetInstance().SetParameter("Core.DamgardJurik.s", 2);
+
+			//plaintexts modulo n^s, ciphertexts modulo n^(s + 1)
+			const BigInteger &n = damgardJurikCryptoProvider.GetPublicKey().n;
+			assert(damgardJurikCryptoProvider.GetPublicKey().s == 3);
+			assert(damgardJurikCryptoProvider.GetMessageSpaceUpperBound() == n.GetPow(3));
+			assert(damgardJurikCryptoProvider.GetEncryptionModulus() == n.GetPow(4));
+
+			assert(damgardJurikCryptoProvider.DecryptInteger(damgardJurikCryptoProvider.GetEncryptedZero()) == 0);
+			assert(damgardJurikCryptoProvider.DecryptInteger(damgardJurikCryptoProvider.GetEncryptedOne()) == 1);
+			assert(damgardJurikCryptoProvider.DecryptInteger(damgardJurikCryptoProvider.EncryptInteger(BigInteger(-1))) == -1);
+			assert(damgardJurikCryptoProvider.DecryptInteger(damgardJurikCryptoProvider.EncryptInteger(damgardJurikCryptoProvider.GetPositiveNegativeBoundary())) == damgardJurikCryptoProvider.GetPositiveNegativeBoundary());
+			assert(damgardJurikCryptoProvider.DecryptInteger(damgardJurikCryptoProvider.EncryptInteger(-damgardJurikCryptoProvider.GetPositiveNegativeBoundary())) == -damgardJurikCryptoProvider.GetPositiveNegativeBoundary());
+
+			//clones from the key pair and from the public key only
+			DamgardJurikPublicKey publicKeyClone;
+			publicKeyClone.n = n;
+			publicKeyClone.s = damgardJurikCryptoProvider.GetPublicKey().s;
+			DamgardJurikPrivateKey privateKeyClone;
+			privateKeyClone.p = damgardJurikCryptoProvider.GetPrivateKey().p;
+			privateKeyClone.q = damgardJurikCryptoProvider.GetPrivateKey().q;
+			DamgardJurik cryptoProviderClone(publicKeyClone, privateKeyClone);
+			DamgardJurik encryptor(publicKeyClone);
+			assert(encryptor.GetPublicKeyFingerprint() == damgardJurikCryptoProvider.GetPublicKeyFingerprint());
+
+			Utils::Config::GetInstance().SetParameter("Core.DamgardJurik.parallelDecryptionKeySize", 1);
+			DamgardJurik parallelCryptoProvider(publicKeyClone, privateKeyClone);
+			Utils::Config::GetInstance().SetParameter("Core.DamgardJurik.parallelDecryptionKeySize", 0);
+
+			for (size_t i = 0; i < 8; ++i) {
+				//plaintexts much larger than n
+				BigInteger plaintext = RandomProvider::GetInstance().GetRandomInteger(damgardJurikCryptoProvider.GetPositiveNegativeBoundary());
+				assert(plaintext > n || i > 0);
+
+				assert(damgardJurikCryptoProvider.DecryptInteger(damgardJurikCryptoProvider.EncryptInteger(plaintext)) == plaintext);
+				assert(damgardJurikCryptoProvider.DecryptInteger(damgardJurikCryptoProvider.EncryptInteger(-plaintext)) == -plaintext);
+				assert(damgardJurikCryptoProvider.DecryptInteger(encryptor.EncryptInteger(plaintext)) == plaintext);
+				assert(cryptoProviderClone.DecryptInteger(encryptor.EncryptInteger(-plaintext)) == -plaintext);
+				assert(parallelCryptoProvider.DecryptInteger(damgardJurikCryptoProvider.EncryptInteger(plaintext)) == plaintext);
+
+				//the randomizers of both paths are encryptions of 0
+				assert(damgardJurikCryptoProvider.DecryptInteger(DamgardJurik::Ciphertext(damgardJurikCryptoProvider.GetRandomizer().data, damgardJurikCryptoProvider.GetEncryptedZero().GetEncryptionModulus())) == 0);
+				assert(damgardJurikCryptoProvider.DecryptInteger(DamgardJurik::Ciphertext(encryptor.GetRandomizer().data, damgardJurikCryptoProvider.GetEncryptedZero().GetEncryptionModulus())) == 0);
+			}
+
+			//homomorphic operations
+			BigInteger a = RandomProvider::GetInstance().GetRandomInteger(damgardJurikCryptoProvider.GetPositiveNegativeBoundary() / 2);
+			BigInteger b = RandomProvider::GetInstance().GetRandomInteger(damgardJurikCryptoProvider.GetPositiveNegativeBoundary() / 2);
+			DamgardJurik::Ciphertext encryptedA = damgardJurikCryptoProvider.EncryptInteger(a);
+			DamgardJurik::Ciphertext encryptedB = encryptor.EncryptInteger(b);
+			assert(damgardJurikCryptoProvider.DecryptInteger(encryptedA + encryptedB) == a + b);
+			assert(damgardJurikCryptoProvider.DecryptInteger(encryptedA - encryptedB) == a - b);
+			assert(damgardJurikCryptoProvider.DecryptInteger(-encryptedA) == -a);
+			assert(damgardJurikCryptoProvider.DecryptInteger(encryptedA * BigInteger(-2)) == a * -2);
+			assert(damgardJurikCryptoProvider.DecryptInteger(damgardJurikCryptoProvider.RandomizeCiphertext(encryptedA)) == a);
+
+			//s times more buckets than Paillier (with the same key size) fit in each packed encryption
+			DataPacker<DamgardJurik> dataPacker(damgardJurikCryptoProvider, 16, 4, 4);
+			DataPacker<DamgardJurik>::UnpackedData buckets;
+			for (long i = 0; i < 200; ++i) {
+				DataPacker<DamgardJurik>::DataBucket bucket;
+				bucket.frontPadding = i % 16;
+				bucket.data = i * 100;
+				bucket.backPadding = 15 - i % 16;
+				buckets.push_back(bucket);
+			}
+			DataPacker<DamgardJurik>::PackedData packedData = dataPacker.Pack(buckets);
+			const size_t bucketsPerEncryption = damgardJurikCryptoProvider.GetMessageSpaceSize() / 24;
+			assert(bucketsPerEncryption >= 3 * (n.GetSize() / 24));
+			if (packedData.size() != (buckets.size() + bucketsPerEncryption - 1) / bucketsPerEncryption) {
+				throw std::runtime_error("The Damgard-Jurik data packer didn't fill the packed encryptions.");
+			}
+			DataPacker<DamgardJurik>::UnpackedData unpackedBuckets = dataPacker.Unpack(packedData, buckets.size());
+			assert(unpackedBuckets.size() == buckets.size());
+			for (size_t i = 0; i < buckets.size(); ++i) {
+				assert(unpackedBuckets[i].frontPadding == buckets[i].frontPadding);
+				assert(unpackedBuckets[i].data == buckets[i].data);
+				assert(unpackedBuckets[i].backPadding == buckets[i].backPadding);
+			}
+
+			bool exceptionThrown = false;
+			try {
+				encryptor.DecryptInteger(encryptedA);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("Decrypting without the private key was not rejected.");
+			}
+
+			exceptionThrown = false;
+			try {
+				publicKeyClone.s = 0;
+				DamgardJurik invalidCryptoProvider(publicKeyClone);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("An expansion degree of 0 was not rejected.");
+			}
+		}
+
+		std::cout << "Testing the elliptic curve arithmetic." << std::endl;
+		{
+			const std::shared_ptr<const EllipticCurve> &curve = EllipticCurve::GetP256();
+			const EllipticCurve::Point &generator = curve->GetGenerator();
+			assert(curve->IsOnCurve(generator));
+
+			//2G, from the NIST test vectors
+			EllipticCurve::Point doubleGenerator = curve->Multiply(generator, BigInteger(2));
+			assert(doubleGenerator.x == BigInteger("7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978", 16));
+			assert(doubleGenerator.y == BigInteger("07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1", 16));
+			assert(curve->Add(generator, generator) == doubleGenerator);
+
+			assert(curve->Multiply(generator, curve->GetOrder()).infinity);
+			assert(curve->Multiply(generator, curve->GetOrder() - 1) == curve->Negate(generator));
+			assert(curve->Multiply(generator, BigInteger(-1)) == curve->Negate(generator));
+			assert(curve->Add(generator, curve->Negate(generator)).infinity);
+			assert(curve->Add(generator, EllipticCurve::Point()) == generator);
+
+			EllipticCurvePointTable generatorTable(curve, generator);
+			for (size_t i = 0; i < 8; ++i) {
+				BigInteger scalar = RandomProvider::GetInstance().GetRandomInteger(curve->GetOrder());
+				EllipticCurve::Point point = curve->Multiply(generator, scalar);
+				assert(curve->IsOnCurve(point));
+				assert(generatorTable.Multiply(scalar) == point);
+				assert(curve->Add(point, generator) == curve->Multiply(generator, scalar + 1));
+			}
+			assert(generatorTable.Multiply(BigInteger(0)).infinity);
+			assert(!curve->IsOnCurve(EllipticCurve::Point(generator.x, generator.x)));
+		}
+
+		std::cout << "Testing the elliptic curve ElGamal cryptoprovider." << std::endl;
+		{
+			EcElGamal ecElGamalCryptoProvider(true);//pre-compute decryption map (keep EcElGamal.messageSpaceThresholdBitSize reasonably small for this test)
+			ecElGamalCryptoProvider.GenerateKeys();
+
+			const BigInteger largestPlaintext = ecElGamalCryptoProvider.GetPositiveNegativeBoundary() - 1;
+			assert(ecElGamalCryptoProvider.DecryptInteger(ecElGamalCryptoProvider.GetEncryptedZero()) == 0);
+			assert(ecElGamalCryptoProvider.DecryptInteger(ecElGamalCryptoProvider.GetEncryptedOne()) == 1);
+			assert(ecElGamalCryptoProvider.DecryptInteger(ecElGamalCryptoProvider.EncryptInteger(BigInteger(-1))) == -1);
+			assert(ecElGamalCryptoProvider.DecryptInteger(ecElGamalCryptoProvider.EncryptInteger(largestPlaintext)) == largestPlaintext);
+			assert(ecElGamalCryptoProvider.DecryptInteger(ecElGamalCryptoProvider.EncryptInteger(-largestPlaintext)) == -largestPlaintext);
+			assert(ecElGamalCryptoProvider.IsEncryptedZero(ecElGamalCryptoProvider.GetEncryptedZero()));
+			assert(!ecElGamalCryptoProvider.IsEncryptedZero(ecElGamalCryptoProvider.GetEncryptedOne()));
+
+			//clones from the key pair and from the public key only
+			EcElGamalPublicKey publicKeyClone;
+			publicKeyClone.h = ecElGamalCryptoProvider.GetPublicKey().h;
+			EcElGamalPrivateKey privateKeyClone;
+			privateKeyClone.s = ecElGamalCryptoProvider.GetPrivateKey().s;
+			EcElGamal cryptoProviderClone(publicKeyClone, privateKeyClone);
+			EcElGamal encryptor(publicKeyClone);
+			assert(encryptor.GetPublicKeyFingerprint() == ecElGamalCryptoProvider.GetPublicKeyFingerprint());
+
+			for (size_t i = 0; i < 8; ++i) {
+				BigInteger plaintext = RandomProvider::GetInstance().GetRandomInteger(ecElGamalCryptoProvider.GetPositiveNegativeBoundary());
+
+				assert(ecElGamalCryptoProvider.DecryptInteger(ecElGamalCryptoProvider.EncryptInteger(plaintext)) == plaintext);
+				assert(ecElGamalCryptoProvider.DecryptInteger(encryptor.EncryptInteger(-plaintext)) == -plaintext);
+				assert(cryptoProviderClone.IsEncryptedZero(encryptor.EncryptInteger(plaintext)) == (plaintext == 0));
+
+				//the randomizers are encryptions of 0
+				EcElGamal::Randomizer randomizer = encryptor.GetRandomizer();
+				assert(ecElGamalCryptoProvider.IsEncryptedZero(EcElGamal::Ciphertext(randomizer.x, randomizer.y, encryptor.GetCurve())));
+			}
+
+			//homomorphic operations
+			BigInteger a = RandomProvider::GetInstance().GetRandomInteger(BigInteger(1000));
+			BigInteger b = RandomProvider::GetInstance().GetRandomInteger(BigInteger(1000));
+			EcElGamal::Ciphertext encryptedA = ecElGamalCryptoProvider.EncryptInteger(a);
+			EcElGamal::Ciphertext encryptedB = encryptor.EncryptInteger(b);
+			assert(ecElGamalCryptoProvider.DecryptInteger(encryptedA + encryptedB) == a + b);
+			assert(ecElGamalCryptoProvider.DecryptInteger(encryptedA - encryptedB) == a - b);
+			assert(ecElGamalCryptoProvider.DecryptInteger(-encryptedA) == -a);
+			assert(ecElGamalCryptoProvider.DecryptInteger(encryptedA * -7) == a * -7);
+			assert(ecElGamalCryptoProvider.DecryptInteger(encryptedA * BigInteger(3)) == a * 3);
+			assert(ecElGamalCryptoProvider.DecryptInteger(encryptor.RandomizeCiphertext(encryptedA)) == a);
+			assert(ecElGamalCryptoProvider.IsEncryptedZero(encryptedA - encryptedA));
+
+			//dot products and batch operations
+			std::vector<EcElGamal::Ciphertext> lhs, rhs;
+			std::vector<BigInteger> scalars;
+			BigInteger dotProduct = 0;
+			for (long i = 0; i < 6; ++i) {
+				lhs.push_back(ecElGamalCryptoProvider.EncryptInteger(BigInteger(i * 10)));
+				rhs.push_back(ecElGamalCryptoProvider.EncryptInteger(BigInteger(i - 3)));
+				scalars.push_back(BigInteger(i - 2));
+				dotProduct += BigInteger(i * 10 * (i - 2));
+			}
+			assert(ecElGamalCryptoProvider.DecryptInteger(ecElGamalCryptoProvider.HomomorphicDotProduct(lhs, scalars)) == dotProduct);
+
+			std::vector<EcElGamal::Ciphertext> negated = ecElGamalCryptoProvider.BatchNegate(lhs);
+			std::vector<EcElGamal::Ciphertext> differences = ecElGamalCryptoProvider.BatchSubtract(lhs, rhs);
+			std::vector<EcElGamal::Ciphertext> complements = ecElGamalCryptoProvider.BatchSubtract(ecElGamalCryptoProvider.GetEncryptedOne(), rhs);
+			std::vector<EcElGamal::Ciphertext> sums = ecElGamalCryptoProvider.BatchAdd(lhs, rhs);
+			for (long i = 0; i < 6; ++i) {
+				assert(ecElGamalCryptoProvider.DecryptInteger(negated[i]) == -i * 10);
+				assert(ecElGamalCryptoProvider.DecryptInteger(differences[i]) == i * 10 - (i - 3));
+				assert(ecElGamalCryptoProvider.DecryptInteger(complements[i]) == 1 - (i - 3));
+				assert(ecElGamalCryptoProvider.DecryptInteger(sums[i]) == i * 10 + (i - 3));
+			}
+			scalars[2] = 5;
+			std::vector<EcElGamal::Ciphertext> products = ecElGamalCryptoProvider.BatchMultiply(rhs, scalars);
+			for (long i = 0; i < 6; ++i) {
+				assert(ecElGamalCryptoProvider.DecryptInteger(products[i]) == (i - 3) * (i == 2 ? 5 : i - 2));
+			}
+
+			//plaintexts outside the decryption table
+			bool exceptionThrown = false;
+			try {
+				ecElGamalCryptoProvider.DecryptInteger(ecElGamalCryptoProvider.EncryptInteger(ecElGamalCryptoProvider.GetPositiveNegativeBoundary()));
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("A plaintext outside the decryption table was not rejected.");
+			}
+
+			//no decryption map
+			exceptionThrown = false;
+			try {
+				cryptoProviderClone.DecryptInteger(encryptedA);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("Decrypting without a decryption map was not rejected.");
+			}
+
+			exceptionThrown = false;
+			try {
+				encryptor.IsEncryptedZero(encryptedA);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("Checking for an encrypted zero without the private key was not rejected.");
+			}
+
+			//a ciphertext point which is not on the curve is rejected before it is multiplied with the private key
+			EcElGamal::Ciphertext invalidCiphertext(EllipticCurve::Point(encryptedA.data.x.x, encryptedA.data.x.x), encryptedA.data.y, ecElGamalCryptoProvider.GetCurve());
+			exceptionThrown = false;
+			try {
+				ecElGamalCryptoProvider.DecryptInteger(invalidCiphertext);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("A ciphertext which is not on the curve was not rejected.");
+			}
+
+			exceptionThrown = false;
+			try {
+				ecElGamalCryptoProvider.IsEncryptedZero(invalidCiphertext);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("Checking a ciphertext which is not on the curve for an encrypted zero was not rejected.");
+			}
+
+			exceptionThrown = false;
+			try {
+				publicKeyClone.h = EllipticCurve::Point(publicKeyClone.h.x, publicKeyClone.h.x);
+				EcElGamal invalidCryptoProvider(publicKeyClone);
+			}
+			catch (const std::runtime_error &) {
+				exceptionThrown = true;
+			}
+			if (!exceptionThrown) {
+				throw std::runtime_error("A public key which is not on the curve was not rejected.");
+			}
+		}
 	}
 	catch (const std::runtime_error &exception) {
 		std::cout << exception.what() << std::endl;
@@ -33,15 +33,35 @@ limitations under the License.
 #include "utils/config.h"
 #include "core/big_integer.h"
 #include "core/random_provider.h"
+#include "core/random_bit_source.h"
+#include "core/prime_search.h"
+#include "core/gmp_memory_pool.h"
+#include "core/fixed_base_table.h"
+#include "core/decryption_table.h"
+#include "core/baby_step_giant_step.h"
+#include "core/precomputed_ciphertext.h"
 #include "core/paillier.h"
+#include "core/damgard_jurik.h"
 #include "core/dgk.h"
 #include "core/okamoto_uchiyama.h"
 #include "core/el_gamal.h"
+#include "core/ec_el_gamal.h"
+#include "core/precomputation_plan.h"
+#include "core/worker_pool.h"
 #include "core/data_packer.h"
 
 //include C++ headers
+#include <algorithm>
 #include <iostream>
+#include <set>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+//include boost libraries
+#include <boost/filesystem.hpp>
 
 using namespace SeComLib;
 using namespace SeComLib::Core;
@@ -59,6 +59,10 @@ namespace Utils {
 		template<typename T>
 		T GetParameter (const std::string &parameter, const T &defaultValue) const;
 
+		/// Template method which overrides the value of the specified configuration parameter
+		template<typename T>
+		void SetParameter (const std::string &parameter, const T &value);
+
 		/// Sets the location and name of the configuration file
 		static void SetConfigFile(const std::string &configFile);
 
@@ -56,6 +56,20 @@ namespace Utils {
 		return this->propertyTree.get(Config::xmlRootElementName + "." + parameter, defaultValue);
 	}
 
+	/**
+	The configuration file is not modified. Only the objects created afterwards see the new value.
+	Not thread safe: call it before starting the threads which read the configuration.
+
+	Example: SetParameter("key1.key2.key3", true);
+
+	@param parameter a string wich contains the keys required to locate the required value in the XML tree.
+	@param value the new value
+	*/
+	template<typename T>
+	void Config::SetParameter (const std::string &parameter, const T &value) {
+		this->propertyTree.put(Config::xmlRootElementName + "." + parameter, value);
+	}
+
 }//namespace Utils
 }//namespace SeComLib
 